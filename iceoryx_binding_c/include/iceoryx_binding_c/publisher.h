@@ -42,6 +42,11 @@ typedef struct
     /// @brief describes whether a publisher blocks when subscriber queue is full
     ENUM iox_ConsumerTooSlowPolicy subscriberTooSlowPolicy;
 
+    /// @brief the maximum time in nanoseconds a publisher waits for subscribers which block the publisher when their
+    /// queue is full; the sample is lost for the subscribers which are still full afterwards
+    /// @note UINT64_MAX (the default) waits indefinitely
+    uint64_t subscriberTooSlowTimeoutNs;
+
     /// @brief this value will be set exclusively by 'iox_pub_options_init' and is not supposed to be modified otherwise
     uint64_t initCheck;
 } iox_pub_options_t;
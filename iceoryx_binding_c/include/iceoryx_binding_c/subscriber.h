@@ -106,6 +106,21 @@ ENUM iox_SubscribeState iox_sub_get_subscription_state(iox_sub_t const self);
 ///         an enum which describes the error
 ENUM iox_ChunkReceiveResult iox_sub_take_chunk(iox_sub_t const self, const void** const userPayload);
 
+/// @brief retrieve multiple received chunks at once
+/// @param[in] self handle to the subscriber
+/// @param[in] userPayloads array in which the pointers to the user-payloads of the chunks are stored, the oldest chunk
+///            first
+/// @param[in] userPayloadsCapacity number of elements of the userPayloads array, the maximum number of chunks to
+///            retrieve
+/// @param[out] numberOfChunks pointer in which the number of retrieved chunks is stored; it is set to 0 when an error
+///             is returned
+/// @return if at least one chunk could be received it returns ChunkReceiveResult_SUCCESS otherwise
+///         an enum which describes the error
+ENUM iox_ChunkReceiveResult iox_sub_take_chunks(iox_sub_t const self,
+                                                const void** const userPayloads,
+                                                const uint64_t userPayloadsCapacity,
+                                                uint64_t* const numberOfChunks);
+
 /// @brief release a previously acquired chunk (via iox_sub_take_chunk)
 /// @param[in] self handle to the subscriber
 /// @param[in] userPayload pointer to the user-payload of chunk which should be released
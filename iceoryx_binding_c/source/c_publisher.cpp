@@ -24,6 +24,8 @@
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iox/logging.hpp"
 
+#include <limits>
+
 
 using namespace iox;
 using namespace iox::popo;
@@ -50,6 +52,7 @@ void iox_pub_options_init(iox_pub_options_t* options)
     options->nodeName = nullptr;
     options->offerOnCreate = publisherOptions.offerOnCreate;
     options->subscriberTooSlowPolicy = cpp2c::consumerTooSlowPolicy(publisherOptions.subscriberTooSlowPolicy);
+    options->subscriberTooSlowTimeoutNs = publisherOptions.subscriberTooSlowTimeout.toNanoseconds();
 
     options->initCheck = PUBLISHER_OPTIONS_INIT_CHECK_CONSTANT;
 }
@@ -90,6 +93,10 @@ iox_pub_t iox_pub_init(iox_pub_storage_t* self,
         }
         publisherOptions.offerOnCreate = options->offerOnCreate;
         publisherOptions.subscriberTooSlowPolicy = c2cpp::consumerTooSlowPolicy(options->subscriberTooSlowPolicy);
+        publisherOptions.subscriberTooSlowTimeout =
+            (options->subscriberTooSlowTimeoutNs == std::numeric_limits<uint64_t>::max())
+                ? units::Duration::max()
+                : units::Duration::fromNanoseconds(options->subscriberTooSlowTimeoutNs);
     }
 
     auto* me = new cpp2c_Publisher();
@@ -24,7 +24,9 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/logging.hpp"
+#include "iox/span.hpp"
 
 
 using namespace iox;
@@ -164,6 +166,35 @@ iox_ChunkReceiveResult iox_sub_take_chunk(iox_sub_t const self, const void** con
     return ChunkReceiveResult_SUCCESS;
 }
 
+iox_ChunkReceiveResult iox_sub_take_chunks(iox_sub_t const self,
+                                           const void** const userPayloads,
+                                           const uint64_t userPayloadsCapacity,
+                                           uint64_t* const numberOfChunks)
+{
+    IOX_EXPECTS(self != nullptr);
+    IOX_EXPECTS(userPayloads != nullptr);
+    IOX_EXPECTS(numberOfChunks != nullptr);
+
+    // the application cannot hold more chunks at once
+    const ChunkHeader* chunkHeaders[MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY];
+    const auto maxNumberOfChunks =
+        algorithm::minVal<uint64_t>(userPayloadsCapacity, MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY);
+    auto result =
+        SubscriberPortUser(self->m_portData).tryGetChunks(span<const ChunkHeader*>(chunkHeaders, maxNumberOfChunks));
+    if (result.has_error())
+    {
+        *numberOfChunks = 0U;
+        return cpp2c::chunkReceiveResult(result.error());
+    }
+
+    for (uint64_t i = 0U; i < result.value(); ++i)
+    {
+        userPayloads[i] = chunkHeaders[i]->userPayload();
+    }
+    *numberOfChunks = result.value();
+    return ChunkReceiveResult_SUCCESS;
+}
+
 void iox_sub_release_chunk(iox_sub_t const self, const void* const userPayload)
 {
     IOX_EXPECTS(self != nullptr);
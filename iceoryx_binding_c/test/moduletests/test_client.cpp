@@ -69,7 +69,8 @@ class iox_client_test : public Test
         sutPort->m_connectRequested.store(true);
         sutPort->m_connectionState = iox::ConnectionState::CONNECTED;
 
-        sutPort->m_chunkSenderData.m_queues.emplace_back(&serverChunkQueueData);
+        ChunkSender<ClientChunkSenderData_t> chunkSender{&sutPort->m_chunkSenderData};
+        ASSERT_FALSE(chunkSender.tryAddQueue(&serverChunkQueueData).has_error());
     }
 
     void receiveChunk(const int64_t chunkValue = 0)
@@ -38,6 +38,8 @@ extern "C" {
 
 #include "test.hpp"
 
+#include <limits>
+
 namespace
 {
 using namespace ::testing;
@@ -155,6 +157,26 @@ TEST_F(iox_pub_test, initPublisherWithDefaultOptionsWorks)
     iox_pub_deinit(sut);
 }
 
+TEST_F(iox_pub_test, initPublisherWithSubscriberTooSlowTimeoutPassesTheTimeoutToThePort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "95d46953-e0ef-4cf2-88fc-9b9f02ce830a");
+    iox::roudi_env::RouDiEnv roudiEnv{MinimalRouDiConfigBuilder().create()};
+
+    iox_runtime_init("hypnotoad");
+
+    constexpr uint64_t TIMEOUT_NS{1234567U};
+    iox_pub_options_t options;
+    iox_pub_options_init(&options);
+    options.subscriberTooSlowTimeoutNs = TIMEOUT_NS;
+    iox_pub_storage_t storage;
+
+    auto sut = iox_pub_init(&storage, "a", "b", "c", &options);
+    ASSERT_THAT(sut, Ne(nullptr));
+    EXPECT_THAT(sut->m_portData->m_chunkSenderData.m_consumerTooSlowTimeout,
+                Eq(iox::units::Duration::fromNanoseconds(TIMEOUT_NS)));
+    iox_pub_deinit(sut);
+}
+
 TEST_F(iox_pub_test, initialStateOfIsOfferedIsAsExpected)
 {
     ::testing::Test::RecordProperty("TEST_ID", "fa757a54-a8df-420e-b32d-a9d5724a7d20");
@@ -426,6 +448,7 @@ TEST(iox_pub_options_test, publisherOptionsAreInitializedCorrectly)
     sut.nodeName = "Dr.Gonzo";
     sut.offerOnCreate = false;
     sut.subscriberTooSlowPolicy = ConsumerTooSlowPolicy_WAIT_FOR_CONSUMER;
+    sut.subscriberTooSlowTimeoutNs = 73;
 
     PublisherOptions options;
     // set offerOnCreate to the opposite of the expected default to check if it gets overwritten to default
@@ -436,6 +459,7 @@ TEST(iox_pub_options_test, publisherOptionsAreInitializedCorrectly)
     EXPECT_EQ(sut.nodeName, nullptr);
     EXPECT_EQ(sut.offerOnCreate, options.offerOnCreate);
     EXPECT_EQ(sut.subscriberTooSlowPolicy, cpp2c::consumerTooSlowPolicy(options.subscriberTooSlowPolicy));
+    EXPECT_EQ(sut.subscriberTooSlowTimeoutNs, std::numeric_limits<uint64_t>::max());
     EXPECT_TRUE(iox_pub_options_is_initialized(&sut));
 }
 
@@ -83,7 +83,8 @@ class iox_server_test : public Test
 
     void connectClient()
     {
-        sutPort->m_chunkSenderData.m_queues.emplace_back(&clientResponseQueueData);
+        ChunkSender<ServerChunkSenderData_t> chunkSender{&sutPort->m_chunkSenderData};
+        ASSERT_FALSE(chunkSender.tryAddQueue(&clientResponseQueueData).has_error());
     }
 
     void prepareServerInit(const ServerOptions& options = ServerOptions())
@@ -283,6 +283,42 @@ TEST_F(iox_sub_test, receiveChunkWhenToManyChunksAreHold)
     EXPECT_EQ(iox_sub_take_chunk(m_sut, &chunk), ChunkReceiveResult_TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
 }
 
+TEST_F(iox_sub_test, takeChunksFromEmptyQueueReturnsNoChunkAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a864f728-d531-4734-baca-e467f3bee198");
+    this->Subscribe(&m_portPtr);
+
+    const void* chunks[2U];
+    uint64_t numberOfChunks{42U};
+    EXPECT_EQ(iox_sub_take_chunks(m_sut, chunks, 2U, &numberOfChunks), ChunkReceiveResult_NO_CHUNK_AVAILABLE);
+    EXPECT_THAT(numberOfChunks, Eq(0U));
+}
+
+TEST_F(iox_sub_test, takeChunksReceivesAllQueuedChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "546abd4c-4fab-4f8d-b20b-2fdb067dcf40");
+    this->Subscribe(&m_portPtr);
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        *static_cast<uint64_t*>(sharedChunk.getUserPayload()) = i;
+        m_chunkPusher.push(sharedChunk);
+    }
+
+    const void* chunks[NUMBER_OF_CHUNKS + 1U];
+    uint64_t numberOfChunks{0U};
+    ASSERT_EQ(iox_sub_take_chunks(m_sut, chunks, NUMBER_OF_CHUNKS + 1U, &numberOfChunks),
+              ChunkReceiveResult_SUCCESS);
+    ASSERT_THAT(numberOfChunks, Eq(NUMBER_OF_CHUNKS));
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        EXPECT_THAT(*static_cast<const uint64_t*>(chunks[i]), Eq(i));
+        iox_sub_release_chunk(m_sut, chunks[i]);
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
 TEST_F(iox_sub_test, releaseChunkWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "53619897-cad8-4377-a877-4ec6971308fa");
@@ -465,6 +501,15 @@ TEST_F(iox_sub_test, subscriberTakeChunkWithNullptrFails)
                                               iox::HoofsError::EXPECTS_ENSURES_FAILED);
 }
 
+TEST_F(iox_sub_test, subscriberTakeChunksWithNullptrFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6c90e7b5-05c3-428a-85fb-cc636d779eb6");
+    const void* chunks[1U];
+    uint64_t numberOfChunks{0U};
+    IOX_EXPECT_FATAL_FAILURE<iox::HoofsError>([&] { iox_sub_take_chunks(nullptr, chunks, 1U, &numberOfChunks); },
+                                              iox::HoofsError::EXPECTS_ENSURES_FAILED);
+}
+
 TEST_F(iox_sub_test, subReleaseChunkWithNullptrFails)
 {
     ::testing::Test::RecordProperty("TEST_ID", "425c9e6c-5211-4f35-b1d9-408e328757d0");
@@ -88,6 +88,12 @@ class MpmcLoFFLi
     /// @return true if index is valid, false otherwise
     bool pop(Index_t& index) noexcept;
 
+    /// Pop multiple values from the free-list with a single update of the head
+    /// @param [out] indices storage for at least maxNumberOfIndices elements to use
+    /// @param [in] maxNumberOfIndices is the maximum number of elements to pop
+    /// @return the number of valid indices; 0 if the free-list is empty
+    uint32_t popBatch(not_null<Index_t*> indices, const uint32_t maxNumberOfIndices) noexcept;
+
     /// Push previously poped element
     /// @param [in] index to previously poped element
     /// @return true if index is valid or not yet pushed, false otherwise
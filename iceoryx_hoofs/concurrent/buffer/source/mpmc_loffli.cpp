@@ -80,6 +80,54 @@ bool MpmcLoFFLi::pop(Index_t& index) noexcept
     return true;
 }
 
+uint32_t MpmcLoFFLi::popBatch(not_null<Index_t*> indices, const uint32_t maxNumberOfIndices) noexcept
+{
+    Index_t* const poppedIndices = indices;
+    Node oldHead = m_head.load(std::memory_order_acquire);
+    Node newHead = oldHead;
+    uint32_t numberOfIndices{0U};
+
+    do
+    {
+        if (!m_nextFreeIndex)
+        {
+            return 0U;
+        }
+
+        /// the chain below an unchanged head cannot change since only the head can be popped; if another thread
+        /// pops concurrently, the chain can contain invalid indices but then the compare exchange fails anyway
+        numberOfIndices = 0U;
+        newHead.indexToNextFreeIndex = oldHead.indexToNextFreeIndex;
+        while (numberOfIndices < maxNumberOfIndices && newHead.indexToNextFreeIndex < m_size)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by m_size
+            poppedIndices[numberOfIndices] = newHead.indexToNextFreeIndex;
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) upper limit of index set by m_size
+            newHead.indexToNextFreeIndex = m_nextFreeIndex.get()[newHead.indexToNextFreeIndex];
+            ++numberOfIndices;
+        }
+
+        if (numberOfIndices == 0U)
+        {
+            return 0U;
+        }
+
+        newHead.abaCounter = oldHead.abaCounter + 1;
+    } while (!m_head.compare_exchange_weak(oldHead, newHead, std::memory_order_acq_rel, std::memory_order_acquire));
+
+    for (uint32_t i = 0U; i < numberOfIndices; ++i)
+    {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) indices were validated above
+        m_nextFreeIndex.get()[poppedIndices[i]] = m_invalidIndex;
+    }
+
+    /// we need to synchronize m_nextFreeIndex with push so that we can perform a validation
+    /// check right before push to avoid double free's
+    std::atomic_thread_fence(std::memory_order_release);
+
+    return numberOfIndices;
+}
+
 bool MpmcLoFFLi::push(const Index_t index) noexcept
 {
     /// we synchronize with m_nextFreeIndex in pop to perform the validity check
@@ -472,18 +472,8 @@ template <typename T, uint64_t CAPACITY>
 inline typename FixedPositionContainer<T, CAPACITY>::Iterator
 FixedPositionContainer<T, CAPACITY>::erase(const T* ptr) noexcept
 {
-    IOX_EXPECTS_WITH_MSG(ptr != nullptr, "Pointer is a nullptr!");
-
-    const T* const firstElement = &m_data[0];
-    IOX_EXPECTS_WITH_MSG(ptr >= firstElement, "Pointer pointing out of the container!");
-
-    const auto index = static_cast<IndexType>(ptr - firstElement);
-    IOX_EXPECTS_WITH_MSG(index <= Index::LAST, "Pointer pointing out of the container!");
-
-    IOX_EXPECTS_WITH_MSG(ptr == &m_data[index], "Pointer is not aligned to an element in the container!");
-
     // NOTE: if the implementation changes from simply forwarding to 'erase(IndexType)' tests need to be written
-    return erase(index);
+    return erase(index_from_ptr(ptr));
 }
 
 template <typename T, uint64_t CAPACITY>
@@ -549,6 +539,44 @@ FixedPositionContainer<T, CAPACITY>::iter_from_index(const IndexType index) cons
     return ConstIterator(index, *this);
 }
 
+template <typename T, uint64_t CAPACITY>
+inline typename FixedPositionContainer<T, CAPACITY>::Iterator
+FixedPositionContainer<T, CAPACITY>::iter_from_ptr(const T* ptr)
+{
+    return iter_from_index(index_from_ptr(ptr));
+}
+
+template <typename T, uint64_t CAPACITY>
+inline typename FixedPositionContainer<T, CAPACITY>::ConstIterator
+FixedPositionContainer<T, CAPACITY>::iter_from_ptr(const T* ptr) const
+{
+    return iter_from_index(index_from_ptr(ptr));
+}
+
+template <typename T, uint64_t CAPACITY>
+inline typename FixedPositionContainer<T, CAPACITY>::IndexType
+FixedPositionContainer<T, CAPACITY>::index_from_ptr(const T* ptr) const noexcept
+{
+    IOX_EXPECTS_WITH_MSG(ptr != nullptr, "Pointer is a nullptr!");
+
+    // the distance is calculated on the addresses since pointer arithmetic with a pointer which does not point to an
+    // element of the container is undefined behavior and the checks below could be optimized away
+    // NOLINTJUSTIFICATION the address is only used for the range and alignment checks
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto address = reinterpret_cast<uintptr_t>(ptr);
+    const auto firstElementAddress = reinterpret_cast<uintptr_t>(&m_data[0]);
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+    IOX_EXPECTS_WITH_MSG(address >= firstElementAddress, "Pointer pointing out of the container!");
+
+    const uint64_t offset = address - firstElementAddress;
+    IOX_EXPECTS_WITH_MSG(offset % sizeof(T) == 0U, "Pointer is not aligned to an element in the container!");
+
+    const auto index = offset / sizeof(T);
+    IOX_EXPECTS_WITH_MSG(index <= Index::LAST, "Pointer pointing out of the container!");
+
+    return static_cast<IndexType>(index);
+}
+
 template <typename T, uint64_t CAPACITY>
 inline typename FixedPositionContainer<T, CAPACITY>::Iterator FixedPositionContainer<T, CAPACITY>::begin() noexcept
 {
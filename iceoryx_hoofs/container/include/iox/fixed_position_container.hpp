@@ -153,6 +153,24 @@ class FixedPositionContainer final
     /// an empty slot
     [[nodiscard]] ConstIterator iter_from_index(const IndexType index) const;
 
+    /// @brief Get the iterator to the element pointed to by the pointer
+    /// @param[in] ptr a pointer to an element in the container
+    /// @return iterator pointing to the element or end iterator if the pointer pointed to an empty slot
+    /// @attention aborts if the pointer
+    ///              - is a nullptr
+    ///              - points outside of the container
+    ///              - is not aligned to a slot in the container
+    [[nodiscard]] Iterator iter_from_ptr(const T* ptr);
+
+    /// @brief Get the const iterator to the element pointed to by the pointer
+    /// @param[in] ptr a pointer to an element in the container
+    /// @return iterator pointing to the element or end iterator if the pointer pointed to an empty slot
+    /// @attention aborts if the pointer
+    ///              - is a nullptr
+    ///              - points outside of the container
+    ///              - is not aligned to a slot in the container
+    [[nodiscard]] ConstIterator iter_from_ptr(const T* ptr) const;
+
     /// @brief Get an iterator pointing to the beginning of the container
     /// @return iterator pointing to the beginning of the container
     [[nodiscard]] Iterator begin() noexcept;
@@ -319,6 +337,8 @@ class FixedPositionContainer final
     template <MoveAndCopyOperations Opt, typename RhsType>
     void copy_and_move_impl(RhsType&& rhs) noexcept;
 
+    IndexType index_from_ptr(const T* ptr) const noexcept;
+
   private:
     UninitializedArray<T, CAPACITY> m_data;
     UninitializedArray<SlotStatus, CAPACITY> m_status;
@@ -16,40 +16,137 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iox/posix_user.hpp"
+#include "iceoryx_platform/errno.hpp"
 #include "iceoryx_platform/grp.hpp"
 #include "iceoryx_platform/platform_correction.hpp"
 #include "iceoryx_platform/pwd.hpp"
 #include "iceoryx_platform/types.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iox/expected.hpp"
 #include "iox/logging.hpp"
 #include "iox/posix_call.hpp"
 #include "iox/uninitialized_array.hpp"
 
 #include <limits>
+#include <vector>
 
 namespace iox
 {
-optional<uid_t> PosixUser::getUserID(const userName_t& name) noexcept
+namespace
+{
+/// @brief the reentrant getpw*_r functions are used since users are looked up concurrently, e.g. by the RouDi threads
+/// which handle the registration of processes; the buffer holds the strings of the returned passwd entry
+constexpr uint64_t DEFAULT_PASSWD_BUFFER_SIZE{1024U};
+/// @brief upper limit for growing the buffer when the getpw*_r functions report ERANGE
+constexpr uint64_t MAX_PASSWD_BUFFER_SIZE{1024U * 1024U};
+
+enum class PasswdLookupError : uint8_t
+{
+    USER_NOT_FOUND,
+    BUFFER_TOO_SMALL,
+    LOOKUP_FAILED,
+};
+
+struct PasswdEntry
+{
+    passwd entry{};
+    std::vector<char> buffer;
+};
+
+uint64_t initialPasswdBufferSize() noexcept
+{
+    // sysconf returns -1 without an errno when there is no suggested size, therefore this is not an error
+    const auto suggestedSize = sysconf(_SC_GETPW_R_SIZE_MAX);
+    return (suggestedSize > 0) ? static_cast<uint64_t>(suggestedSize) : DEFAULT_PASSWD_BUFFER_SIZE;
+}
+
+/// @brief calls the provided getpw*_r function with a buffer which is sized from _SC_GETPW_R_SIZE_MAX and doubled as
+/// long as the call fails with ERANGE
+template <typename GetPasswdEntry>
+expected<PasswdEntry, PasswdLookupError> lookUpPasswdEntry(const GetPasswdEntry& getPasswdEntry) noexcept
+{
+    PasswdEntry result;
+    for (uint64_t bufferSize = initialPasswdBufferSize(); bufferSize <= MAX_PASSWD_BUFFER_SIZE; bufferSize *= 2U)
+    {
+        result.buffer.resize(bufferSize);
+        passwd* foundUserEntry{nullptr};
+        auto getpwCall = getPasswdEntry(result.entry, result.buffer, foundUserEntry);
+        if (getpwCall.has_error())
+        {
+            if (getpwCall.error().errnum == ERANGE)
+            {
+                continue;
+            }
+            return err(PasswdLookupError::LOOKUP_FAILED);
+        }
+        if (foundUserEntry == nullptr)
+        {
+            return err(PasswdLookupError::USER_NOT_FOUND);
+        }
+        return ok(std::move(result));
+    }
+    return err(PasswdLookupError::BUFFER_TOO_SMALL);
+}
+
+expected<PasswdEntry, PasswdLookupError> lookUpPasswdEntry(const char* name) noexcept
+{
+    return lookUpPasswdEntry([&](passwd& entry, std::vector<char>& buffer, passwd*& foundUserEntry) {
+        return IOX_POSIX_CALL(getpwnam_r)(name, &entry, buffer.data(), buffer.size(), &foundUserEntry)
+            .returnValueMatchesErrno()
+            .suppressErrorMessagesForErrnos(ERANGE)
+            .evaluate();
+    });
+}
+
+expected<PasswdEntry, PasswdLookupError> lookUpPasswdEntry(const uid_t id) noexcept
 {
-    auto getpwnamCall = IOX_POSIX_CALL(getpwnam)(name.c_str()).failureReturnValue(nullptr).evaluate();
+    return lookUpPasswdEntry([&](passwd& entry, std::vector<char>& buffer, passwd*& foundUserEntry) {
+        return IOX_POSIX_CALL(getpwuid_r)(id, &entry, buffer.data(), buffer.size(), &foundUserEntry)
+            .returnValueMatchesErrno()
+            .suppressErrorMessagesForErrnos(ERANGE)
+            .evaluate();
+    });
+}
+} // namespace
 
-    if (getpwnamCall.has_error())
+optional<uid_t> PosixUser::getUserID(const userName_t& name) noexcept
+{
+    auto userEntry = lookUpPasswdEntry(name.c_str());
+    if (userEntry.has_error())
     {
-        IOX_LOG(ERROR, "Error: Could not find user '" << name << "'.");
+        if (userEntry.error() == PasswdLookupError::BUFFER_TOO_SMALL)
+        {
+            IOX_LOG(ERROR,
+                    "Error: The passwd entry of user '" << name << "' exceeds " << MAX_PASSWD_BUFFER_SIZE
+                                                        << " bytes (ERANGE).");
+        }
+        else
+        {
+            IOX_LOG(ERROR, "Error: Could not find user '" << name << "'.");
+        }
         return nullopt_t();
     }
-    return make_optional<uid_t>(getpwnamCall->value->pw_uid);
+    return make_optional<uid_t>(userEntry->entry.pw_uid);
 }
 
 optional<PosixUser::userName_t> PosixUser::getUserName(uid_t id) noexcept
 {
-    auto getpwuidCall = IOX_POSIX_CALL(getpwuid)(id).failureReturnValue(nullptr).evaluate();
-
-    if (getpwuidCall.has_error())
+    auto userEntry = lookUpPasswdEntry(id);
+    if (userEntry.has_error())
     {
-        IOX_LOG(ERROR, "Error: Could not find user with id'" << id << "'.");
+        if (userEntry.error() == PasswdLookupError::BUFFER_TOO_SMALL)
+        {
+            IOX_LOG(ERROR,
+                    "Error: The passwd entry of the user with id '" << id << "' exceeds " << MAX_PASSWD_BUFFER_SIZE
+                                                                    << " bytes (ERANGE).");
+        }
+        else
+        {
+            IOX_LOG(ERROR, "Error: Could not find user with id'" << id << "'.");
+        }
         return nullopt_t();
     }
-    return make_optional<userName_t>(userName_t(iox::TruncateToCapacity, getpwuidCall->value->pw_name));
+    return make_optional<userName_t>(userName_t(iox::TruncateToCapacity, userEntry->entry.pw_name));
 }
 
 PosixUser::groupVector_t PosixUser::getGroups() const noexcept
@@ -60,14 +157,14 @@ PosixUser::groupVector_t PosixUser::getGroups() const noexcept
         return groupVector_t();
     }
 
-    auto getpwnamCall = IOX_POSIX_CALL(getpwnam)(userName->c_str()).failureReturnValue(nullptr).evaluate();
-    if (getpwnamCall.has_error())
+    auto userEntry = lookUpPasswdEntry(userName->c_str());
+    if (userEntry.has_error())
     {
-        IOX_LOG(ERROR, "Error: getpwnam call failed");
+        IOX_LOG(ERROR, "Error: getpwnam_r call failed");
         return groupVector_t();
     }
 
-    gid_t userDefaultGroup = getpwnamCall->value->pw_gid;
+    gid_t userDefaultGroup = userEntry->entry.pw_gid;
     UninitializedArray<gid_t, MAX_NUMBER_OF_GROUPS> groups{}; // groups is initialized in iox_getgrouplist
     int numGroups = MAX_NUMBER_OF_GROUPS;
 
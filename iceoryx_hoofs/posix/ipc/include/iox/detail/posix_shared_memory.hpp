@@ -22,6 +22,7 @@
 #include "iox/expected.hpp"
 #include "iox/file_management_interface.hpp"
 #include "iox/filesystem.hpp"
+#include "iox/optional.hpp"
 #include "iox/string.hpp"
 
 #include <cstdint>
@@ -38,6 +39,7 @@ enum class PosixSharedMemoryError
 {
     EMPTY_NAME,
     INVALID_FILE_NAME,
+    INVALID_DIRECTORY,
     INSUFFICIENT_PERMISSIONS,
     DOES_EXIST,
     PROCESS_LIMIT_OF_OPEN_FILES_REACHED,
@@ -55,7 +57,8 @@ enum class PosixSharedMemoryError
 };
 
 /// @brief Creates a bare metal shared memory object with the posix functions
-///        shm_open, shm_unlink etc.
+///        shm_open, shm_unlink etc. or, when a directory is provided, with a file in
+///        this directory, e.g. the mount point of a hugetlbfs.
 ///        It must be used in combination with 'PosixMemoryMap' (or manual mmap calls)
 ///        to gain access to the created/opened shared memory
 class PosixSharedMemory : public FileManagementInterface<PosixSharedMemory>
@@ -64,6 +67,7 @@ class PosixSharedMemory : public FileManagementInterface<PosixSharedMemory>
     static constexpr uint64_t NAME_SIZE = platform::IOX_MAX_SHM_NAME_LENGTH;
     static constexpr int INVALID_HANDLE = -1;
     using Name_t = string<NAME_SIZE>;
+    using Directory_t = string<platform::IOX_MAX_PATH_LENGTH>;
 
     PosixSharedMemory(const PosixSharedMemory&) = delete;
     PosixSharedMemory& operator=(const PosixSharedMemory&) = delete;
@@ -83,14 +87,19 @@ class PosixSharedMemory : public FileManagementInterface<PosixSharedMemory>
 
     /// @brief removes shared memory with a given name from the system
     /// @param[in] name name of the shared memory
+    /// @param[in] directory of the file of the shared memory, nullopt for a POSIX shared memory object
     /// @return true if the shared memory was removed, false if the shared memory did not exist and
-    ///         SharedMemoryError when the underlying shm_unlink call failed.
-    static expected<bool, PosixSharedMemoryError> unlinkIfExist(const Name_t& name) noexcept;
+    ///         SharedMemoryError when the underlying shm_unlink or unlink call failed.
+    static expected<bool, PosixSharedMemoryError>
+    unlinkIfExist(const Name_t& name, const optional<Directory_t>& directory = nullopt) noexcept;
 
     friend class PosixSharedMemoryBuilder;
 
   private:
-    PosixSharedMemory(const Name_t& name, const shm_handle_t handle, const bool hasOwnership) noexcept;
+    PosixSharedMemory(const Name_t& name,
+                      const optional<Directory_t>& directory,
+                      const shm_handle_t handle,
+                      const bool hasOwnership) noexcept;
 
     bool unlink() noexcept;
     bool close() noexcept;
@@ -103,6 +112,7 @@ class PosixSharedMemory : public FileManagementInterface<PosixSharedMemory>
     shm_handle_t get_file_handle() const noexcept;
 
     Name_t m_name;
+    optional<Directory_t> m_directory;
     shm_handle_t m_handle{INVALID_HANDLE};
     bool m_hasOwnership{false};
 };
@@ -127,6 +137,11 @@ class PosixSharedMemoryBuilder
     /// @brief Defines the size of the shared memory
     IOX_BUILDER_PARAMETER(uint64_t, size, 0U)
 
+    /// @brief If set, the shared memory is a file with the given name in this directory instead of
+    ///        a POSIX shared memory object. With the mount point of a hugetlbfs the memory is backed
+    ///        by huge pages; the size must then be a multiple of the huge page size.
+    IOX_BUILDER_PARAMETER(optional<PosixSharedMemory::Directory_t>, directory, nullopt)
+
   public:
     /// @brief creates a valid SharedMemory object. If the construction failed the expected
     ///        contains an enum value describing the error.
@@ -32,12 +32,16 @@
 namespace iox
 {
 
+/// @brief maximum number of threads which zero a newly created shared memory; larger thread counts are reduced to it
+constexpr uint32_t MAX_SHM_SEGMENT_ZEROING_THREAD_COUNT{64U};
+
 enum class PosixSharedMemoryObjectError
 {
     SHARED_MEMORY_CREATION_FAILED,
     MAPPING_SHARED_MEMORY_FAILED,
     UNABLE_TO_VERIFY_MEMORY_SIZE,
     REQUESTED_SIZE_EXCEEDS_ACTUAL_SIZE,
+    LOCKING_MEMORY_FAILED,
     INTERNAL_LOGIC_FAILURE,
 };
 
@@ -49,6 +53,17 @@ enum class PosixSharedMemoryAllocationError
 
 };
 
+/// @brief Defines on which NUMA nodes the pages of a newly created shared memory are placed
+enum class NumaMemoryPolicy : uint8_t
+{
+    /// @brief the pages are placed by the policy of the process, usually on the node of the first access
+    DEFAULT,
+    /// @brief the pages are placed only on the nodes of the node mask
+    BIND,
+    /// @brief the pages are placed round-robin on the nodes of the node mask
+    INTERLEAVE,
+};
+
 class PosixSharedMemoryObjectBuilder;
 
 /// @brief Creates a shared memory segment and maps it into the process space.
@@ -117,6 +132,31 @@ class PosixSharedMemoryObjectBuilder
     /// @brief Defines the access permissions of the shared memory
     IOX_BUILDER_PARAMETER(access_rights, permissions, perms::none)
 
+    /// @brief Defines the number of threads which zero the newly created shared memory and thereby fault in its
+    ///        pages. Large shared memories are created considerably faster with multiple threads. A value of 0 is
+    ///        treated like 1 and values above MAX_SHM_SEGMENT_ZEROING_THREAD_COUNT like the maximum. Has no effect
+    ///        when an existing shared memory is opened.
+    IOX_BUILDER_PARAMETER(uint32_t, zeroingThreadCount, 1U)
+
+    /// @brief If set, the shared memory is a file in this directory instead of a POSIX shared memory object,
+    ///        e.g. in the mount point of a hugetlbfs to back the memory with huge pages. For a hugetlbfs the
+    ///        size must be a multiple of the huge page size of the mount.
+    IOX_BUILDER_PARAMETER(optional<detail::PosixSharedMemory::Directory_t>, directory, nullopt)
+
+    /// @brief Defines the NUMA memory policy which is applied to a newly created shared memory before its pages
+    ///        are faulted in. If the policy cannot be applied, e.g. on a system without NUMA support, a warning is
+    ///        logged and the pages are placed by the default policy. Has no effect when an existing shared memory
+    ///        is opened.
+    IOX_BUILDER_PARAMETER(NumaMemoryPolicy, numaPolicy, NumaMemoryPolicy::DEFAULT)
+
+    /// @brief The NUMA nodes for the numaPolicy with one bit per node, e.g. 0b101 for the nodes 0 and 2
+    IOX_BUILDER_PARAMETER(uint64_t, numaNodeMask, 0U)
+
+    /// @brief If true, all pages of the mapped shared memory are locked in RAM so that accessing them never causes
+    ///        a major page fault, also when the shared memory is opened. The locked memory of a process is limited
+    ///        by its RLIMIT_MEMLOCK unless it has the CAP_IPC_LOCK capability.
+    IOX_BUILDER_PARAMETER(bool, lockInMemory, false)
+
   public:
     expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> create() noexcept;
 };
@@ -32,11 +32,24 @@ namespace iox
 {
 namespace detail
 {
-string<PosixSharedMemory::Name_t::capacity() + 1> addLeadingSlash(const PosixSharedMemory::Name_t& name) noexcept
+using SharedMemoryPath_t =
+    string<PosixSharedMemory::Directory_t::capacity() + PosixSharedMemory::Name_t::capacity() + 1>;
+
+/// @brief shm_open requires the name with a leading slash, a file in a directory requires the full path
+SharedMemoryPath_t sharedMemoryPath(const PosixSharedMemory::Name_t& name,
+                                    const optional<PosixSharedMemory::Directory_t>& directory) noexcept
 {
-    string<PosixSharedMemory::Name_t::capacity() + 1> nameWithLeadingSlash = "/";
-    nameWithLeadingSlash.append(TruncateToCapacity, name);
-    return nameWithLeadingSlash;
+    SharedMemoryPath_t path;
+    if (directory)
+    {
+        path.append(TruncateToCapacity, *directory);
+    }
+    if (path.empty() || path[path.size() - 1U] != '/')
+    {
+        path.append(TruncateToCapacity, '/');
+    }
+    path.append(TruncateToCapacity, name);
+    return path;
 }
 
 // NOLINTJUSTIFICATION the function size and cognitive complexity results from the error handling and the expanded log macro
@@ -46,7 +59,8 @@ expected<PosixSharedMemory, PosixSharedMemoryError> PosixSharedMemoryBuilder::cr
     auto printError = [this] {
         IOX_LOG(ERROR,
                 "Unable to create shared memory with the following properties [ name = "
-                    << m_name << ", access mode = " << asStringLiteral(m_accessMode)
+                    << m_name << ", directory = " << (m_directory ? m_directory->c_str() : "(none)")
+                    << ", access mode = " << asStringLiteral(m_accessMode)
                     << ", open mode = " << asStringLiteral(m_openMode)
                     << ", mode = " << iox::log::oct(m_filePermissions.value()) << ", sizeInBytes = " << m_size << " ]");
     };
@@ -67,7 +81,15 @@ expected<PosixSharedMemory, PosixSharedMemoryError> PosixSharedMemoryBuilder::cr
         return err(PosixSharedMemoryError::INVALID_FILE_NAME);
     }
 
-    auto nameWithLeadingSlash = addLeadingSlash(m_name);
+    if (m_directory && !isValidPathToDirectory(*m_directory))
+    {
+        IOX_LOG(ERROR, "Shared memory requires a valid path as directory and \"" << *m_directory << "\" is not valid");
+        return err(PosixSharedMemoryError::INVALID_DIRECTORY);
+    }
+
+    auto path = sharedMemoryPath(m_name, m_directory);
+    auto* const openSharedMemory = m_directory ? &iox_open : &iox_shm_open;
+    auto* const unlinkSharedMemory = m_directory ? &iox_unlink : &iox_shm_unlink;
 
     bool hasOwnership = (m_openMode == OpenMode::EXCLUSIVE_CREATE || m_openMode == OpenMode::PURGE_AND_CREATE
                          || m_openMode == OpenMode::OPEN_OR_CREATE);
@@ -88,15 +110,15 @@ expected<PosixSharedMemory, PosixSharedMemoryError> PosixSharedMemoryBuilder::cr
 
         if (m_openMode == OpenMode::PURGE_AND_CREATE)
         {
-            IOX_DISCARD_RESULT(IOX_POSIX_CALL(iox_shm_unlink)(nameWithLeadingSlash.c_str())
+            IOX_DISCARD_RESULT(IOX_POSIX_CALL(*unlinkSharedMemory)(path.c_str())
                                    .failureReturnValue(PosixSharedMemory::INVALID_HANDLE)
                                    .ignoreErrnos(ENOENT)
                                    .evaluate());
         }
 
         auto result =
-            IOX_POSIX_CALL(iox_shm_open)(
-                nameWithLeadingSlash.c_str(),
+            IOX_POSIX_CALL(*openSharedMemory)(
+                path.c_str(),
                 convertToOflags(m_accessMode,
                                 (m_openMode == OpenMode::OPEN_OR_CREATE) ? OpenMode::EXCLUSIVE_CREATE : m_openMode),
                 m_filePermissions.value())
@@ -110,9 +132,9 @@ expected<PosixSharedMemory, PosixSharedMemoryError> PosixSharedMemoryBuilder::cr
             if (m_openMode == OpenMode::OPEN_OR_CREATE && result.error().errnum == EEXIST)
             {
                 hasOwnership = false;
-                result = IOX_POSIX_CALL(iox_shm_open)(nameWithLeadingSlash.c_str(),
-                                                      convertToOflags(m_accessMode, OpenMode::OPEN_EXISTING),
-                                                      m_filePermissions.value())
+                result = IOX_POSIX_CALL(*openSharedMemory)(path.c_str(),
+                                                           convertToOflags(m_accessMode, OpenMode::OPEN_EXISTING),
+                                                           m_filePermissions.value())
                              .failureReturnValue(PosixSharedMemory::INVALID_HANDLE)
                              .evaluate();
             }
@@ -146,8 +168,8 @@ expected<PosixSharedMemory, PosixSharedMemoryError> PosixSharedMemoryBuilder::cr
                                 << r.getHumanReadableErrnum() << " for SharedMemory \"" << m_name << "\"");
                 });
 
-            IOX_POSIX_CALL(iox_shm_unlink)
-            (nameWithLeadingSlash.c_str())
+            IOX_POSIX_CALL(*unlinkSharedMemory)
+            (path.c_str())
                 .failureReturnValue(PosixSharedMemory::INVALID_HANDLE)
                 .evaluate()
                 .or_else([&](auto&) {
@@ -160,11 +182,15 @@ expected<PosixSharedMemory, PosixSharedMemoryError> PosixSharedMemoryBuilder::cr
         }
     }
 
-    return ok(PosixSharedMemory(m_name, sharedMemoryFileHandle, hasOwnership));
+    return ok(PosixSharedMemory(m_name, m_directory, sharedMemoryFileHandle, hasOwnership));
 }
 
-PosixSharedMemory::PosixSharedMemory(const Name_t& name, const shm_handle_t handle, const bool hasOwnership) noexcept
+PosixSharedMemory::PosixSharedMemory(const Name_t& name,
+                                     const optional<Directory_t>& directory,
+                                     const shm_handle_t handle,
+                                     const bool hasOwnership) noexcept
     : m_name{name}
+    , m_directory{directory}
     , m_handle{handle}
     , m_hasOwnership{hasOwnership}
 {
@@ -185,6 +211,7 @@ void PosixSharedMemory::reset() noexcept
 {
     m_hasOwnership = false;
     m_name = Name_t();
+    m_directory.reset();
     m_handle = INVALID_HANDLE;
 }
 
@@ -200,6 +227,7 @@ PosixSharedMemory& PosixSharedMemory::operator=(PosixSharedMemory&& rhs) noexcep
         destroy();
 
         m_name = rhs.m_name;
+        m_directory = rhs.m_directory;
         m_hasOwnership = rhs.m_hasOwnership;
         m_handle = rhs.m_handle;
 
@@ -223,11 +251,13 @@ bool PosixSharedMemory::hasOwnership() const noexcept
     return m_hasOwnership;
 }
 
-expected<bool, PosixSharedMemoryError> PosixSharedMemory::unlinkIfExist(const Name_t& name) noexcept
+expected<bool, PosixSharedMemoryError> PosixSharedMemory::unlinkIfExist(const Name_t& name,
+                                                                        const optional<Directory_t>& directory) noexcept
 {
-    auto nameWithLeadingSlash = addLeadingSlash(name);
+    auto path = sharedMemoryPath(name, directory);
+    auto* const unlinkSharedMemory = directory ? &iox_unlink : &iox_shm_unlink;
 
-    auto result = IOX_POSIX_CALL(iox_shm_unlink)(nameWithLeadingSlash.c_str())
+    auto result = IOX_POSIX_CALL(*unlinkSharedMemory)(path.c_str())
                       .failureReturnValue(INVALID_HANDLE)
                       .ignoreErrnos(ENOENT)
                       .evaluate();
@@ -244,7 +274,7 @@ bool PosixSharedMemory::unlink() noexcept
 {
     if (m_hasOwnership)
     {
-        auto unlinkResult = unlinkIfExist(m_name);
+        auto unlinkResult = unlinkIfExist(m_name, m_directory);
         if (unlinkResult.has_error() || !unlinkResult.value())
         {
             IOX_LOG(ERROR, "Unable to unlink SharedMemory (shm_unlink failed).");
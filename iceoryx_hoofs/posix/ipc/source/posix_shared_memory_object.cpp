@@ -17,11 +17,17 @@
 
 #include "iox/posix_shared_memory_object.hpp"
 #include "iceoryx_platform/fcntl.hpp"
+#include "iceoryx_platform/mman.hpp"
 #include "iceoryx_platform/unistd.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/attributes.hpp"
+#include "iox/detail/system_configuration.hpp"
 #include "iox/filesystem.hpp"
 #include "iox/logging.hpp"
+#include "iox/posix_call.hpp"
 #include "iox/signal_handler.hpp"
+#include "iox/thread.hpp"
+#include "iox/vector.hpp"
 
 #include <bitset>
 #include <cstdlib>
@@ -50,6 +56,95 @@ static void memsetSigbusHandler(int) noexcept
     IOX_DISCARD_RESULT(result);
     _exit(EXIT_FAILURE);
 }
+
+/// @brief Sets the memory to zero which also faults in all of its pages. The memory is split into page aligned
+///        parts which are zeroed concurrently when more than one thread is requested. A part for which no thread
+///        can be created is zeroed by the calling thread.
+static void zeroMemory(void* const memory, const uint64_t size, const uint32_t threadCount) noexcept
+{
+    const uint32_t boundedThreadCount = algorithm::minVal(threadCount, MAX_SHM_SEGMENT_ZEROING_THREAD_COUNT);
+    const uint64_t numberOfPages = (size + pageSize() - 1U) / pageSize();
+    const uint64_t pagesPerThread = (numberOfPages + boundedThreadCount - 1U) / boundedThreadCount;
+    const uint64_t bytesPerThread = pagesPerThread * pageSize();
+    if (boundedThreadCount <= 1U || bytesPerThread == 0U || bytesPerThread >= size)
+    {
+        memset(memory, 0, size);
+        return;
+    }
+
+    auto* const bytes = static_cast<uint8_t*>(memory);
+    // the threads are joined when the vector goes out of scope
+    vector<optional<Thread>, MAX_SHM_SEGMENT_ZEROING_THREAD_COUNT> threads;
+    for (uint64_t offset = 0U; offset < size; offset += bytesPerThread)
+    {
+        const uint64_t length = algorithm::minVal(bytesPerThread, size - offset);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) offset is always smaller than size
+        auto zeroPart = [bytes, offset, length] { memset(bytes + offset, 0, length); };
+
+        // the number of parts never exceeds the bounded thread count, therefore emplace_back always succeeds
+        if (!threads.emplace_back() || ThreadBuilder().name("ShmZeroing").create(threads.back(), zeroPart).has_error())
+        {
+            zeroPart();
+        }
+    }
+}
+
+/// @brief Applies the NUMA memory policy to the memory. Since this only succeeds for pages which are not yet
+///        faulted in, it must be called before the memory is zeroed.
+static void applyNumaPolicy(void* const memory,
+                            const uint64_t size,
+                            const NumaMemoryPolicy policy,
+                            const uint64_t nodeMask) noexcept
+{
+    if (policy == NumaMemoryPolicy::DEFAULT)
+    {
+        return;
+    }
+
+    const int mode = (policy == NumaMemoryPolicy::BIND) ? IOX_MPOL_BIND : IOX_MPOL_INTERLEAVE;
+    auto result = IOX_POSIX_CALL(iox_mbind)(memory, size, mode, nodeMask)
+                      .failureReturnValue(-1)
+                      .suppressErrorMessagesForErrnos(EINVAL, ENOSYS, EPERM)
+                      .evaluate();
+    if (result.has_error())
+    {
+        IOX_LOG(WARN,
+                "Unable to apply the NUMA policy with the node mask "
+                    << iox::log::hex(nodeMask) << " to the shared memory, the pages are placed by the default policy ("
+                    << result.error().getHumanReadableErrnum() << ")");
+    }
+}
+
+/// @brief Locks the memory in RAM and reports the RLIMIT_MEMLOCK of the process if this fails
+static bool lockMemory(const void* const memory, const uint64_t size, const PosixSharedMemory::Name_t& name) noexcept
+{
+    auto result = IOX_POSIX_CALL(iox_mlock)(memory, size)
+                      .failureReturnValue(-1)
+                      .suppressErrorMessagesForErrnos(ENOMEM, EPERM, EAGAIN)
+                      .evaluate();
+    if (!result.has_error())
+    {
+        return true;
+    }
+
+    uint64_t limit{0U};
+    if (iox_get_mlock_limit(&limit) == 0 && limit != UINT64_MAX)
+    {
+        IOX_LOG(ERROR,
+                "Unable to lock the " << size << " bytes of the shared memory [" << name << "] in memory ("
+                                      << result.error().getHumanReadableErrnum()
+                                      << "). The RLIMIT_MEMLOCK of the process allows to lock " << limit
+                                      << " bytes in total. Raise it, e.g. with 'ulimit -l' or the 'LimitMEMLOCK' "
+                                         "setting of systemd, or grant the CAP_IPC_LOCK capability to the process.");
+    }
+    else
+    {
+        IOX_LOG(ERROR,
+                "Unable to lock the " << size << " bytes of the shared memory [" << name << "] in memory ("
+                                      << result.error().getHumanReadableErrnum() << ")");
+    }
+    return false;
+}
 } // namespace detail
 constexpr const void* const PosixSharedMemoryObject::NO_ADDRESS_HINT;
 
@@ -73,7 +168,8 @@ expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> PosixSharedMemor
 
         IOX_LOG(ERROR,
                 "Unable to create a shared memory object with the following properties [ name = "
-                    << m_name << ", sizeInBytes = " << m_memorySizeInBytes
+                    << m_name << ", directory = " << (m_directory ? m_directory->c_str() : "(none)")
+                    << ", sizeInBytes = " << m_memorySizeInBytes
                     << ", access mode = " << asStringLiteral(m_accessMode)
                     << ", open mode = " << asStringLiteral(m_openMode) << ", baseAddressHint = " << logBaseAddressHint
                     << ", permissions = " << iox::log::oct(m_permissions.value()) << " ]");
@@ -85,6 +181,7 @@ expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> PosixSharedMemor
                             .openMode(m_openMode)
                             .size(m_memorySizeInBytes)
                             .filePermissions(m_permissions)
+                            .directory(m_directory)
                             .create();
 
     if (!sharedMemory)
@@ -133,6 +230,7 @@ expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> PosixSharedMemor
     if (sharedMemory->hasOwnership())
     {
         IOX_LOG(DEBUG, "Trying to reserve " << m_memorySizeInBytes << " bytes in the shared memory [" << m_name << "]");
+        detail::applyNumaPolicy(memoryMap->getBaseAddress(), realSize, m_numaPolicy, m_numaNodeMask);
         if (platform::IOX_SHM_WRITE_ZEROS_ON_CREATION)
         {
             // this lock is required for the case that multiple threads are creating multiple
@@ -163,12 +261,19 @@ expected<PosixSharedMemoryObject, PosixSharedMemoryObjectError> PosixSharedMemor
                 (m_baseAddressHint) ? *m_baseAddressHint : nullptr,
                 m_permissions.value()));
 
-            memset(memoryMap->getBaseAddress(), 0, m_memorySizeInBytes);
+            detail::zeroMemory(
+                memoryMap->getBaseAddress(), m_memorySizeInBytes, algorithm::maxVal(m_zeroingThreadCount, 1U));
         }
         IOX_LOG(DEBUG,
                 "Acquired " << m_memorySizeInBytes << " bytes successfully in the shared memory [" << m_name << "]");
     }
 
+    if (m_lockInMemory && !detail::lockMemory(memoryMap->getBaseAddress(), realSize, m_name))
+    {
+        printErrorDetails();
+        return err(PosixSharedMemoryObjectError::LOCKING_MEMORY_FAILED);
+    }
+
     return ok(PosixSharedMemoryObject(std::move(*sharedMemory), std::move(*memoryMap)));
 }
 
@@ -128,6 +128,51 @@ TEST_F(MpmcLoFFLi_test, PopFromUninitializedLoFFLi)
     EXPECT_THAT(loFFLi.pop(index), Eq(false));
 }
 
+TEST_F(MpmcLoFFLi_test, PopBatchReturnsRequestedNumberOfIndices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7c2d4e91-5a3b-4f08-b6d1-e0a9f3c85b27");
+    constexpr uint32_t NUMBER_OF_INDICES{CAPACITY - 1U};
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) needed for MpmcLoFFLi::popBatch
+    uint32_t indices[CAPACITY]{};
+
+    EXPECT_THAT(this->m_loffli.popBatch(&indices[0], NUMBER_OF_INDICES), Eq(NUMBER_OF_INDICES));
+    for (uint32_t i = 0; i < NUMBER_OF_INDICES; i++)
+    {
+        EXPECT_THAT(indices[i], Eq(i));
+    }
+
+    uint32_t index{0U};
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+    EXPECT_THAT(index, Eq(NUMBER_OF_INDICES));
+}
+
+TEST_F(MpmcLoFFLi_test, PopBatchReturnsOnlyRemainingIndicesAndZeroWhenEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d1f8a3b6-29c7-4e50-9f4a-6b3e7c0d2a18");
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) needed for MpmcLoFFLi::popBatch
+    uint32_t indices[2U * CAPACITY]{};
+
+    uint32_t index{0U};
+    EXPECT_THAT(this->m_loffli.pop(index), Eq(true));
+
+    EXPECT_THAT(this->m_loffli.popBatch(&indices[0], 2U * CAPACITY), Eq(CAPACITY - 1U));
+    EXPECT_THAT(this->m_loffli.popBatch(&indices[0], 2U * CAPACITY), Eq(0U));
+}
+
+TEST_F(MpmcLoFFLi_test, IndicesFromPopBatchCanBePushed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4a6e0c83-b7f2-41d9-8e35-c9d2b1f07e64");
+    // NOLINTNEXTLINE(hicpp-avoid-c-arrays, cppcoreguidelines-avoid-c-arrays) needed for MpmcLoFFLi::popBatch
+    uint32_t indices[CAPACITY]{};
+
+    ASSERT_THAT(this->m_loffli.popBatch(&indices[0], CAPACITY), Eq(CAPACITY));
+    for (const auto index : indices)
+    {
+        EXPECT_THAT(this->m_loffli.push(index), Eq(true));
+        EXPECT_THAT(this->m_loffli.push(index), Eq(false));
+    }
+}
+
 TEST_F(MpmcLoFFLi_test, SinglePush)
 {
     ::testing::Test::RecordProperty("TEST_ID", "0b7bf346-056b-4b1c-a6e9-92b54233598e");
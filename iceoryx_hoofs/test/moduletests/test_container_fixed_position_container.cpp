@@ -20,6 +20,7 @@
 #include "iceoryx_hoofs/error_handling/error_handling.hpp"
 #include "iceoryx_hoofs/testing/fatal_failure.hpp"
 #include "iceoryx_hoofs/testing/lifetime_and_assignment_tracker.hpp"
+#include "iox/attributes.hpp"
 
 #include "test.hpp"
 
@@ -2632,6 +2633,81 @@ TEST_F(FixedPositionContainer_test, IterFromIndexWithValidIndexReturnsIteratorTo
 // END test iter_from_index
 
 
+// BEGIN test iter_from_ptr
+
+TEST_F(FixedPositionContainer_test, IterFromPtrWithPointerToUsedSlotReturnsIteratorToTheElement)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "66a0b4c2-efd0-4b22-ae63-2af2e16e7f74");
+
+    fillSut();
+
+    auto* ptr = sut.iter_from_index(Sut::Index::LAST / 2U).to_ptr();
+    const auto& const_sut = sut;
+
+    EXPECT_THAT(sut.iter_from_ptr(ptr).to_index(), Eq(Sut::Index::LAST / 2U));
+    EXPECT_THAT(const_sut.iter_from_ptr(ptr).to_index(), Eq(Sut::Index::LAST / 2U));
+}
+
+TEST_F(FixedPositionContainer_test, IterFromPtrWithPointerToEmptySlotReturnsEndIterator)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f0642aa6-9096-4f0f-83cc-ccb294da847f");
+
+    fillSut();
+
+    auto* ptr = sut.iter_from_index(Sut::Index::LAST / 2U).to_ptr();
+    sut.erase(ptr);
+    const auto& const_sut = sut;
+
+    EXPECT_THAT(sut.iter_from_ptr(ptr), Eq(sut.end()));
+    EXPECT_THAT(const_sut.iter_from_ptr(ptr), Eq(const_sut.end()));
+}
+
+TEST_F(FixedPositionContainer_test, IterFromPtrWithNullptrCallsErrorHandler)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b455a79e-709a-4e73-923d-10cf194884d9");
+
+    fillSut();
+
+    IOX_EXPECT_FATAL_FAILURE<iox::HoofsError>([&] { IOX_DISCARD_RESULT(sut.iter_from_ptr(nullptr)); },
+                                              iox::HoofsError::EXPECTS_ENSURES_FAILED);
+}
+
+TEST_F(FixedPositionContainer_test, IterFromPtrWithPointerPointingOutOfContainerCallsErrorHandler)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "22123134-7a17-4030-ada2-594cb2705873");
+
+    fillSut();
+
+    auto* ptr_first = sut.begin().to_ptr();
+
+    // NOLINTJUSTIFICATION required for test
+    // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    IOX_EXPECT_FATAL_FAILURE<iox::HoofsError>([&] { IOX_DISCARD_RESULT(sut.iter_from_ptr(ptr_first - 1U)); },
+                                              iox::HoofsError::EXPECTS_ENSURES_FAILED);
+
+    IOX_EXPECT_FATAL_FAILURE<iox::HoofsError>([&] { IOX_DISCARD_RESULT(sut.iter_from_ptr(ptr_first + CAPACITY)); },
+                                              iox::HoofsError::EXPECTS_ENSURES_FAILED);
+    // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+}
+
+TEST_F(FixedPositionContainer_test, IterFromPtrWithUnalignedPointerCallsErrorHandler)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "72366825-bf43-479c-be8d-e0ea7dff579a");
+
+    fillSut();
+
+    auto* ptr_first = sut.begin().to_ptr();
+    // NOLINTJUSTIFICATION required for test
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast, performance-no-int-to-ptr)
+    auto* ptr_unaligned = reinterpret_cast<DataType*>(reinterpret_cast<uintptr_t>(ptr_first) + 1U);
+
+    IOX_EXPECT_FATAL_FAILURE<iox::HoofsError>([&] { IOX_DISCARD_RESULT(sut.iter_from_ptr(ptr_unaligned)); },
+                                              iox::HoofsError::EXPECTS_ENSURES_FAILED);
+}
+
+// END test iter_from_ptr
+
+
 // BEGIN test iterator
 
 TEST_F(FixedPositionContainer_test, NewlyCreatedContainerHasEndIteratorPointingToEnd)
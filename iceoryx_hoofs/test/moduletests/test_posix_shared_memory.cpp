@@ -264,4 +264,42 @@ TEST_F(PosixSharedMemory_Test, OpenFailsWhenCreatingShmInReadOnlyMode)
 }
 
 
+TEST_F(PosixSharedMemory_Test, CreateInDirectoryCreatesAndRemovesFileInDirectory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bed9ac09-6d3f-4b96-ba3f-ab59afd4643b");
+    const PosixSharedMemory::Directory_t directory{"/tmp"};
+    const std::string filePath = std::string(directory.c_str()) + "/" + SUT_SHM_NAME;
+    {
+        auto sut = PosixSharedMemoryBuilder()
+                       .name(SUT_SHM_NAME)
+                       .accessMode(iox::AccessMode::READ_WRITE)
+                       .openMode(iox::OpenMode::PURGE_AND_CREATE)
+                       .filePermissions(perms::owner_all)
+                       .size(128)
+                       .directory(directory)
+                       .create();
+        ASSERT_FALSE(sut.has_error());
+        EXPECT_TRUE(sut->hasOwnership());
+        EXPECT_THAT(iox_access(filePath.c_str(), F_OK), Eq(0));
+        EXPECT_FALSE(cleanupSharedMemory(SUT_SHM_NAME));
+    }
+    EXPECT_THAT(iox_access(filePath.c_str(), F_OK), Eq(-1));
+}
+
+TEST_F(PosixSharedMemory_Test, CreateWithInvalidDirectoryFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "63c1d356-661c-491d-88c4-da47c5180ae3");
+    auto sut = PosixSharedMemoryBuilder()
+                   .name(SUT_SHM_NAME)
+                   .accessMode(iox::AccessMode::READ_WRITE)
+                   .openMode(iox::OpenMode::PURGE_AND_CREATE)
+                   .filePermissions(perms::owner_all)
+                   .size(128)
+                   .directory(PosixSharedMemory::Directory_t{""})
+                   .create();
+
+    ASSERT_TRUE(sut.has_error());
+    EXPECT_THAT(sut.error(), Eq(PosixSharedMemoryError::INVALID_DIRECTORY));
+}
+
 } // namespace
@@ -15,12 +15,16 @@
 //
 // SPDX-License-Identifier: Apache-2.0
 
+#include "iceoryx_platform/resource.hpp"
+#include "iox/detail/system_configuration.hpp"
 #include "iox/memory.hpp"
 #include "iox/posix_group.hpp"
 #include "iox/posix_shared_memory_object.hpp"
 #include "iox/posix_user.hpp"
 #include "test.hpp"
 
+#include <string>
+
 namespace
 {
 using namespace testing;
@@ -237,4 +241,149 @@ TEST_F(SharedMemoryObject_Test, SettingPermissionsWorks)
 #endif
 
 
+class SharedMemoryObject_ZeroingThreadCount : public ::testing::TestWithParam<uint32_t>
+{
+};
+
+INSTANTIATE_TEST_SUITE_P(SharedMemoryObject_Test,
+                         SharedMemoryObject_ZeroingThreadCount,
+                         ::testing::Values(0U,
+                                           1U,
+                                           7U,
+                                           iox::MAX_SHM_SEGMENT_ZEROING_THREAD_COUNT,
+                                           iox::MAX_SHM_SEGMENT_ZEROING_THREAD_COUNT + 1U));
+
+TEST_P(SharedMemoryObject_ZeroingThreadCount, CreateProvidesZeroedMemoryOfArbitrarySize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "13b4800a-9733-4b1d-8cd5-821930b183f0");
+    const uint32_t zeroingThreadCount = GetParam();
+    SCOPED_TRACE(std::string("zeroingThreadCount = ") + std::to_string(zeroingThreadCount));
+
+    const uint64_t MEMORY_SIZE = 100U * iox::detail::pageSize() + 123U;
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmZeroing")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::AccessMode::READ_WRITE)
+                   .openMode(iox::OpenMode::PURGE_AND_CREATE)
+                   .permissions(perms::owner_all)
+                   .zeroingThreadCount(zeroingThreadCount)
+                   .create()
+                   .expect("failed to create sut");
+
+    auto* data_ptr = static_cast<uint8_t*>(sut.getBaseAddress());
+    uint64_t numberOfNonZeroBytes = 0U;
+    for (uint64_t i = 0; i < MEMORY_SIZE; ++i)
+    {
+        /// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        numberOfNonZeroBytes += (data_ptr[i] == 0U) ? 0U : 1U;
+    }
+
+    EXPECT_THAT(numberOfNonZeroBytes, Eq(0U));
+}
+
+TEST_F(SharedMemoryObject_Test, CreateWithNumaBindPolicyProvidesZeroedMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2bf3b2e3-3e3b-4a77-b511-5f45b1046cf8");
+    const uint64_t MEMORY_SIZE = 10U * iox::detail::pageSize() + 123U;
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmNuma")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::AccessMode::READ_WRITE)
+                   .openMode(iox::OpenMode::PURGE_AND_CREATE)
+                   .permissions(perms::owner_all)
+                   .numaPolicy(iox::NumaMemoryPolicy::BIND)
+                   .numaNodeMask(1U)
+                   .create()
+                   .expect("failed to create sut");
+
+    auto* data_ptr = static_cast<uint8_t*>(sut.getBaseAddress());
+    uint64_t numberOfNonZeroBytes = 0U;
+    for (uint64_t i = 0; i < MEMORY_SIZE; ++i)
+    {
+        /// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        numberOfNonZeroBytes += (data_ptr[i] == 0U) ? 0U : 1U;
+    }
+
+    EXPECT_THAT(numberOfNonZeroBytes, Eq(0U));
+}
+
+TEST_F(SharedMemoryObject_Test, CreateWithNumaPolicyForNonExistingNodeFallsBackToDefaultPolicy)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3ed0c7d0-46cc-448d-9f56-4e0f501f3434");
+    // the node does not exist, therefore a warning is logged and the default policy is used
+    const uint64_t MEMORY_SIZE = 10U * iox::detail::pageSize() + 123U;
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmNuma")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::AccessMode::READ_WRITE)
+                   .openMode(iox::OpenMode::PURGE_AND_CREATE)
+                   .permissions(perms::owner_all)
+                   .numaPolicy(iox::NumaMemoryPolicy::INTERLEAVE)
+                   .numaNodeMask(1ULL << 63U)
+                   .create()
+                   .expect("failed to create sut");
+
+    auto* data_ptr = static_cast<uint8_t*>(sut.getBaseAddress());
+    uint64_t numberOfNonZeroBytes = 0U;
+    for (uint64_t i = 0; i < MEMORY_SIZE; ++i)
+    {
+        /// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        numberOfNonZeroBytes += (data_ptr[i] == 0U) ? 0U : 1U;
+    }
+
+    EXPECT_THAT(numberOfNonZeroBytes, Eq(0U));
+}
+
+#if !defined(_WIN32)
+TEST_F(SharedMemoryObject_Test, CreateWithLockInMemoryWorksWhenTheMemlockLimitIsSufficient)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "29e4a1ef-6dfa-401c-b7e5-9e3ff097e062");
+    const uint64_t MEMORY_SIZE = iox::detail::pageSize();
+    struct rlimit limit = {};
+    ASSERT_THAT(getrlimit(RLIMIT_MEMLOCK, &limit), Eq(0));
+    if (limit.rlim_cur != RLIM_INFINITY && limit.rlim_cur < 2U * MEMORY_SIZE)
+    {
+        GTEST_SKIP() << "The RLIMIT_MEMLOCK of the process is too low to lock memory";
+    }
+
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmLocked")
+                   .memorySizeInBytes(MEMORY_SIZE)
+                   .accessMode(iox::AccessMode::READ_WRITE)
+                   .openMode(iox::OpenMode::PURGE_AND_CREATE)
+                   .permissions(perms::owner_all)
+                   .lockInMemory(true)
+                   .create();
+
+    ASSERT_FALSE(sut.has_error());
+    EXPECT_THAT(*static_cast<uint8_t*>(sut->getBaseAddress()), Eq(0U));
+}
+
+TEST_F(SharedMemoryObject_Test, CreateWithLockInMemoryFailsWhenTheMemlockLimitIsTooLow)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "65af8404-04fb-4660-b475-73b0bd1a0c28");
+    struct rlimit originalLimit = {};
+    ASSERT_THAT(getrlimit(RLIMIT_MEMLOCK, &originalLimit), Eq(0));
+    struct rlimit zeroLimit = originalLimit;
+    zeroLimit.rlim_cur = 0U;
+    ASSERT_THAT(setrlimit(RLIMIT_MEMLOCK, &zeroLimit), Eq(0));
+
+    auto sut = PosixSharedMemoryObjectBuilder()
+                   .name("shmLocked")
+                   .memorySizeInBytes(iox::detail::pageSize())
+                   .accessMode(iox::AccessMode::READ_WRITE)
+                   .openMode(iox::OpenMode::PURGE_AND_CREATE)
+                   .permissions(perms::owner_all)
+                   .lockInMemory(true)
+                   .create();
+
+    ASSERT_THAT(setrlimit(RLIMIT_MEMLOCK, &originalLimit), Eq(0));
+    if (!sut.has_error())
+    {
+        GTEST_SKIP() << "The process is privileged to lock memory regardless of its RLIMIT_MEMLOCK";
+    }
+    EXPECT_THAT(sut.error(), Eq(PosixSharedMemoryObjectError::LOCKING_MEMORY_FAILED));
+}
+#endif
+
 } // namespace
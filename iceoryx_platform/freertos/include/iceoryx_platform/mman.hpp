@@ -19,6 +19,9 @@
 #ifndef IOX_HOOFS_FREERTOS_PLATFORM_MMAN_HPP
 #define IOX_HOOFS_FREERTOS_PLATFORM_MMAN_HPP
 
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
 #include <sys/types.h>
 
 #define MAP_SHARED 0x01
@@ -36,4 +39,29 @@ int iox_shm_close(int fd);
 void* mmap(void* addr, size_t length, int prot, int flags, int fd, off_t offset);
 int munmap(void* addr, size_t length);
 
+/// @brief NUMA memory policies for iox_mbind; the values are identical to the Linux MPOL_BIND and MPOL_INTERLEAVE
+#define IOX_MPOL_BIND 2
+#define IOX_MPOL_INTERLEAVE 3
+
+/// @brief NUMA memory policies are only available on Linux; always fails with ENOSYS
+inline int iox_mbind(void*, size_t, int, uint64_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+/// @brief locking memory is not supported on this platform; always fails with ENOSYS
+inline int iox_mlock(const void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+/// @brief locking memory is not supported on this platform; always fails with ENOSYS
+inline int iox_get_mlock_limit(uint64_t*)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
 #endif // IOX_HOOFS_FREERTOS_PLATFORM_MMAN_HPP
@@ -21,6 +21,8 @@
 
 #include "iceoryx_platform/fcntl.hpp"
 
+#include <cerrno>
+
 struct iox_stat
 {
     int st_uid;
@@ -33,4 +35,11 @@ using iox_mode_t = int;
 int iox_fstat(int fildes, iox_stat* buf);
 int iox_fchmod(int, iox_mode_t);
 
+/// @brief hugetlbfs is only available on Linux; always fails with ENOSYS
+inline int iox_hugetlbfs_page_size(const char*, unsigned long long*)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
 #endif // IOX_HOOFS_FREERTOS_PLATFORM_STAT_HPP
@@ -17,10 +17,32 @@
 #ifndef IOX_HOOFS_LINUX_PLATFORM_MMAN_HPP
 #define IOX_HOOFS_LINUX_PLATFORM_MMAN_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <sys/mman.h>
 
 int iox_shm_open(const char* name, int oflag, mode_t mode);
 int iox_shm_unlink(const char* name);
 int iox_shm_close(int fd);
 
+/// @brief NUMA memory policies for iox_mbind; the values are identical to the Linux MPOL_BIND and MPOL_INTERLEAVE
+#define IOX_MPOL_BIND 2
+#define IOX_MPOL_INTERLEAVE 3
+
+/// @brief applies a NUMA memory policy to the pages of the memory range (Linux mbind); must be called before the
+///        pages are faulted in since pages which are already allocated are not moved
+/// @param[in] nodeMask has one bit per NUMA node, e.g. 0b101 for the nodes 0 and 2
+/// @return 0 on success or -1 with errno set, e.g. to ENOSYS when the kernel was built without NUMA support
+int iox_mbind(void* addr, size_t length, int mode, uint64_t nodeMask);
+
+/// @brief locks the pages of the memory range in RAM (POSIX mlock) so that they are neither swapped out nor
+///        reclaimed; this also faults in all pages of the range
+/// @return 0 on success or -1 with errno set, e.g. to ENOMEM or EPERM when the RLIMIT_MEMLOCK of the process is
+///         too low
+int iox_mlock(const void* addr, size_t length);
+
+/// @brief acquires the number of bytes the process may lock in RAM (RLIMIT_MEMLOCK); UINT64_MAX if unlimited
+/// @return 0 on success or -1 with errno set
+int iox_get_mlock_limit(uint64_t* limitInBytes);
+
 #endif // IOX_HOOFS_LINUX_PLATFORM_MMAN_HPP
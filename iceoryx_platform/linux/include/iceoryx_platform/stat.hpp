@@ -32,4 +32,10 @@ inline int iox_fchmod(int fildes, iox_mode_t mode)
     return fchmod(fildes, mode);
 }
 
+/// @brief determines the size of the huge pages of the hugetlbfs which contains the path
+/// @param[in] path the path to a file or directory
+/// @param[out] pageSize the huge page size in bytes or 0 if the path is not on a hugetlbfs
+/// @return 0 on success, -1 on failure with errno set by statfs
+int iox_hugetlbfs_page_size(const char* path, unsigned long long* pageSize);
+
 #endif // IOX_HOOFS_LINUX_PLATFORM_STAT_HPP
@@ -17,6 +17,34 @@
 #ifndef IOX_HOOFS_LINUX_PLATFORM_WAIT_HPP
 #define IOX_HOOFS_LINUX_PLATFORM_WAIT_HPP
 
+#include <sys/types.h>
 #include <sys/wait.h>
 
+/// @brief opens a file descriptor which refers to the process with the given pid (Linux pidfd, since kernel 5.3)
+/// @return the file descriptor or -1 with errno set, e.g. to ENOSYS when the kernel does not support pidfds
+int iox_pidfd_open(pid_t pid);
+
+/// @brief checks without blocking whether the process which is referred to by the pidfd has terminated
+/// @return 1 if the process has terminated, 0 if it is still running and -1 with errno set on error
+int iox_pidfd_is_terminated(int pidfd);
+
+/// @brief creates a watcher which waits for the termination of multiple processes referred to by pidfds
+/// @return the file descriptor of the watcher or -1 with errno set
+int iox_pidfd_watcher_create();
+
+/// @brief adds a pidfd to the watcher; the pidfd is removed automatically when it is closed and a termination is
+/// reported only once per pidfd
+/// @return 0 on success and -1 with errno set on error
+int iox_pidfd_watcher_add(int watcherFd, int pidfd);
+
+/// @brief waits until at least one of the processes which were added to the watcher has terminated
+/// @param[in] timeoutInMs maximum time to wait, -1 waits without timeout
+/// @return the number of terminated processes, 0 on timeout and -1 with errno set on error
+int iox_pidfd_watcher_wait(int watcherFd, int timeoutInMs);
+
+/// @brief returns an id of the PID namespace of the calling process; processes in the same PID namespace have the
+/// same id and can therefore exchange pids
+/// @return the id which combines the device and the inode number of the namespace or 0 if it cannot be determined
+unsigned long long iox_pid_namespace_id();
+
 #endif // IOX_HOOFS_LINUX_PLATFORM_WAIT_HPP
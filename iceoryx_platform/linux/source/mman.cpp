@@ -15,7 +15,10 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_platform/mman.hpp"
+#include "iceoryx_platform/resource.hpp"
 
+#include <cerrno>
+#include <sys/syscall.h>
 #include <unistd.h>
 
 // NOLINTNEXTLINE(readability-identifier-naming)
@@ -34,3 +37,35 @@ int iox_shm_close(int fd)
 {
     return close(fd);
 }
+
+int iox_mbind(void* addr, size_t length, int mode, uint64_t nodeMask)
+{
+#ifdef SYS_mbind
+    // the kernel reads one bit less than maxnode, therefore the number of bits of the mask plus one is passed
+    constexpr uint64_t MAX_NODE{sizeof(nodeMask) * 8U + 1U};
+    return static_cast<int>(syscall(SYS_mbind, addr, length, mode, &nodeMask, MAX_NODE, 0U));
+#else
+    static_cast<void>(addr);
+    static_cast<void>(length);
+    static_cast<void>(mode);
+    static_cast<void>(nodeMask);
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+int iox_mlock(const void* addr, size_t length)
+{
+    return mlock(addr, length);
+}
+
+int iox_get_mlock_limit(uint64_t* limitInBytes)
+{
+    struct rlimit limit = {};
+    if (getrlimit(RLIMIT_MEMLOCK, &limit) != 0)
+    {
+        return -1;
+    }
+    *limitInBytes = (limit.rlim_cur == RLIM_INFINITY) ? UINT64_MAX : limit.rlim_cur;
+    return 0;
+}
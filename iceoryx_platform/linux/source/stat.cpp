@@ -0,0 +1,38 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_platform/stat.hpp"
+
+#include <linux/magic.h>
+#include <sys/vfs.h>
+
+// NOLINTNEXTLINE(readability-identifier-naming)
+int iox_hugetlbfs_page_size(const char* path, unsigned long long* pageSize)
+{
+    struct statfs fileSystem
+    {
+    };
+    if (statfs(path, &fileSystem) != 0)
+    {
+        return -1;
+    }
+
+    // the block size of a hugetlbfs is the size of its huge pages
+    *pageSize = (static_cast<unsigned long>(fileSystem.f_type) == HUGETLBFS_MAGIC)
+                    ? static_cast<unsigned long long>(fileSystem.f_bsize)
+                    : 0U;
+    return 0;
+}
@@ -0,0 +1,94 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_platform/wait.hpp"
+
+#include <cerrno>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+int iox_pidfd_open(pid_t pid)
+{
+#ifdef SYS_pidfd_open
+    return static_cast<int>(syscall(SYS_pidfd_open, pid, 0));
+#else
+    static_cast<void>(pid);
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+int iox_pidfd_is_terminated(int pidfd)
+{
+    // a pidfd becomes readable when the process it refers to has terminated
+    struct pollfd pollFd = {};
+    pollFd.fd = pidfd;
+    pollFd.events = POLLIN;
+    int result = poll(&pollFd, 1, 0);
+    if (result < 0)
+    {
+        return -1;
+    }
+    if ((pollFd.revents & POLLNVAL) != 0)
+    {
+        errno = EBADF;
+        return -1;
+    }
+    return (result > 0 && (pollFd.revents & (POLLIN | POLLHUP)) != 0) ? 1 : 0;
+}
+
+int iox_pidfd_watcher_create()
+{
+    return epoll_create1(EPOLL_CLOEXEC);
+}
+
+int iox_pidfd_watcher_add(int watcherFd, int pidfd)
+{
+    // the pidfd stays readable after the process has terminated; one shot prevents reporting it until it is closed
+    struct epoll_event event = {};
+    event.events = EPOLLIN | EPOLLONESHOT;
+    event.data.fd = pidfd;
+    return epoll_ctl(watcherFd, EPOLL_CTL_ADD, pidfd, &event);
+}
+
+int iox_pidfd_watcher_wait(int watcherFd, int timeoutInMs)
+{
+    constexpr int MAX_EVENTS = 16;
+    struct epoll_event events[MAX_EVENTS];
+    int result = epoll_wait(watcherFd, &events[0], MAX_EVENTS, timeoutInMs);
+    if (result < 0 && errno == EINTR)
+    {
+        return 0;
+    }
+    return result;
+}
+
+unsigned long long iox_pid_namespace_id()
+{
+    struct stat namespaceInfo = {};
+    if (stat("/proc/self/ns/pid", &namespaceInfo) != 0)
+    {
+        return 0U;
+    }
+    // a namespace is only identified by the device and the inode number of its nsfs file; the inode numbers of
+    // namespaces have 32 bits, therefore the device is placed in the upper bits
+    constexpr unsigned long long DEVICE_SHIFT{32U};
+    return (static_cast<unsigned long long>(namespaceInfo.st_dev) << DEVICE_SHIFT)
+           ^ static_cast<unsigned long long>(namespaceInfo.st_ino);
+}
@@ -17,6 +17,7 @@
 #ifndef IOX_HOOFS_QNX_PLATFORM_STAT_HPP
 #define IOX_HOOFS_QNX_PLATFORM_STAT_HPP
 
+#include <cerrno>
 #include <sys/stat.h>
 
 using iox_stat = struct stat;
@@ -32,4 +33,11 @@ inline int iox_fchmod(int fildes, iox_mode_t mode)
     return fchmod(fildes, mode);
 }
 
+/// @brief hugetlbfs is only available on Linux; always fails with ENOSYS
+inline int iox_hugetlbfs_page_size(const char*, unsigned long long*)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
 #endif // IOX_HOOFS_QNX_PLATFORM_STAT_HPP
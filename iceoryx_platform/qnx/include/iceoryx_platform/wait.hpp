@@ -17,6 +17,48 @@
 #ifndef IOX_HOOFS_QNX_PLATFORM_WAIT_HPP
 #define IOX_HOOFS_QNX_PLATFORM_WAIT_HPP
 
+#include <cerrno>
 #include <sys/wait.h>
 
+/// @brief pidfds are only available on Linux; always fails with ENOSYS
+inline int iox_pidfd_open(pid_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+/// @brief pidfds are only available on Linux; always fails with ENOSYS
+inline int iox_pidfd_is_terminated(int)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+/// @brief pidfds are only available on Linux; always fails with ENOSYS
+inline int iox_pidfd_watcher_create()
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+/// @brief pidfds are only available on Linux; always fails with ENOSYS
+inline int iox_pidfd_watcher_add(int, int)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+/// @brief pidfds are only available on Linux; always fails with ENOSYS
+inline int iox_pidfd_watcher_wait(int, int)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+/// @brief PID namespaces are only available on Linux; always returns 0
+inline unsigned long long iox_pid_namespace_id()
+{
+    return 0U;
+}
+
 #endif // IOX_HOOFS_QNX_PLATFORM_WAIT_HPP
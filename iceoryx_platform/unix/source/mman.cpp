@@ -15,6 +15,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_platform/mman.hpp"
+#include "iceoryx_platform/resource.hpp"
 
 #include <unistd.h>
 
@@ -34,3 +35,19 @@ int iox_shm_close(int fd)
 {
     return close(fd);
 }
+
+int iox_mlock(const void* addr, size_t length)
+{
+    return mlock(addr, length);
+}
+
+int iox_get_mlock_limit(uint64_t* limitInBytes)
+{
+    struct rlimit limit = {};
+    if (getrlimit(RLIMIT_MEMLOCK, &limit) != 0)
+    {
+        return -1;
+    }
+    *limitInBytes = (limit.rlim_cur == RLIM_INFINITY) ? UINT64_MAX : limit.rlim_cur;
+    return 0;
+}
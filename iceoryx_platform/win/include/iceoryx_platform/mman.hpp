@@ -22,6 +22,8 @@
 #include "iceoryx_platform/unistd.hpp"
 #include "iceoryx_platform/win32_errorHandling.hpp"
 
+#include <cerrno>
+#include <cstdint>
 #include <cstdio>
 #include <string>
 #include <sys/stat.h>
@@ -51,4 +53,29 @@ int iox_shm_close(int fd);
 void internal_iox_shm_set_size(int fd, off_t length);
 
 off_t internal_iox_shm_get_size(int fd);
+
+/// @brief NUMA memory policies for iox_mbind; the values are identical to the Linux MPOL_BIND and MPOL_INTERLEAVE
+#define IOX_MPOL_BIND 2
+#define IOX_MPOL_INTERLEAVE 3
+
+/// @brief NUMA memory policies are only available on Linux; always fails with ENOSYS
+inline int iox_mbind(void*, size_t, int, uint64_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+/// @brief locking memory is not supported on this platform; always fails with ENOSYS
+inline int iox_mlock(const void*, size_t)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
+/// @brief locking memory is not supported on this platform; always fails with ENOSYS
+inline int iox_get_mlock_limit(uint64_t*)
+{
+    errno = ENOSYS;
+    return -1;
+}
 #endif // IOX_HOOFS_WIN_PLATFORM_MMAN_HPP
@@ -59,6 +59,20 @@ inline struct passwd* getpwuid(uid_t uid)
     return &dummy;
 }
 
+inline int getpwnam_r(const char* name, struct passwd* pwd, char*, size_t, struct passwd** result)
+{
+    *pwd = *getpwnam(name);
+    *result = pwd;
+    return 0;
+}
+
+inline int getpwuid_r(uid_t uid, struct passwd* pwd, char*, size_t, struct passwd** result)
+{
+    *pwd = *getpwuid(uid);
+    *result = pwd;
+    return 0;
+}
+
 inline uid_t geteuid()
 {
     return 0;
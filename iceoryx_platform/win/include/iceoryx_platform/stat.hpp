@@ -17,6 +17,7 @@
 #ifndef IOX_HOOFS_WIN_PLATFORM_STAT_HPP
 #define IOX_HOOFS_WIN_PLATFORM_STAT_HPP
 
+#include <cerrno>
 #include <io.h>
 #include <limits>
 #include <sys/stat.h>
@@ -42,4 +43,11 @@ using iox_mode_t = int;
 int iox_fstat(int fildes, iox_stat* buf);
 int iox_fchmod(int fildes, iox_mode_t mode);
 
+/// @brief hugetlbfs is only available on Linux; always fails with ENOSYS
+inline int iox_hugetlbfs_page_size(const char*, unsigned long long*)
+{
+    errno = ENOSYS;
+    return -1;
+}
+
 #endif // IOX_HOOFS_WIN_PLATFORM_STAT_HPP
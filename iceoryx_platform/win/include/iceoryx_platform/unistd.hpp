@@ -27,6 +27,7 @@
 
 #define IOX_SEEK_SET SEEK_SET
 #define _SC_PAGESIZE 1
+#define _SC_GETPW_R_SIZE_MAX 2
 #ifndef STDOUT_FILENO
 #define STDOUT_FILENO 1
 #endif
@@ -44,6 +44,11 @@ long sysconf(int name)
         GetSystemInfo(&systemInfo);
         return systemInfo.dwPageSize;
     }
+    if (name == _SC_GETPW_R_SIZE_MAX)
+    {
+        // the passwd entries are not backed by a buffer on windows, the size is therefore indeterminate
+        return -1;
+    }
     return 0;
 }
 
@@ -61,6 +61,15 @@ constexpr uint32_t MAX_SUBSCRIBERS_PER_PUBLISHER = build::IOX_MAX_SUBSCRIBERS_PE
 constexpr uint32_t MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY =
     build::IOX_MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY;
 constexpr uint64_t MAX_PUBLISHER_HISTORY = build::IOX_MAX_PUBLISHER_HISTORY;
+/// @brief Upper limit of the number of chunks a publisher reserves in advance with a single mempool access
+constexpr uint32_t MAX_CHUNK_MAGAZINE_CAPACITY = 16U;
+/// @brief A producer blocked by a full queue is woken up by the consumer; the wait slice only bounds the wait in case
+/// the consumer was terminated before it could wake up the producer
+constexpr units::Duration BLOCKED_PRODUCER_WAIT_SLICE = units::Duration::fromMilliseconds(100U);
+/// @brief A delivery holds the queue snapshot of a publisher only for one pass over the queues or one wait slice of a
+/// blocked producer. If the snapshot is not released within this timeout, adding or removing a queue fails and has to
+/// be retried later; the snapshot is never reclaimed from a delivering process which is alive
+constexpr units::Duration QUEUE_SNAPSHOT_RELEASE_TIMEOUT = 2 * BLOCKED_PRODUCER_WAIT_SLICE;
 // Subscriber
 constexpr uint32_t MAX_SUBSCRIBERS = build::IOX_MAX_SUBSCRIBERS;
 constexpr uint32_t MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY =
@@ -71,7 +80,7 @@ constexpr uint32_t MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBE
 // 1x publisherPort process introspection
 // 3x publisherPort port introspection
 constexpr uint32_t PUBLISHERS_RESERVED_FOR_INTROSPECTION = 5;
-constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 1;
+constexpr uint32_t PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY = 2;
 constexpr uint32_t NUMBER_OF_INTERNAL_PUBLISHERS =
     PUBLISHERS_RESERVED_FOR_INTROSPECTION + PUBLISHERS_RESERVED_FOR_SERVICE_REGISTRY;
 /// With MAX_SUBSCRIBER_QUEUE_CAPACITY = MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY we couple the maximum number of
@@ -112,6 +121,11 @@ constexpr uint32_t MAX_NUMBER_OF_EVENTS_PER_LISTENER = MAX_NUMBER_OF_NOTIFIERS;
 // Memory
 constexpr uint32_t MAX_NUMBER_OF_MEMPOOLS = build::IOX_MAX_NUMBER_OF_MEMPOOLS;
 constexpr uint32_t MAX_SHM_SEGMENTS = build::IOX_MAX_SHM_SEGMENTS;
+/// @brief number of threads which zero and thereby prefault the memory of a newly created shared memory segment
+constexpr uint32_t SHM_SEGMENT_DEFAULT_ZEROING_THREAD_COUNT{1U};
+/// @brief maximum number of zeroing threads of a segment; must not exceed the MAX_SHM_SEGMENT_ZEROING_THREAD_COUNT of
+/// the shared memory object which would silently reduce it
+constexpr uint32_t SHM_SEGMENT_MAX_ZEROING_THREAD_COUNT{64U};
 
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_PROVIDER = 8U;
 constexpr uint32_t MAX_NUMBER_OF_MEMORY_BLOCKS_PER_MEMORY_PROVIDER = 64U;
@@ -137,6 +151,7 @@ constexpr uint32_t MAX_FINDSERVICE_RESULT_SIZE = SERVICE_REGISTRY_CAPACITY;
 constexpr const char SERVICE_DISCOVERY_SERVICE_NAME[] = "ServiceDiscovery";
 constexpr const char SERVICE_DISCOVERY_INSTANCE_NAME[] = "RouDi_ID";
 constexpr const char SERVICE_DISCOVERY_EVENT_NAME[] = "ServiceRegistry";
+constexpr const char SERVICE_DISCOVERY_DELTA_EVENT_NAME[] = "ServiceRegistryDelta";
 
 // Nodes
 constexpr uint32_t MAX_NODE_NUMBER = build::IOX_MAX_NODE_NUMBER;
@@ -230,6 +245,20 @@ constexpr units::Duration PROCESS_DEFAULT_KILL_DELAY = 45_s;
 constexpr units::Duration PROCESS_TERMINATED_CHECK_INTERVAL = 250_ms;
 constexpr units::Duration DISCOVERY_INTERVAL = 100_ms;
 
+/// @brief Number of threads which receive and process the messages from the runtimes; all requests take the
+/// ProcessManager lock exclusively, additional threads only overlap the receiving, the parsing, the user lookup and the
+/// opening of the IPC channels
+constexpr uint32_t RUNTIME_MESSAGES_DEFAULT_THREAD_COUNT{1U};
+constexpr uint32_t MAX_RUNTIME_MESSAGES_THREAD_COUNT{16U};
+
+/// @brief Notification indices of the condition variable which wakes up the discovery loop; the discovery interval
+/// is only the fallback when no notification arrives
+constexpr uint64_t DISCOVERY_LOOP_TRIGGER_NOTIFICATION_INDEX{0U};
+constexpr uint64_t DISCOVERY_PORT_STATE_CHANGE_NOTIFICATION_INDEX{1U};
+constexpr uint64_t DISCOVERY_PROCESS_TERMINATION_NOTIFICATION_INDEX{2U};
+/// @brief Maximum time between two snapshots of the service registry if deltas were published in the meantime
+constexpr units::Duration SERVICE_REGISTRY_SNAPSHOT_INTERVAL = 1_s;
+
 /// @brief Controls process alive monitoring. Upon timeout, a monitored process is removed
 /// and its resources are made available. The process can then start and register itself again.
 /// Contrarily, unmonitored processes can be restarted but registration will fail.
@@ -243,6 +272,19 @@ enum class MonitoringMode
 };
 
 iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const MonitoringMode& mode) noexcept;
+
+/// @brief Controls how the termination of a monitored process is detected
+/// HEARTBEAT - a process is removed when its heartbeat is older than runtime::PROCESS_KEEP_ALIVE_TIMEOUT
+/// PIDFD - additionally, each monitored process is watched with a Linux pidfd and removed as soon as it terminated;
+/// the heartbeat stays the fallback for hung processes, for systems without pidfd support and for processes which
+/// are not in the PID namespace of RouDi.
+enum class ProcessExitDetection
+{
+    HEARTBEAT,
+    PIDFD
+};
+
+iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const ProcessExitDetection& detection) noexcept;
 } // namespace roudi
 
 namespace mepoo
@@ -67,6 +67,23 @@ inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const Mon
     }
     return logstream;
 }
+
+inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const ProcessExitDetection& detection) noexcept
+{
+    switch (detection)
+    {
+    case ProcessExitDetection::HEARTBEAT:
+        logstream << "ProcessExitDetection::HEARTBEAT";
+        break;
+    case ProcessExitDetection::PIDFD:
+        logstream << "ProcessExitDetection::PIDFD";
+        break;
+    default:
+        logstream << "ProcessExitDetection::UNDEFINED";
+        break;
+    }
+    return logstream;
+}
 } // namespace roudi
 
 } // namespace iox
@@ -36,10 +36,16 @@ struct ChunkManagement
     using referenceCounterBase_t = uint64_t;
     using referenceCounter_t = std::atomic<referenceCounterBase_t>;
 
+    /// @brief Creates a ChunkManagement which was obtained from a separate chunkManagementPool and is returned to it
+    /// when the chunk is freed
     ChunkManagement(const not_null<base_t*> chunkHeader,
                     const not_null<MemPool*> mempool,
                     const not_null<MemPool*> chunkManagementPool) noexcept;
 
+    /// @brief Creates a ChunkManagement in the fixed slot of the chunk; the slot is not freed separately since it
+    /// belongs to the chunk as long as the chunk is not returned to the mempool
+    ChunkManagement(const not_null<base_t*> chunkHeader, const not_null<MemPool*> mempool) noexcept;
+
     iox::RelativePointer<base_t> m_chunkHeader;
     referenceCounter_t m_referenceCounter{1U};
 
@@ -50,6 +50,7 @@ class MemPool
   public:
     using freeList_t = concurrent::MpmcLoFFLi;
     static constexpr uint64_t CHUNK_MEMORY_ALIGNMENT = 8U; // default alignment for 64 bit
+    static constexpr uint32_t MAX_NUMBER_OF_CHUNKS_PER_BATCH = 16U;
 
     MemPool(const greater_or_equal<uint32_t, CHUNK_MEMORY_ALIGNMENT> chunkSize,
             const greater_or_equal<uint32_t, 1> numberOfChunks,
@@ -62,6 +63,12 @@ class MemPool
     MemPool& operator=(MemPool&&) = delete;
 
     void* getChunk() noexcept;
+
+    /// @brief Obtains multiple chunks with one operation on the free list per MAX_NUMBER_OF_CHUNKS_PER_BATCH chunks
+    /// @param[out] chunks storage for at least numberOfChunks pointers to the obtained chunks
+    /// @param[in] numberOfChunks is the maximum number of chunks to obtain
+    /// @return the number of obtained chunks; 0 if the MemPool has no free chunks
+    uint32_t getChunks(not_null<void**> chunks, const uint32_t numberOfChunks) noexcept;
     uint32_t getChunkSize() const noexcept;
     uint32_t getChunkCount() const noexcept;
     uint32_t getUsedChunks() const noexcept;
@@ -70,6 +77,11 @@ class MemPool
 
     void freeChunk(const void* chunk) noexcept;
 
+    /// @brief Converts a pointer to a chunk of this MemPool to its index
+    /// @param[in] chunk is the pointer to the chunk
+    /// @return the index of the chunk in the range [0, getChunkCount())
+    uint32_t getChunkIndex(const void* const chunk) const noexcept;
+
     /// @brief Converts an index to a chunk in the MemPool to a pointer
     /// @param[in] index of the chunk
     /// @param[in] chunkSize is the size of the chunk
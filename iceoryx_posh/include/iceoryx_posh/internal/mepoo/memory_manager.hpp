@@ -21,10 +21,12 @@
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_settings.hpp"
+#include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/algorithm.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/expected.hpp"
 #include "iox/memory.hpp"
+#include "iox/optional.hpp"
 #include "iox/vector.hpp"
 
 #include <cstdint>
@@ -42,8 +44,6 @@ class LogStream;
 }
 namespace mepoo
 {
-struct MePooConfig;
-
 class MemoryManager
 {
     using MaxChunkPayloadSize_t = range<uint32_t, 1, std::numeric_limits<uint32_t>::max() - sizeof(ChunkHeader)>;
@@ -67,11 +67,29 @@ class MemoryManager
                                 BumpAllocator& managementAllocator,
                                 BumpAllocator& chunkMemoryAllocator) noexcept;
 
-    /// @brief Obtains a chunk from the mempools
+    /// @brief Obtains a chunk from the mempools. The best fitting mempool is looked up in a size class table and, if
+    /// configured with MemPoolAllocationPolicy::FALL_THROUGH_TO_LARGER_MEMPOOL, larger mempools are used when it is
+    /// exhausted
     /// @param[in] chunkSettings for the requested chunk
     /// @return a SharedChunk if successful, otherwise a MemoryManager::Error
     expected<SharedChunk, Error> getChunk(const ChunkSettings& chunkSettings) noexcept;
 
+    /// @brief Obtains multiple chunks from the best fitting mempool with batched operations on the free lists. The
+    /// MemPoolAllocationPolicy is not applied and no error is reported, i.e. if the best fitting mempool is exhausted
+    /// no chunks are obtained
+    /// @param[in] chunkSettings for the requested chunks
+    /// @param[out] chunks storage for at least numberOfChunks SharedChunks
+    /// @param[in] numberOfChunks is the maximum number of chunks to obtain
+    /// @return the number of obtained chunks
+    uint32_t getChunks(const ChunkSettings& chunkSettings,
+                       not_null<SharedChunk*> chunks,
+                       const uint32_t numberOfChunks) noexcept;
+
+    /// @brief Looks up the chunk size of the mempool which is used in the first place for the required chunk size
+    /// @param[in] requiredChunkSize is the size of the chunk including the ChunkHeader
+    /// @return the chunk size of the best fitting mempool or nullopt if there is no mempool with fitting chunks
+    optional<uint32_t> getBestFittingChunkSize(const uint32_t requiredChunkSize) const noexcept;
+
     uint32_t getNumberOfMemPools() const noexcept;
 
     MemPoolInfo getMemPoolInfo(const uint32_t index) const noexcept;
@@ -88,14 +106,35 @@ class MemoryManager
                     BumpAllocator& chunkMemoryAllocator,
                     const greater_or_equal<uint32_t, MemPool::CHUNK_MEMORY_ALIGNMENT> chunkPayloadSize,
                     const greater_or_equal<uint32_t, 1> numberOfChunks) noexcept;
-    void generateChunkManagementPool(BumpAllocator& managementAllocator) noexcept;
+    void generateSizeClassTable() noexcept;
+    uint32_t getBestFittingMemPoolIndex(const uint32_t requiredChunkSize) const noexcept;
+
+    /// @brief Provides the ChunkManagement slot of a chunk. Every mempool has an array with one slot per chunk at the
+    /// index of the chunk, therefore obtaining and freeing a chunk requires only a single free list operation
+    /// @param[in] memPoolIndex is the index of the mempool the chunk belongs to
+    /// @param[in] chunk is the pointer to the chunk
+    /// @return pointer to the ChunkManagement slot of the chunk
+    ChunkManagement* getChunkManagementSlot(const uint32_t memPoolIndex, const void* const chunk) noexcept;
+
+    /// @brief the size class of a chunk size is its bit width, i.e. class c contains the sizes [2^(c-1), 2^c - 1]
+    static uint32_t sizeClass(const uint32_t chunkSize) noexcept;
+
+    /// @brief Counts the leading zero bits of a value which must not be zero
+    static uint32_t countLeadingZeros(const uint32_t value) noexcept;
 
   private:
+    static constexpr uint32_t NUMBER_OF_SIZE_CLASSES{std::numeric_limits<uint32_t>::digits + 1U};
+
     bool m_denyAddMemPool{false};
-    uint32_t m_totalNumberOfChunks{0};
+    MemPoolAllocationPolicy m_allocationPolicy{MemPoolAllocationPolicy::BEST_FIT};
+
+    /// @brief index of the first mempool with chunks which are at least as large as the smallest size of the size
+    /// class; since the mempools are ordered by increasing chunk size, the best fitting mempool is found by a short
+    /// forward scan within the size class
+    uint32_t m_firstMemPoolOfSizeClass[NUMBER_OF_SIZE_CLASSES]{};
 
     vector<MemPool, MAX_NUMBER_OF_MEMPOOLS> m_memPoolVector;
-    vector<MemPool, 1> m_chunkManagementPool;
+    vector<RelativePointer<ChunkManagement>, MAX_NUMBER_OF_MEMPOOLS> m_chunkManagementSlots;
 };
 
 /// @brief Converts the MemoryManager::Error to a string literal
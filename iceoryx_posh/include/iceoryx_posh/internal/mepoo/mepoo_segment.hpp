@@ -21,6 +21,7 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
+#include "iceoryx_posh/mepoo/segment_config.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/detail/posix_acl.hpp"
 #include "iox/filesystem.hpp"
@@ -39,7 +40,13 @@ class MePooSegment
                  BumpAllocator& managementAllocator,
                  const PosixGroup& readerGroup,
                  const PosixGroup& writerGroup,
-                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo()) noexcept;
+                 const iox::mepoo::MemoryInfo& memoryInfo = iox::mepoo::MemoryInfo(),
+                 const uint32_t zeroingThreadCount = SHM_SEGMENT_DEFAULT_ZEROING_THREAD_COUNT,
+                 const HugePageSize hugePageSize = HugePageSize::NONE,
+                 const HugePageMount_t& hugePageMount = HugePageMount_t(),
+                 const NumaMemoryPolicy numaPolicy = NumaMemoryPolicy::DEFAULT,
+                 const uint64_t numaNodeMask = 0U,
+                 const bool lockInMemory = false) noexcept;
 
     PosixGroup getWriterGroup() const noexcept;
     PosixGroup getReaderGroup() const noexcept;
@@ -50,9 +57,22 @@ class MePooSegment
 
     uint64_t getSegmentSize() const noexcept;
 
+    /// @brief returns the directory of the file of the shared memory if the segment is backed by huge pages
+    /// @return the mount point of the hugetlbfs; nullopt if the segment is a POSIX shared memory object
+    const optional<HugePageMount_t>& getSharedMemoryDirectory() const noexcept;
+
+    /// @brief returns true if the pages of the segment are locked in RAM; applications lock them after mapping, too
+    bool isLockedInMemory() const noexcept;
+
   protected:
     SharedMemoryObjectType createSharedMemoryObject(const MePooConfig& mempoolConfig,
-                                                    const PosixGroup& writerGroup) noexcept;
+                                                    const PosixGroup& writerGroup,
+                                                    const uint32_t zeroingThreadCount,
+                                                    const HugePageSize hugePageSize,
+                                                    const HugePageMount_t& hugePageMount,
+                                                    const NumaMemoryPolicy numaPolicy,
+                                                    const uint64_t numaNodeMask,
+                                                    const bool lockInMemory) noexcept;
 
   protected:
     PosixGroup m_readerGroup;
@@ -60,6 +80,8 @@ class MePooSegment
     uint64_t m_segmentId{0};
     uint64_t m_segmentSize{0};
     iox::mepoo::MemoryInfo m_memoryInfo;
+    optional<HugePageMount_t> m_sharedMemoryDirectory;
+    bool m_lockedInMemory{false};
     SharedMemoryObjectType m_sharedMemoryObject;
     MemoryManagerType m_memoryManager;
 
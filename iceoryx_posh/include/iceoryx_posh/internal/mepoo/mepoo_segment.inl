@@ -24,6 +24,7 @@
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/logging.hpp"
+#include "iox/memory.hpp"
 #include "iox/relative_pointer.hpp"
 
 namespace iox
@@ -39,11 +40,25 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
     BumpAllocator& managementAllocator,
     const PosixGroup& readerGroup,
     const PosixGroup& writerGroup,
-    const iox::mepoo::MemoryInfo& memoryInfo) noexcept
+    const iox::mepoo::MemoryInfo& memoryInfo,
+    const uint32_t zeroingThreadCount,
+    const HugePageSize hugePageSize,
+    const HugePageMount_t& hugePageMount,
+    const NumaMemoryPolicy numaPolicy,
+    const uint64_t numaNodeMask,
+    const bool lockInMemory) noexcept
     : m_readerGroup(readerGroup)
     , m_writerGroup(writerGroup)
     , m_memoryInfo(memoryInfo)
-    , m_sharedMemoryObject(createSharedMemoryObject(mempoolConfig, writerGroup))
+    , m_lockedInMemory(lockInMemory)
+    , m_sharedMemoryObject(createSharedMemoryObject(mempoolConfig,
+                                                    writerGroup,
+                                                    zeroingThreadCount,
+                                                    hugePageSize,
+                                                    hugePageMount,
+                                                    numaPolicy,
+                                                    numaNodeMask,
+                                                    lockInMemory))
 {
     using namespace detail;
     PosixAcl acl;
@@ -68,34 +83,85 @@ inline MePooSegment<SharedMemoryObjectType, MemoryManagerType>::MePooSegment(
 
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline SharedMemoryObjectType MePooSegment<SharedMemoryObjectType, MemoryManagerType>::createSharedMemoryObject(
-    const MePooConfig& mempoolConfig, const PosixGroup& writerGroup) noexcept
+    const MePooConfig& mempoolConfig,
+    const PosixGroup& writerGroup,
+    const uint32_t zeroingThreadCount,
+    const HugePageSize hugePageSize,
+    const HugePageMount_t& hugePageMount,
+    const NumaMemoryPolicy numaPolicy,
+    const uint64_t numaNodeMask,
+    const bool lockInMemory) noexcept
 {
-    return std::move(
-        typename SharedMemoryObjectType::Builder()
+    const auto memorySize = MemoryManager::requiredChunkMemorySize(mempoolConfig);
+    auto createSharedMemory = [&](const optional<HugePageMount_t>& directory, const uint64_t sizeInBytes) {
+        return typename SharedMemoryObjectType::Builder()
             .name(writerGroup.getName())
-            .memorySizeInBytes(MemoryManager::requiredChunkMemorySize(mempoolConfig))
+            .memorySizeInBytes(sizeInBytes)
             .accessMode(AccessMode::READ_WRITE)
             .openMode(OpenMode::PURGE_AND_CREATE)
             .permissions(SEGMENT_PERMISSIONS)
-            .create()
-            .and_then([this](auto& sharedMemoryObject) {
-                auto maybeSegmentId = iox::UntypedRelativePointer::registerPtr(
-                    sharedMemoryObject.getBaseAddress(),
-                    sharedMemoryObject.get_size().expect("Failed to get SHM size"));
-                if (!maybeSegmentId.has_value())
-                {
-                    errorHandler(PoshError::MEPOO__SEGMENT_INSUFFICIENT_SEGMENT_IDS);
-                }
-                this->m_segmentId = static_cast<uint64_t>(maybeSegmentId.value());
-                this->m_segmentSize = sharedMemoryObject.get_size().expect("Failed to get SHM size.");
-
-                IOX_LOG(DEBUG,
-                        "Roudi registered payload data segment " << iox::log::hex(sharedMemoryObject.getBaseAddress())
-                                                                 << " with size " << m_segmentSize << " to id "
-                                                                 << m_segmentId);
-            })
-            .or_else([](auto&) { errorHandler(PoshError::MEPOO__SEGMENT_UNABLE_TO_CREATE_SHARED_MEMORY_OBJECT); })
-            .value());
+            .zeroingThreadCount(zeroingThreadCount)
+            .directory(directory)
+            .numaPolicy(numaPolicy)
+            .numaNodeMask(numaNodeMask)
+            .lockInMemory(lockInMemory)
+            .create();
+    };
+
+    auto registerSegment = [this](auto&& maybeSharedMemoryObject) {
+        return std::move(
+            maybeSharedMemoryObject
+                .and_then([this](auto& sharedMemoryObject) {
+                    auto maybeSegmentId = iox::UntypedRelativePointer::registerPtr(
+                        sharedMemoryObject.getBaseAddress(),
+                        sharedMemoryObject.get_size().expect("Failed to get SHM size"));
+                    if (!maybeSegmentId.has_value())
+                    {
+                        errorHandler(PoshError::MEPOO__SEGMENT_INSUFFICIENT_SEGMENT_IDS);
+                    }
+                    this->m_segmentId = static_cast<uint64_t>(maybeSegmentId.value());
+                    this->m_segmentSize = sharedMemoryObject.get_size().expect("Failed to get SHM size.");
+
+                    IOX_LOG(DEBUG,
+                            "Roudi registered payload data segment "
+                                << iox::log::hex(sharedMemoryObject.getBaseAddress()) << " with size " << m_segmentSize
+                                << " to id " << m_segmentId);
+                })
+                .or_else([](auto&) { errorHandler(PoshError::MEPOO__SEGMENT_UNABLE_TO_CREATE_SHARED_MEMORY_OBJECT); })
+                .value());
+    };
+
+    if (hugePageSize != HugePageSize::NONE)
+    {
+        const optional<HugePageMount_t> directory = hugePageMount.empty()
+                                                        ? defaultHugePageMount(hugePageSize)
+                                                        : make_optional<HugePageMount_t>(hugePageMount);
+        // a file in any other file system would silently be backed by regular pages
+        if (!isHugePageMount(directory.value(), hugePageSize))
+        {
+            IOX_LOG(WARN,
+                    "'" << directory.value() << "' is not a hugetlbfs with pages of "
+                        << hugePageSizeInBytes(hugePageSize) << " bytes! The segment '" << writerGroup.getName()
+                        << "' falls back to regular pages.");
+        }
+        else
+        {
+            // a hugetlbfs only supports sizes which are a multiple of the huge page size
+            auto maybeSharedMemoryObject =
+                createSharedMemory(directory, align(memorySize, hugePageSizeInBytes(hugePageSize)));
+            if (maybeSharedMemoryObject.has_value())
+            {
+                m_sharedMemoryDirectory = directory;
+                return registerSegment(std::move(maybeSharedMemoryObject));
+            }
+
+            IOX_LOG(WARN,
+                    "Unable to back the segment '" << writerGroup.getName() << "' with huge pages of '"
+                                                   << directory.value() << "'. Falling back to regular pages.");
+        }
+    }
+
+    return registerSegment(createSharedMemory(nullopt, memorySize));
 }
 
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
@@ -122,6 +188,19 @@ inline uint64_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSegm
     return m_segmentId;
 }
 
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline const optional<HugePageMount_t>&
+MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSharedMemoryDirectory() const noexcept
+{
+    return m_sharedMemoryDirectory;
+}
+
+template <typename SharedMemoryObjectType, typename MemoryManagerType>
+inline bool MePooSegment<SharedMemoryObjectType, MemoryManagerType>::isLockedInMemory() const noexcept
+{
+    return m_lockedInMemory;
+}
+
 template <typename SharedMemoryObjectType, typename MemoryManagerType>
 inline uint64_t MePooSegment<SharedMemoryObjectType, MemoryManagerType>::getSegmentSize() const noexcept
 {
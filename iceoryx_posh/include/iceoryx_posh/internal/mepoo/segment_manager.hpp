@@ -73,6 +73,8 @@ class SegmentManager
         bool m_isWritable{false};
         uint64_t m_segmentId{0};
         iox::mepoo::MemoryInfo m_memoryInfo; // we can specify additional info about a segments memory here
+        optional<HugePageMount_t> m_sharedMemoryDirectory; // set if the segment is backed by huge pages
+        bool m_lockInMemory{false};                         // the segment must be locked in RAM after mapping
     };
 
     struct SegmentUserInformation
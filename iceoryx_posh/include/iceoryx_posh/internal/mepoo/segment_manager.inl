@@ -43,8 +43,17 @@ inline void SegmentManager<SegmentType>::createSegment(const SegmentConfig::Segm
 {
     auto readerGroup = PosixGroup(segmentEntry.m_readerGroup);
     auto writerGroup = PosixGroup(segmentEntry.m_writerGroup);
-    m_segmentContainer.emplace_back(
-        segmentEntry.m_mempoolConfig, *m_managementAllocator, readerGroup, writerGroup, segmentEntry.m_memoryInfo);
+    m_segmentContainer.emplace_back(segmentEntry.m_mempoolConfig,
+                                    *m_managementAllocator,
+                                    readerGroup,
+                                    writerGroup,
+                                    segmentEntry.m_memoryInfo,
+                                    segmentEntry.m_zeroingThreadCount,
+                                    segmentEntry.m_hugePageSize,
+                                    segmentEntry.m_hugePageMount,
+                                    segmentEntry.m_numaPolicy,
+                                    segmentEntry.m_numaNodeMask,
+                                    segmentEntry.m_lockInMemory);
 }
 
 template <typename SegmentType>
@@ -70,6 +79,8 @@ SegmentManager<SegmentType>::getSegmentMappings(const PosixUser& user) noexcept
                 {
                     mappingContainer.emplace_back(
                         segment.getWriterGroup().getName(), segment.getSegmentSize(), true, segment.getSegmentId());
+                    mappingContainer.back().m_sharedMemoryDirectory = segment.getSharedMemoryDirectory();
+                    mappingContainer.back().m_lockInMemory = segment.isLockedInMemory();
                     foundInWriterGroup = true;
                 }
                 else
@@ -93,6 +104,8 @@ SegmentManager<SegmentType>::getSegmentMappings(const PosixUser& user) noexcept
             {
                 mappingContainer.emplace_back(
                     segment.getWriterGroup().getName(), segment.getSegmentSize(), false, segment.getSegmentId());
+                mappingContainer.back().m_sharedMemoryDirectory = segment.getSharedMemoryDirectory();
+                mappingContainer.back().m_lockInMemory = segment.isLockedInMemory();
             }
         }
     }
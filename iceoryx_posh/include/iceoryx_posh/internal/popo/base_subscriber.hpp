@@ -26,6 +26,7 @@
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iox/expected.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
 #include "iox/unique_ptr.hpp"
 
 namespace iox
@@ -124,6 +125,9 @@ class BaseSubscriber
     /// port
     expected<const mepoo::ChunkHeader*, ChunkReceiveResult> takeChunk() noexcept;
 
+    /// @brief small helper method to take multiple chunks at once with the 'tryGetChunks' method of the port
+    expected<uint64_t, ChunkReceiveResult> takeChunks(const span<const mepoo::ChunkHeader*> chunkHeaders) noexcept;
+
     void invalidateTrigger(const uint64_t trigger) noexcept;
 
     /// @brief Only usable by the WaitSet, not for public use. Attaches the triggerHandle to the internal trigger.
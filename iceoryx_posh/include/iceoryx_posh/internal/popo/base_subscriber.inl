@@ -92,6 +92,13 @@ inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> BaseSubscriber<po
     return m_port.tryGetChunk();
 }
 
+template <typename port_t>
+inline expected<uint64_t, ChunkReceiveResult>
+BaseSubscriber<port_t>::takeChunks(const span<const mepoo::ChunkHeader*> chunkHeaders) noexcept
+{
+    return m_port.tryGetChunks(chunkHeaders);
+}
+
 template <typename port_t>
 inline void BaseSubscriber<port_t>::releaseQueuedData() noexcept
 {
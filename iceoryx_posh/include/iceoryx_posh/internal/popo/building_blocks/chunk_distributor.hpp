@@ -17,15 +17,19 @@
 #ifndef IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_HPP
 #define IOX_POSH_POPO_BUILDING_BLOCKS_CHUNK_DISTRIBUTOR_HPP
 
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_distributor_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iox/deadline_timer.hpp"
 #include "iox/detail/adaptive_wait.hpp"
 #include "iox/detail/unique_id.hpp"
 #include "iox/not_null.hpp"
+#include "iox/span.hpp"
 
 #include <algorithm>
 #include <iterator>
+#include <mutex>
 #include <thread>
 
 namespace iox
@@ -35,7 +39,8 @@ namespace popo
 enum class ChunkDistributorError
 {
     QUEUE_CONTAINER_OVERFLOW,
-    QUEUE_NOT_IN_CONTAINER
+    QUEUE_NOT_IN_CONTAINER,
+    QUEUE_SNAPSHOT_IN_USE
 };
 
 /// @brief The ChunkDistributor is the low layer building block to send SharedChunks to a dynamic number of ChunkQueus.
@@ -50,6 +55,13 @@ enum class ChunkDistributorError
 /// This ChunkDistributor can be used with different LockingPolicies for different scenarios
 /// When different threads operate on it (e.g. application sends chunks and RouDi adds and removes queues),
 /// a locking policy must be used that ensures consistent data in the ChunkDistributorData.
+/// The fan-out in deliverToAllStoredQueues does not take the lock. It iterates over a published snapshot of the
+/// stored queues which is replaced by tryAddQueue, tryRemoveQueue and removeAllQueues. These wait until the retired
+/// snapshot is not used by a delivery anymore before they return, therefore a removed queue is not accessed after
+/// its removal. Only when a history is configured, a short critical section is required to add the chunk to the
+/// history. A producer which is blocked by a full queue sleeps until the consumer removed a chunk from the queue or
+/// the stored queues changed. When the consumer too slow timeout expires, the chunk is lost for the queues which are
+/// still full and the delivery returns.
 /// @todo iox-#1713 There are currently some challenges:
 /// For the stored queues and the history, containers are used which are not thread safe. Therefore we use an
 /// inter-process mutex. But this can lead to deadlocks if a user process gets terminated while one of its
@@ -57,10 +69,8 @@ enum class ChunkDistributorError
 /// by a middleware thread and sending chunks by the user process would not interleave. I.e. there is no concurrent
 /// access to the containers. Then a memory synchronization would be sufficient.
 /// The cleanup() call is the biggest challenge. This is used to free chunks that are still held by a not properly
-/// terminated user application. Even if access from middleware and user threads do not overlap, the history
-/// container to cleanup could be in an inconsistent state as the application was hard terminated while changing it.
-/// We would need a container like the UsedChunkList to have one that is robust against such inconsistencies....
-/// A perfect job for our future selves
+/// terminated user application. The history is a ring buffer which can be cleaned up even if the application was hard
+/// terminated while changing it, but the cleanup still requires the lock.
 template <typename ChunkDistributorDataType>
 class ChunkDistributor
 {
@@ -82,16 +92,23 @@ class ChunkDistributor
     /// @param[in] queueToAdd chunk queue to add to the list
     /// @param[in] requestedHistory number of last chunks from history to send if available. If history size is smaller
     /// then the available history size chunks are provided
-    /// @return if the queue could be added it returns success, otherwiese a ChunkDistributor error
+    /// @return if the queue could be added it returns success, otherwiese a ChunkDistributor error;
+    /// QUEUE_SNAPSHOT_IN_USE if a delivery did not release the queue snapshot which has to be replaced within
+    /// QUEUE_SNAPSHOT_RELEASE_TIMEOUT, in this case the stored queues are unchanged and the call can be retried
     expected<void, ChunkDistributorError> tryAddQueue(not_null<ChunkQueueData_t* const> queueToAdd,
                                                       const uint64_t requestedHistory = 0U) noexcept;
 
     /// @brief Remove a queue from the internal list of chunk queues
     /// @param[in] queueToRemove is the queue to remove from the list
-    /// @return if the queue could be removed it returns success, otherwiese a ChunkDistributor error
+    /// @return if the queue was removed and is not accessed by a delivery anymore it returns success, otherwiese a
+    /// ChunkDistributor error; QUEUE_NOT_IN_CONTAINER if the queue is neither stored nor accessed by a delivery,
+    /// QUEUE_SNAPSHOT_IN_USE if a delivery might still access the queue after QUEUE_SNAPSHOT_RELEASE_TIMEOUT, in this
+    /// case the queue must not be destroyed and the call has to be retried later
     expected<void, ChunkDistributorError> tryRemoveQueue(not_null<ChunkQueueData_t* const> queueToRemove) noexcept;
 
-    /// @brief Delete all the stored chunk queues
+    /// @brief Delete all the stored chunk queues. If a delivery does not release the queue snapshot within
+    /// QUEUE_SNAPSHOT_RELEASE_TIMEOUT, an error is logged and the queues which might still be accessed have to be
+    /// released with tryRemoveQueue before they are destroyed
     void removeAllQueues() noexcept;
 
     /// @brief Get the information whether there are any stored chunk queues
@@ -104,6 +121,15 @@ class ChunkDistributor
     /// @return the number of queues the chunk was delivered to
     uint64_t deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief Deliver the provided shared chunks in the provided order to all the stored chunk queues. The chunks will
+    /// be added to the chunk history. All chunks are pushed to a queue in one pass over the stored queues and the
+    /// condition variable of every queue is notified only once. If the ConsumerTooSlowPolicy is WAIT_FOR_CONSUMER,
+    /// the chunks are delivered one after another like with deliverToAllStoredQueues for a single chunk
+    /// @param[in] chunks are the SharedChunks to be delivered
+    /// @return the number of deliveries, i.e. the sum over all chunks of the number of queues the respective chunk was
+    /// delivered to; the stored queues can change between the chunks when they are delivered one after another
+    uint64_t deliverToAllStoredQueues(const span<mepoo::SharedChunk> chunks) noexcept;
+
     /// @brief Deliver the provided shared chunk to the chunk queue with the provided ID. The chunk will NOT be added
     /// to the chunk history
     /// @param[in] uniqueQueueId is an unique ID which identifies the queue to which this chunk shall be delivered
@@ -146,6 +172,47 @@ class ChunkDistributor
     bool pushToQueue(not_null<ChunkQueueData_t* const> queue, mepoo::SharedChunk chunk) noexcept;
 
   private:
+    /// @brief Marks the currently published queue snapshot as in use
+    /// @return the index of the snapshot which must be passed to releaseQueueSnapshot
+    uint64_t acquireQueueSnapshot() noexcept;
+
+    /// @brief Checks whether the snapshot with the provided index is still the published one
+    /// @param[in] snapshotIndex is the index returned by acquireQueueSnapshot
+    /// @return true if the snapshot was not retired, false otherwise
+    bool isQueueSnapshotActive(const uint64_t snapshotIndex) const noexcept;
+
+    /// @brief Marks the queue snapshot acquired by acquireQueueSnapshot as not used anymore
+    /// @param[in] snapshotIndex is the index returned by acquireQueueSnapshot
+    void releaseQueueSnapshot(const uint64_t snapshotIndex) noexcept;
+
+    /// @brief Waits until the inactive snapshot has no readers. Must be called while holding the lock; the lock is
+    /// temporarily released while the readers are awaited
+    /// @param[in] lock is the lock of the ChunkDistributorData which is held by the caller
+    /// @return true if the inactive snapshot can be published, false if it is still in use
+    bool waitForInactiveQueueSnapshot(std::unique_lock<const MemberType_t>& lock) noexcept;
+
+    /// @brief Copies the stored queues into the inactive snapshot and publishes it. Must be called while holding the
+    /// lock and after waitForInactiveQueueSnapshot succeeded
+    /// @return the index of the retired snapshot which must be passed to waitForQueueSnapshotReaders after the lock
+    /// was released
+    uint64_t publishQueueSnapshot() noexcept;
+
+    /// @brief Waits at most QUEUE_SNAPSHOT_RELEASE_TIMEOUT until there are no readers of the snapshot with the
+    /// provided index. Must be called without holding the lock. The readers are only reclaimed when the delivering
+    /// process is known to not deliver anymore, see canQueueSnapshotReadersBeReclaimed
+    /// @return true if the snapshot has no readers anymore, false otherwise
+    bool waitForQueueSnapshotReaders(const uint64_t snapshotIndex) noexcept;
+
+    /// @brief Checks whether RouDi removed the port of the delivering process or the heartbeat of the process
+    /// expired, which is the criterion RouDi uses to consider a process as terminated
+    /// @return true if the readers cannot exist anymore, false otherwise
+    bool canQueueSnapshotReadersBeReclaimed() const noexcept;
+
+    /// @brief Lookup for the index of a queue with a specific iox::UniqueId in the provided queue container
+    static optional<uint32_t> findQueueIndex(const typename MemberType_t::QueueContainer_t& queues,
+                                             const UniqueId uniqueQueueId,
+                                             const uint32_t lastKnownQueueIndex) noexcept;
+
     MemberType_t* m_chunkDistrubutorDataPtr{nullptr};
 };
 
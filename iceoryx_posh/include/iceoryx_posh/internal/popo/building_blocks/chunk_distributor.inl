@@ -50,7 +50,13 @@ inline expected<void, ChunkDistributorError>
 ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_t* const> queueToAdd,
                                                         const uint64_t requestedHistory) noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    std::unique_lock<const MemberType_t> lock(*getMembers());
+
+    // the stored queues are only changed when the changed snapshot can be published
+    if (!waitForInactiveQueueSnapshot(lock))
+    {
+        return err(ChunkDistributorError::QUEUE_SNAPSHOT_IN_USE);
+    }
 
     const auto alreadyKnownReceiver =
         std::find_if(getMembers()->m_queues.begin(),
@@ -65,8 +71,10 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_
             // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we checked the capacity, so
             // pushing will be fine
             getMembers()->m_queues.push_back(RelativePointer<ChunkQueueData_t>(queueToAdd));
+            // the retired snapshot does not contain the added queue, therefore its readers are not awaited
+            publishQueueSnapshot();
 
-            const auto currChunkHistorySize = getMembers()->m_history.size();
+            const auto currChunkHistorySize = getMembers()->m_historySize;
 
             if (requestedHistory > getMembers()->m_historyCapacity)
             {
@@ -77,11 +85,25 @@ ChunkDistributor<ChunkDistributorDataType>::tryAddQueue(not_null<ChunkQueueData_
 
             // if the current history is large enough we send the requested number of chunks, else we send the
             // total history
-            const auto startIndex =
-                (requestedHistory <= currChunkHistorySize) ? currChunkHistorySize - requestedHistory : 0u;
-            for (auto i = startIndex; i < currChunkHistorySize; ++i)
+            const auto numberOfChunksToDeliver = internal::min(requestedHistory, currChunkHistorySize);
+            if (numberOfChunksToDeliver > 0U)
             {
-                pushToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
+                // the newest chunks of the ring buffer are at most two contiguous ranges, the one up to the end of
+                // the buffer and the wrapped around one starting at the beginning of the buffer
+                const auto historyCapacity = getMembers()->m_historyCapacity;
+                const auto startIndex =
+                    (getMembers()->m_historyBegin + currChunkHistorySize - numberOfChunksToDeliver) % historyCapacity;
+                const auto endIndex = internal::min(startIndex + numberOfChunksToDeliver, historyCapacity);
+                const auto wrappedAroundEndIndex = numberOfChunksToDeliver - (endIndex - startIndex);
+
+                for (auto i = startIndex; i < endIndex; ++i)
+                {
+                    pushToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
+                }
+                for (uint64_t i = 0U; i < wrappedAroundEndIndex; ++i)
+                {
+                    pushToQueue(queueToAdd, getMembers()->m_history[i].cloneToSharedChunk());
+                }
             }
 
             return ok();
@@ -103,7 +125,14 @@ template <typename ChunkDistributorDataType>
 inline expected<void, ChunkDistributorError>
 ChunkDistributor<ChunkDistributorDataType>::tryRemoveQueue(not_null<ChunkQueueData_t* const> queueToRemove) noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    std::unique_lock<const MemberType_t> lock(*getMembers());
+
+    // the inactive snapshot is the retired one of a previous removal; if it is still in use, a queue removed by this
+    // removal might still be accessed
+    if (!waitForInactiveQueueSnapshot(lock))
+    {
+        return err(ChunkDistributorError::QUEUE_SNAPSHOT_IN_USE);
+    }
 
     const auto iter = std::find(getMembers()->m_queues.begin(),
                                 getMembers()->m_queues.end(),
@@ -112,6 +141,15 @@ ChunkDistributor<ChunkDistributorDataType>::tryRemoveQueue(not_null<ChunkQueueDa
     {
         // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we don't use iter any longer so return value can be ignored
         getMembers()->m_queues.erase(iter);
+        const auto retiredSnapshotIndex = publishQueueSnapshot();
+        lock.unlock();
+
+        // a removed queue must not be accessed after tryRemoveQueue returned since the queue might be destroyed
+        // afterwards; the lock is not held while waiting in order to not stall the other users of the distributor
+        if (!waitForQueueSnapshotReaders(retiredSnapshotIndex))
+        {
+            return err(ChunkDistributorError::QUEUE_SNAPSHOT_IN_USE);
+        }
 
         return ok();
     }
@@ -124,9 +162,22 @@ ChunkDistributor<ChunkDistributorDataType>::tryRemoveQueue(not_null<ChunkQueueDa
 template <typename ChunkDistributorDataType>
 inline void ChunkDistributor<ChunkDistributorDataType>::removeAllQueues() noexcept
 {
-    typename MemberType_t::LockGuard_t lock(*getMembers());
+    std::unique_lock<const MemberType_t> lock(*getMembers());
+
+    if (!waitForInactiveQueueSnapshot(lock))
+    {
+        IOX_LOG(ERROR, "The queues of a ChunkDistributor could not be removed since a delivery uses them!");
+        return;
+    }
 
     getMembers()->m_queues.clear();
+    const auto retiredSnapshotIndex = publishQueueSnapshot();
+    lock.unlock();
+
+    if (!waitForQueueSnapshotReaders(retiredSnapshotIndex))
+    {
+        IOX_LOG(ERROR, "The removed queues of a ChunkDistributor are still used by a delivery!");
+    }
 }
 
 template <typename ChunkDistributorDataType>
@@ -141,90 +192,307 @@ template <typename ChunkDistributorDataType>
 inline uint64_t ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(mepoo::SharedChunk chunk) noexcept
 {
     uint64_t numberOfQueuesTheChunkWasDeliveredTo{0U};
-    using QueueContainer = decltype(getMembers()->m_queues);
+    using QueueContainer = typename MemberType_t::QueueContainer_t;
     QueueContainer fullQueuesAwaitingDelivery;
+
+    uint64_t snapshotIndex{0U};
+    if (getMembers()->m_historyCapacity > 0U)
     {
+        // the chunk is added to the history and the snapshot is acquired in the same critical section as tryAddQueue
+        // publishes the snapshot and delivers the history; this ensures that a newly added queue receives the chunk
+        // either from the history or from this delivery but never from both or none of them
         typename MemberType_t::LockGuard_t lock(*getMembers());
+        addToHistoryWithoutDelivery(chunk);
+        snapshotIndex = acquireQueueSnapshot();
+    }
+    else
+    {
+        snapshotIndex = acquireQueueSnapshot();
+    }
 
-        bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
-        // send to all the queues
-        for (auto& queue : getMembers()->m_queues)
-        {
-            bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
+    bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    // send to all the queues
+    for (auto& queue : getMembers()->m_queueSnapshots[snapshotIndex])
+    {
+        bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
 
-            if (pushToQueue(queue.get(), chunk))
+        if (pushToQueue(queue.get(), chunk))
+        {
+            ++numberOfQueuesTheChunkWasDeliveredTo;
+        }
+        else
+        {
+            if (isBlockingQueue)
             {
-                ++numberOfQueuesTheChunkWasDeliveredTo;
+                fullQueuesAwaitingDelivery.emplace_back(queue);
             }
             else
             {
-                if (isBlockingQueue)
-                {
-                    fullQueuesAwaitingDelivery.emplace_back(queue);
-                }
-                else
-                {
-                    ++numberOfQueuesTheChunkWasDeliveredTo;
-                    ChunkQueuePusher_t(queue.get()).lostAChunk();
-                }
+                ++numberOfQueuesTheChunkWasDeliveredTo;
+                ChunkQueuePusher_t(queue.get()).lostAChunk();
             }
         }
     }
 
-    // busy waiting until every queue is served
-    iox::detail::adaptive_wait adaptiveWait;
+    // wait until every blocking queue is served or the consumer too slow timeout has expired; the deadline is only
+    // started when the delivery actually has to wait
+    optional<deadline_timer> deadline;
     while (!fullQueuesAwaitingDelivery.empty())
     {
-        adaptiveWait.wait();
+        if (!deadline.has_value())
         {
-            // create intersection of current queues and fullQueuesAwaitingDelivery
-            // reason: it is possible that since the last iteration some subscriber have already unsubscribed
-            //          and without this intersection we would deliver to dead queues
-            typename MemberType_t::LockGuard_t lock(*getMembers());
-            QueueContainer remainingQueues;
-            using QueueContainerValue = typename QueueContainer::value_type;
-            auto greaterThan = [](QueueContainerValue& a, QueueContainerValue& b) -> bool {
-                return reinterpret_cast<uint64_t>(a.get()) > reinterpret_cast<uint64_t>(b.get());
-            };
-            std::sort(getMembers()->m_queues.begin(), getMembers()->m_queues.end(), greaterThan);
+            deadline.emplace(getMembers()->m_consumerTooSlowTimeout);
+        }
+        else if (deadline->hasExpired())
+        {
+            for (auto& queue : fullQueuesAwaitingDelivery)
+            {
+                ++numberOfQueuesTheChunkWasDeliveredTo;
+                ChunkQueuePusher_t(queue.get()).lostAChunk();
+            }
+            break;
+        }
+
+        // the snapshot is held while waiting, therefore the queue cannot be removed and destroyed in the meantime;
+        // publishQueueSnapshot wakes up the producer when the stored queues change, a snapshot which was published
+        // before the producer registered as waiting ends the wait immediately
+        ChunkQueuePusher_t(fullQueuesAwaitingDelivery.front().get())
+            .waitForSpace(algorithm::minVal(BLOCKED_PRODUCER_WAIT_SLICE, deadline->remainingTime()),
+                          [&] { return isQueueSnapshotActive(snapshotIndex); });
+        releaseQueueSnapshot(snapshotIndex);
+
+        // create intersection of current queues and fullQueuesAwaitingDelivery
+        // reason: it is possible that since the last iteration some subscriber have already unsubscribed
+        //          and without this intersection we would deliver to dead queues
+        // the intersection keeps the order of the snapshot, therefore the producer always waits for the first
+        // full queue in delivery order
+        using QueueContainerValue = typename QueueContainer::value_type;
+        auto greaterThan = [](const QueueContainerValue& a, const QueueContainerValue& b) -> bool {
+            return reinterpret_cast<uint64_t>(a.get()) > reinterpret_cast<uint64_t>(b.get());
+        };
 
 #if (defined(__GNUC__) && __GNUC__ == 13 && !defined(__clang__))
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Warray-bounds"
 #endif
-            std::sort(fullQueuesAwaitingDelivery.begin(), fullQueuesAwaitingDelivery.end(), greaterThan);
+        std::sort(fullQueuesAwaitingDelivery.begin(), fullQueuesAwaitingDelivery.end(), greaterThan);
 #if (defined(__GNUC__) && __GNUC__ == 13 && !defined(__clang__))
 #pragma GCC diagnostic pop
 #endif
 
-            std::set_intersection(getMembers()->m_queues.begin(),
-                                  getMembers()->m_queues.end(),
-                                  fullQueuesAwaitingDelivery.begin(),
-                                  fullQueuesAwaitingDelivery.end(),
-                                  std::back_inserter(remainingQueues),
-                                  greaterThan);
-            fullQueuesAwaitingDelivery.clear();
+        snapshotIndex = acquireQueueSnapshot();
+        QueueContainer remainingQueues;
+        for (auto& queue : getMembers()->m_queueSnapshots[snapshotIndex])
+        {
+            if (std::binary_search(
+                    fullQueuesAwaitingDelivery.begin(), fullQueuesAwaitingDelivery.end(), queue, greaterThan))
+            {
+                remainingQueues.push_back(queue);
+            }
+        }
+        fullQueuesAwaitingDelivery.clear();
 
-            // deliver to remaining queues
-            for (auto& queue : remainingQueues)
+        // deliver to remaining queues
+        for (auto& queue : remainingQueues)
+        {
+            if (pushToQueue(queue.get(), chunk))
             {
-                if (pushToQueue(queue.get(), chunk))
-                {
-                    ++numberOfQueuesTheChunkWasDeliveredTo;
-                }
-                else
-                {
-                    fullQueuesAwaitingDelivery.push_back(queue);
-                }
+                ++numberOfQueuesTheChunkWasDeliveredTo;
+            }
+            else
+            {
+                fullQueuesAwaitingDelivery.push_back(queue);
             }
         }
     }
-
-    addToHistoryWithoutDelivery(chunk);
+    releaseQueueSnapshot(snapshotIndex);
 
     return numberOfQueuesTheChunkWasDeliveredTo;
 }
 
+template <typename ChunkDistributorDataType>
+inline uint64_t
+ChunkDistributor<ChunkDistributorDataType>::deliverToAllStoredQueues(const span<mepoo::SharedChunk> chunks) noexcept
+{
+    uint64_t numberOfDeliveries{0U};
+    if (getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER)
+    {
+        // a producer which might be blocked by a full queue delivers the chunks one after another in order to not
+        // block the other queues for the whole batch
+        for (uint64_t i = 0U; i < chunks.size(); ++i)
+        {
+            numberOfDeliveries += deliverToAllStoredQueues(chunks[i]);
+        }
+        return numberOfDeliveries;
+    }
+
+    uint64_t snapshotIndex{0U};
+    if (getMembers()->m_historyCapacity > 0U)
+    {
+        // same critical section as for a single chunk, see deliverToAllStoredQueues
+        typename MemberType_t::LockGuard_t lock(*getMembers());
+        for (uint64_t i = 0U; i < chunks.size(); ++i)
+        {
+            addToHistoryWithoutDelivery(chunks[i]);
+        }
+        snapshotIndex = acquireQueueSnapshot();
+    }
+    else
+    {
+        snapshotIndex = acquireQueueSnapshot();
+    }
+
+    for (auto& queue : getMembers()->m_queueSnapshots[snapshotIndex])
+    {
+        ChunkQueuePusher_t pusher(queue.get());
+        bool hasLostChunks{false};
+        for (uint64_t i = 0U; i < chunks.size(); ++i)
+        {
+            hasLostChunks = !pusher.pushWithoutNotification(chunks[i]) || hasLostChunks;
+        }
+        if (hasLostChunks)
+        {
+            pusher.lostAChunk();
+        }
+        pusher.notifyConditionVariable();
+        // like for a single chunk, a chunk which is lost due to a full queue counts as delivered
+        numberOfDeliveries += chunks.size();
+    }
+    releaseQueueSnapshot(snapshotIndex);
+
+    return numberOfDeliveries;
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::acquireQueueSnapshot() noexcept
+{
+    auto& members = *getMembers();
+    while (true)
+    {
+        const auto snapshotIndex = members.m_activeQueueSnapshot.load();
+        members.m_queueSnapshotReaders[snapshotIndex].fetch_add(1U);
+        // the snapshot could have been retired between loading the index and registering as reader; in this case
+        // waitForInactiveQueueSnapshot might not wait for this reader, therefore the registration is undone and
+        // repeated
+        if (members.m_activeQueueSnapshot.load() == snapshotIndex)
+        {
+            return snapshotIndex;
+        }
+        members.m_queueSnapshotReaders[snapshotIndex].fetch_sub(1U);
+    }
+}
+
+template <typename ChunkDistributorDataType>
+inline bool
+ChunkDistributor<ChunkDistributorDataType>::isQueueSnapshotActive(const uint64_t snapshotIndex) const noexcept
+{
+    return getMembers()->m_activeQueueSnapshot.load() == snapshotIndex;
+}
+
+template <typename ChunkDistributorDataType>
+inline void ChunkDistributor<ChunkDistributorDataType>::releaseQueueSnapshot(const uint64_t snapshotIndex) noexcept
+{
+    getMembers()->m_queueSnapshotReaders[snapshotIndex].fetch_sub(1U);
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::waitForInactiveQueueSnapshot(
+    std::unique_lock<const MemberType_t>& lock) noexcept
+{
+    auto& members = *getMembers();
+    auto inactiveSnapshotIndex = (members.m_activeQueueSnapshot.load() + 1U) % MemberType_t::NUMBER_OF_QUEUE_SNAPSHOTS;
+
+    // the inactive snapshot might still be in use by a delivery which acquired it before it was retired by a
+    // previous publish or by readers which registered at it and will undo the registration since the snapshot is
+    // not published; the lock is released while waiting, therefore the inactive snapshot has to be reevaluated
+    // afterwards since the active one might have been replaced by another publish in the meantime
+    while (members.m_queueSnapshotReaders[inactiveSnapshotIndex].load() != 0U)
+    {
+        lock.unlock();
+        const bool isSnapshotReleased = waitForQueueSnapshotReaders(inactiveSnapshotIndex);
+        lock.lock();
+
+        if (!isSnapshotReleased)
+        {
+            return false;
+        }
+        inactiveSnapshotIndex = (members.m_activeQueueSnapshot.load() + 1U) % MemberType_t::NUMBER_OF_QUEUE_SNAPSHOTS;
+    }
+
+    return true;
+}
+
+template <typename ChunkDistributorDataType>
+inline uint64_t ChunkDistributor<ChunkDistributorDataType>::publishQueueSnapshot() noexcept
+{
+    auto& members = *getMembers();
+    const auto retiredSnapshotIndex = members.m_activeQueueSnapshot.load();
+    const auto nextSnapshotIndex = (retiredSnapshotIndex + 1U) % MemberType_t::NUMBER_OF_QUEUE_SNAPSHOTS;
+
+    members.m_queueSnapshots[nextSnapshotIndex] = members.m_queues;
+    members.m_activeQueueSnapshot.store(nextSnapshotIndex);
+
+    // producers which wait for space in a queue of the retired snapshot hold the snapshot; they are woken up to
+    // continue with the published snapshot; readers which register after the new snapshot was published undo their
+    // registration, therefore the queues are only accessed when the retired snapshot is actually in use
+    if (members.m_queueSnapshotReaders[retiredSnapshotIndex].load() != 0U)
+    {
+        for (auto& queue : members.m_queueSnapshots[retiredSnapshotIndex])
+        {
+            ChunkQueuePusher_t(queue.get()).wakeUpProducersWaitingForSpace();
+        }
+    }
+
+    return retiredSnapshotIndex;
+}
+
+template <typename ChunkDistributorDataType>
+inline bool
+ChunkDistributor<ChunkDistributorDataType>::waitForQueueSnapshotReaders(const uint64_t snapshotIndex) noexcept
+{
+    auto& readers = getMembers()->m_queueSnapshotReaders[snapshotIndex];
+    deadline_timer releaseTimeout{QUEUE_SNAPSHOT_RELEASE_TIMEOUT};
+    iox::detail::adaptive_wait adaptiveWait;
+    while (readers.load() != 0U)
+    {
+        // the readers are only reclaimed when they cannot exist anymore; resetting the counter of a live reader
+        // would lead to an access of an already destroyed queue and to an underflow on its release
+        if (canQueueSnapshotReadersBeReclaimed())
+        {
+            IOX_LOG(WARN,
+                    "The queue snapshot of a ChunkDistributor was not released since the delivering process was "
+                    "terminated or removed during a delivery! Reclaiming the snapshot.");
+            readers.store(0U);
+            break;
+        }
+        if (releaseTimeout.hasExpired())
+        {
+            IOX_LOG(WARN,
+                    "The queue snapshot of a ChunkDistributor is still in use by a delivery after "
+                        << QUEUE_SNAPSHOT_RELEASE_TIMEOUT << "! The queues are changed when it is released.");
+            return false;
+        }
+        adaptiveWait.wait();
+    }
+
+    return true;
+}
+
+template <typename ChunkDistributorDataType>
+inline bool ChunkDistributor<ChunkDistributorDataType>::canQueueSnapshotReadersBeReclaimed() const noexcept
+{
+    if (getMembers()->m_isQueueSnapshotReaderRemoved.load())
+    {
+        return true;
+    }
+
+    // the heartbeat is owned by RouDi and independent of PID namespaces and the reuse of pids; without a heartbeat,
+    // e.g. for ports of unmonitored processes, the termination of the delivering process cannot be detected
+    const auto* heartbeat = getMembers()->m_queueSnapshotReaderHeartbeat.get();
+    return heartbeat != nullptr
+           && heartbeat->elapsed_milliseconds_since_last_beat() > runtime::PROCESS_KEEP_ALIVE_TIMEOUT.toMilliseconds();
+}
+
 template <typename ChunkDistributorDataType>
 inline bool ChunkDistributor<ChunkDistributorDataType>::pushToQueue(not_null<ChunkQueueData_t* const> queue,
                                                                     mepoo::SharedChunk chunk) noexcept
@@ -238,39 +506,55 @@ ChunkDistributor<ChunkDistributorDataType>::deliverToQueue(const UniqueId unique
                                                            const uint32_t lastKnownQueueIndex,
                                                            mepoo::SharedChunk chunk [[maybe_unused]]) noexcept
 {
-    bool retry{false};
-    do
+    bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    optional<deadline_timer> deadline;
+    while (true)
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
+        const auto snapshotIndex = acquireQueueSnapshot();
+        auto& queues = getMembers()->m_queueSnapshots[snapshotIndex];
 
-        auto queueIndex = getQueueIndex(uniqueQueueId, lastKnownQueueIndex);
+        auto queueIndex = findQueueIndex(queues, uniqueQueueId, lastKnownQueueIndex);
 
         if (!queueIndex.has_value())
         {
+            releaseQueueSnapshot(snapshotIndex);
             return err(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER);
         }
 
-        auto& queue = getMembers()->m_queues[queueIndex.value()];
-
-        bool willWaitForConsumer = getMembers()->m_consumerTooSlowPolicy == ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+        auto& queue = queues[queueIndex.value()];
 
         bool isBlockingQueue = (willWaitForConsumer && queue->m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER);
 
-        retry = false;
-        if (!pushToQueue(queue.get(), chunk))
+        if (pushToQueue(queue.get(), chunk))
         {
-            if (isBlockingQueue)
-            {
-                retry = true;
-            }
-            else
-            {
-                ChunkQueuePusher_t(queue.get()).lostAChunk();
-            }
+            releaseQueueSnapshot(snapshotIndex);
+            return ok();
         }
-    } while (retry);
 
-    return ok();
+        if (!isBlockingQueue)
+        {
+            ChunkQueuePusher_t(queue.get()).lostAChunk();
+            releaseQueueSnapshot(snapshotIndex);
+            return ok();
+        }
+
+        if (!deadline.has_value())
+        {
+            deadline.emplace(getMembers()->m_consumerTooSlowTimeout);
+        }
+        else if (deadline->hasExpired())
+        {
+            ChunkQueuePusher_t(queue.get()).lostAChunk();
+            releaseQueueSnapshot(snapshotIndex);
+            return ok();
+        }
+
+        // the snapshot is held while waiting, therefore the queue cannot be removed and destroyed in the meantime
+        ChunkQueuePusher_t(queue.get())
+            .waitForSpace(algorithm::minVal(BLOCKED_PRODUCER_WAIT_SLICE, deadline->remainingTime()),
+                          [&] { return isQueueSnapshotActive(snapshotIndex); });
+        releaseQueueSnapshot(snapshotIndex);
+    }
 }
 
 template <typename ChunkDistributorDataType>
@@ -280,8 +564,15 @@ ChunkDistributor<ChunkDistributorDataType>::getQueueIndex(const UniqueId uniqueQ
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    auto& queues = getMembers()->m_queues;
+    return findQueueIndex(getMembers()->m_queues, uniqueQueueId, lastKnownQueueIndex);
+}
 
+template <typename ChunkDistributorDataType>
+inline optional<uint32_t>
+ChunkDistributor<ChunkDistributorDataType>::findQueueIndex(const typename MemberType_t::QueueContainer_t& queues,
+                                                           const UniqueId uniqueQueueId,
+                                                           const uint32_t lastKnownQueueIndex) noexcept
+{
     if (queues.size() > lastKnownQueueIndex && queues[lastKnownQueueIndex]->m_uniqueId == uniqueQueueId)
     {
         return lastKnownQueueIndex;
@@ -304,18 +595,26 @@ inline void ChunkDistributor<ChunkDistributorDataType>::addToHistoryWithoutDeliv
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    if (0u < getMembers()->m_historyCapacity)
+    const auto historyCapacity = getMembers()->m_historyCapacity;
+    if (0u < historyCapacity)
     {
-        if (getMembers()->m_history.size() >= getMembers()->m_historyCapacity)
+        auto& historyBegin = getMembers()->m_historyBegin;
+        auto& historySize = getMembers()->m_historySize;
+        if (historySize >= historyCapacity)
+        {
+            // the new chunk replaces the oldest one and the next oldest chunk becomes the begin of the history
+            auto& oldestChunk = getMembers()->m_history[historyBegin];
+            // AXIVION Next Construct AutosarC++19_03-A0.1.2 : d'tor of SharedChunk will release the memory, so RAII has
+            // the side effect here and return value does not need to be evaluated
+            oldestChunk.releaseToSharedChunk();
+            oldestChunk = chunk;
+            historyBegin = (historyBegin + 1U) % historyCapacity;
+        }
+        else
         {
-            auto chunkToRemove = getMembers()->m_history.begin();
-            chunkToRemove->releaseToSharedChunk();
-            // AXIVION Next Construct AutosarC++19_03-A0.1.2 : we are not iterating here, so return value can be ignored
-            getMembers()->m_history.erase(chunkToRemove);
+            getMembers()->m_history[(historyBegin + historySize) % historyCapacity] = chunk;
+            ++historySize;
         }
-        // AXIVION Next Construct AutosarC++19_03-A0.1.2, AutosarC++19_03-M0-3-2 : we ensured that there is space in the
-        // history, so return value can be ignored
-        getMembers()->m_history.push_back(chunk);
     }
 }
 
@@ -324,7 +623,7 @@ inline uint64_t ChunkDistributor<ChunkDistributorDataType>::getHistorySize() noe
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    return getMembers()->m_history.size();
+    return getMembers()->m_historySize;
 }
 
 template <typename ChunkDistributorDataType>
@@ -338,12 +637,15 @@ inline void ChunkDistributor<ChunkDistributorDataType>::clearHistory() noexcept
 {
     typename MemberType_t::LockGuard_t lock(*getMembers());
 
-    for (auto& unmanagedChunk : getMembers()->m_history)
+    // all slots are released since the application could have been terminated while modifying the history and
+    // therefore m_historyBegin and m_historySize might not reflect the slots holding a chunk
+    for (uint64_t i = 0U; i < getMembers()->m_historyCapacity; ++i)
     {
-        unmanagedChunk.releaseToSharedChunk();
+        getMembers()->m_history[i].releaseToSharedChunk();
     }
 
-    getMembers()->m_history.clear();
+    getMembers()->m_historyBegin = 0U;
+    getMembers()->m_historySize = 0U;
 }
 
 template <typename ChunkDistributorDataType>
@@ -20,13 +20,16 @@
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
+#include "iceoryx_posh/internal/runtime/heartbeat.hpp"
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 #include "iox/algorithm.hpp"
+#include "iox/duration.hpp"
 #include "iox/logging.hpp"
 #include "iox/mutex.hpp"
 #include "iox/relative_pointer.hpp"
 #include "iox/vector.hpp"
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
 
@@ -43,21 +46,42 @@ struct ChunkDistributorData : public LockingPolicy
     using ChunkQueueData_t = typename ChunkQueuePusherType::MemberType_t;
     using ChunkDistributorDataProperties_t = ChunkDistributorDataProperties;
 
-    ChunkDistributorData(const ConsumerTooSlowPolicy policy, const uint64_t historyCapacity = 0u) noexcept;
+    ChunkDistributorData(const ConsumerTooSlowPolicy policy,
+                         const uint64_t historyCapacity = 0u,
+                         const units::Duration consumerTooSlowTimeout = units::Duration::max()) noexcept;
 
     const uint64_t m_historyCapacity;
 
     using QueueContainer_t = vector<RelativePointer<ChunkQueueData_t>, ChunkDistributorDataProperties_t::MAX_QUEUES>;
     QueueContainer_t m_queues;
 
-    /// @todo iox-#1710 If we would make the ChunkDistributor lock-free, can we than extend the UsedChunkList to
-    /// be like a ring buffer and use this for the history? This would be needed to be able to safely cleanup.
-    /// Using ShmSafeUnmanagedChunk since RouDi must access this list to cleanup the chunks in case of an application
-    /// crash.
-    using HistoryContainer_t =
-        vector<mepoo::ShmSafeUnmanagedChunk, ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY>;
-    HistoryContainer_t m_history;
+    /// @brief m_queues is only modified under the lock and afterwards copied into the currently inactive snapshot
+    /// which is then published via m_activeQueueSnapshot. deliverToAllStoredQueues iterates over the published
+    /// snapshot without holding the lock, the readers of a snapshot are tracked in m_queueSnapshotReaders to know
+    /// when a retired snapshot is not accessed anymore. Only the process which owns the port delivers, RouDi stores
+    /// the heartbeat of this process in m_queueSnapshotReaderHeartbeat when it creates the port to detect readers
+    /// which were terminated during a delivery and sets m_isQueueSnapshotReaderRemoved when it destroys the port,
+    /// i.e. when the process does not deliver anymore. The readers are only reclaimed in these two cases
+    static constexpr uint64_t NUMBER_OF_QUEUE_SNAPSHOTS{2U};
+    QueueContainer_t m_queueSnapshots[NUMBER_OF_QUEUE_SNAPSHOTS];
+    std::atomic<uint64_t> m_activeQueueSnapshot{0U};
+    std::atomic<uint64_t> m_queueSnapshotReaders[NUMBER_OF_QUEUE_SNAPSHOTS];
+    RelativePointer<runtime::Heartbeat> m_queueSnapshotReaderHeartbeat;
+    std::atomic_bool m_isQueueSnapshotReaderRemoved{false};
+
+    /// @brief The history is a ring buffer of m_historySize chunks starting with the oldest one at m_historyBegin,
+    /// therefore the oldest chunk is evicted without moving the other ones.
+    /// Using ShmSafeUnmanagedChunk since RouDi must access this buffer to cleanup the chunks in case of an application
+    /// crash. Every slot which is not logically a nullptr holds a chunk, independent of m_historyBegin and
+    /// m_historySize. Therefore the cleanup does not rely on these members being consistent when the application
+    /// terminated while modifying the history.
+    mepoo::ShmSafeUnmanagedChunk m_history[ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY];
+    uint64_t m_historyBegin{0U};
+    uint64_t m_historySize{0U};
     const ConsumerTooSlowPolicy m_consumerTooSlowPolicy;
+    /// @brief the maximum time a delivery waits for a queue with QueueFullPolicy::BLOCK_PRODUCER; the chunk is lost
+    /// for the queues which are still full afterwards
+    const units::Duration m_consumerTooSlowTimeout;
 };
 
 } // namespace popo
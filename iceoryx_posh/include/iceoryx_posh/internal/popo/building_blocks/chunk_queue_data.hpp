@@ -24,7 +24,9 @@
 #include "iceoryx_posh/popo/port_queue_policies.hpp"
 #include "iox/detail/unique_id.hpp"
 #include "iox/relative_pointer.hpp"
+#include "iox/unnamed_semaphore.hpp"
 
+#include <atomic>
 #include <mutex>
 
 namespace iox
@@ -49,6 +51,11 @@ struct ChunkQueueData : public LockingPolicy
     RelativePointer<ConditionVariableData> m_conditionVariableDataPtr;
     optional<uint64_t> m_conditionVariableNotificationIndex;
     const QueueFullPolicy m_queueFullPolicy;
+
+    /// @brief only created for the QueueFullPolicy::BLOCK_PRODUCER; posted by the consumer after it removed a chunk
+    /// while producers are waiting for space in the queue
+    optional<UnnamedSemaphore> m_spaceAvailableSemaphore;
+    std::atomic<uint64_t> m_numberOfProducersWaitingForSpace{0U};
 };
 
 } // namespace popo
@@ -27,6 +27,16 @@ inline ChunkQueueData<ChunkQueueProperties, LockingPolicy>::ChunkQueueData(const
     : m_queue(queueType)
     , m_queueFullPolicy(policy)
 {
+    if (m_queueFullPolicy == QueueFullPolicy::BLOCK_PRODUCER)
+    {
+        UnnamedSemaphoreBuilder()
+            .initialValue(0U)
+            .isInterProcessCapable(true)
+            .create(m_spaceAvailableSemaphore)
+            .or_else([](auto) {
+                errorHandler(PoshError::POPO__CHUNK_QUEUE_DATA_FAILED_TO_CREATE_SEMAPHORE, ErrorLevel::FATAL);
+            });
+    }
 }
 
 } // namespace popo
@@ -46,7 +46,7 @@ class ChunkQueuePopper
     ChunkQueuePopper& operator=(ChunkQueuePopper&& rhs) noexcept = default;
     virtual ~ChunkQueuePopper() noexcept = default;
 
-    /// @brief pop a chunk from the chunk queue
+    /// @brief pop a chunk from the chunk queue and wake up producers which are waiting for space in the queue
     /// @return optional for a shared chunk that is set if the queue is not empty
     optional<mepoo::SharedChunk> tryPop() noexcept;
 
@@ -97,6 +97,8 @@ class ChunkQueuePopper
     MemberType_t* getMembers() noexcept;
 
   private:
+    void notifyProducersWaitingForSpace() noexcept;
+
     MemberType_t* m_chunkQueueDataPtr;
 };
 
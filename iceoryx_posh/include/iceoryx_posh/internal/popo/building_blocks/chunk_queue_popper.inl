@@ -52,6 +52,8 @@ inline optional<mepoo::SharedChunk> ChunkQueuePopper<ChunkQueueDataType>::tryPop
     // check if queue had an element that was poped and return if so
     if (retVal.has_value())
     {
+        notifyProducersWaitingForSpace();
+
         auto chunk = retVal.value().releaseToSharedChunk();
 
         auto receivedChunkHeaderVersion = chunk.getChunkHeader()->chunkHeaderVersion();
@@ -123,6 +125,7 @@ inline void ChunkQueuePopper<ChunkQueueDataType>::clear() noexcept
         // side effect here and return value does not need to be evaluated
         maybeUnmanagedChunk.value().releaseToSharedChunk();
     }
+    notifyProducersWaitingForSpace();
 }
 
 template <typename ChunkQueueDataType>
@@ -150,6 +153,26 @@ inline bool ChunkQueuePopper<ChunkQueueDataType>::isConditionVariableSet() const
     return getMembers()->m_conditionVariableDataPtr.operator bool();
 }
 
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePopper<ChunkQueueDataType>::notifyProducersWaitingForSpace() noexcept
+{
+    auto& semaphore = getMembers()->m_spaceAvailableSemaphore;
+    if (!semaphore.has_value())
+    {
+        return;
+    }
+
+    // pairs with the fence in ChunkQueuePusher::waitForSpace; either the producer sees the free space or the
+    // consumer sees the waiting producer
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (getMembers()->m_numberOfProducersWaitingForSpace.load(std::memory_order_relaxed) > 0U)
+    {
+        semaphore->post().or_else([](auto) {
+            errorHandler(PoshError::POPO__CHUNK_QUEUE_POPPER_SEMAPHORE_CORRUPTED_IN_NOTIFY, ErrorLevel::FATAL);
+        });
+    }
+}
+
 } // namespace popo
 } // namespace iox
 
@@ -21,6 +21,9 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iox/expected.hpp"
+#include "iox/deadline_timer.hpp"
+#include "iox/duration.hpp"
+#include "iox/function_ref.hpp"
 #include "iox/not_null.hpp"
 
 namespace iox
@@ -50,9 +53,32 @@ class ChunkQueuePusher
     /// @return false if a queue overflow occurred, otherwise true
     bool push(mepoo::SharedChunk chunk) noexcept;
 
+    /// @brief push a new chunk to the chunk queue without notifying the attached condition variable; used to push
+    /// multiple chunks with a single notification
+    /// @param[in] shared chunk object
+    /// @return false if a queue overflow occurred, otherwise true
+    bool pushWithoutNotification(mepoo::SharedChunk chunk) noexcept;
+
+    /// @brief notifies the condition variable which is attached to the queue, if there is one
+    void notifyConditionVariable() noexcept;
+
     /// @brief tell the queue that it lost a chunk (e.g. because push failed and there will be no retry)
     void lostAChunk() noexcept;
 
+    /// @brief blocks until the consumer removed a chunk from the full queue or the timeout has passed; returns
+    /// immediately if the queue is not full or if the queue has not the QueueFullPolicy::BLOCK_PRODUCER
+    /// @param[in] timeout the maximum time to wait for space in the queue
+    void waitForSpace(const units::Duration& timeout) noexcept;
+
+    /// @copydoc ChunkQueuePusher::waitForSpace(const units::Duration&)
+    /// @param[in] isWaitStillRequired is checked after the producer registered as waiting; returning false ends the
+    /// wait immediately, e.g. when the waker already made its changes before the registration of the producer
+    void waitForSpace(const units::Duration& timeout, const function_ref<bool()> isWaitStillRequired) noexcept;
+
+    /// @brief wakes up all producers which are currently waiting in waitForSpace, e.g. since the queue is going to be
+    /// removed
+    void wakeUpProducersWaitingForSpace() noexcept;
+
   protected:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
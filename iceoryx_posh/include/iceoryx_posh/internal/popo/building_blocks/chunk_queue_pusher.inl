@@ -44,6 +44,14 @@ ChunkQueuePusher<ChunkQueueDataType>::getMembers() noexcept
 
 template <typename ChunkQueueDataType>
 inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk) noexcept
+{
+    const bool hasNoQueueOverflow = pushWithoutNotification(chunk);
+    notifyConditionVariable();
+    return hasNoQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline bool ChunkQueuePusher<ChunkQueueDataType>::pushWithoutNotification(mepoo::SharedChunk chunk) noexcept
 {
     auto pushRet = getMembers()->m_queue.push(chunk);
     bool hasQueueOverflow = false;
@@ -56,17 +64,19 @@ inline bool ChunkQueuePusher<ChunkQueueDataType>::push(mepoo::SharedChunk chunk)
         hasQueueOverflow = true;
     }
 
+    return !hasQueueOverflow;
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::notifyConditionVariable() noexcept
+{
+    typename MemberType_t::LockGuard_t lock(*getMembers());
+    if (getMembers()->m_conditionVariableDataPtr)
     {
-        typename MemberType_t::LockGuard_t lock(*getMembers());
-        if (getMembers()->m_conditionVariableDataPtr)
-        {
-            ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
-                              *getMembers()->m_conditionVariableNotificationIndex)
-                .notify();
-        }
+        ConditionNotifier(*getMembers()->m_conditionVariableDataPtr.get(),
+                          *getMembers()->m_conditionVariableNotificationIndex)
+            .notify();
     }
-
-    return !hasQueueOverflow;
 }
 
 template <typename ChunkQueueDataType>
@@ -75,6 +85,67 @@ inline void ChunkQueuePusher<ChunkQueueDataType>::lostAChunk() noexcept
     getMembers()->m_queueHasLostChunks.store(true, std::memory_order_relaxed);
 }
 
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::waitForSpace(const units::Duration& timeout) noexcept
+{
+    waitForSpace(timeout, [] { return true; });
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::waitForSpace(const units::Duration& timeout,
+                                                               const function_ref<bool()> isWaitStillRequired) noexcept
+{
+    auto& semaphore = getMembers()->m_spaceAvailableSemaphore;
+    if (!semaphore.has_value())
+    {
+        return;
+    }
+
+    auto& numberOfWaitingProducers = getMembers()->m_numberOfProducersWaitingForSpace;
+    numberOfWaitingProducers.fetch_add(1U, std::memory_order_relaxed);
+    // pairs with the fences in ChunkQueuePopper::notifyProducersWaitingForSpace and wakeUpProducersWaitingForSpace;
+    // either the producer sees the free space or the consumer respectively the waker sees the waiting producer
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    // the posts of the semaphore are shared by all waiting producers and are not drained since a post could be meant
+    // for another producer; a stale post, e.g. from a pop before the registration, only ends one wait and the queue
+    // is checked again, every pop after the registration is either seen by the check or posts the semaphore
+    auto& queue = getMembers()->m_queue;
+    deadline_timer waitDeadline{timeout};
+    bool hasFatalError{false};
+    while (!hasFatalError && queue.size() >= queue.capacity() && isWaitStillRequired() && !waitDeadline.hasExpired())
+    {
+        semaphore->timedWait(waitDeadline.remainingTime()).or_else([&](auto) {
+            errorHandler(PoshError::POPO__CHUNK_QUEUE_PUSHER_SEMAPHORE_CORRUPTED_IN_WAIT, ErrorLevel::FATAL);
+            hasFatalError = true;
+        });
+    }
+
+    numberOfWaitingProducers.fetch_sub(1U, std::memory_order_relaxed);
+}
+
+template <typename ChunkQueueDataType>
+inline void ChunkQueuePusher<ChunkQueueDataType>::wakeUpProducersWaitingForSpace() noexcept
+{
+    auto& semaphore = getMembers()->m_spaceAvailableSemaphore;
+    if (!semaphore.has_value())
+    {
+        return;
+    }
+
+    // pairs with the fence in waitForSpace; the changes of the caller which shall end the wait, like publishing a new
+    // queue snapshot, happen before the fence, therefore either a producer which registers afterwards observes them or
+    // it is seen here as waiting producer
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto numberOfWaitingProducers = getMembers()->m_numberOfProducersWaitingForSpace.load(std::memory_order_relaxed);
+    for (; numberOfWaitingProducers > 0U; --numberOfWaitingProducers)
+    {
+        semaphore->post().or_else([](auto) {
+            errorHandler(PoshError::POPO__CHUNK_QUEUE_PUSHER_SEMAPHORE_CORRUPTED_IN_WAKE_UP, ErrorLevel::FATAL);
+        });
+    }
+}
+
 } // namespace popo
 } // namespace iox
 
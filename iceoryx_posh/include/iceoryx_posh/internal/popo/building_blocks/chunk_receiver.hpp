@@ -22,6 +22,7 @@
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iox/expected.hpp"
 #include "iox/not_null.hpp"
+#include "iox/span.hpp"
 
 namespace iox
 {
@@ -78,6 +79,13 @@ class ChunkReceiver : public ChunkQueuePopper<typename ChunkReceiverDataType::Ch
     /// or if there are no new chunks in the underlying queue
     expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGet() noexcept;
 
+    /// @brief Tries to get multiple received chunks at once. The chunks are popped from the underlying queue and
+    /// registered as chunks in use in one pass, like with tryGet the ownership remains in the ChunkReceiver
+    /// @param[out] chunkHeaders is filled from the beginning with the ChunkHeaders of the received chunks; its size is
+    /// the maximum number of chunks to receive
+    /// @return the number of received chunks, ChunkReceiveResult on error if not a single chunk could be received
+    expected<uint64_t, ChunkReceiveResult> tryGetMany(const span<const mepoo::ChunkHeader*> chunkHeaders) noexcept;
+
     /// @brief Release a chunk that was obtained with get
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void release(const mepoo::ChunkHeader* const chunkHeader) noexcept;
@@ -93,6 +93,39 @@ inline expected<const mepoo::ChunkHeader*, ChunkReceiveResult> ChunkReceiver<Chu
     return err(ChunkReceiveResult::NO_CHUNK_AVAILABLE);
 }
 
+template <typename ChunkReceiverDataType>
+inline expected<uint64_t, ChunkReceiveResult>
+ChunkReceiver<ChunkReceiverDataType>::tryGetMany(const span<const mepoo::ChunkHeader*> chunkHeaders) noexcept
+{
+    if (chunkHeaders.size() == 0U)
+    {
+        return ok<uint64_t>(0U);
+    }
+
+    // the chunk source is only called when there is space in the list of chunks in use; contrary to tryGet no chunk is
+    // therefore lost when the application holds too many chunks
+    bool hasSpaceForChunks{false};
+    uint64_t nextChunkHeaderIndex{0U};
+    auto numberOfReceivedChunks =
+        getMembers()->m_chunksInUse.insertMany(chunkHeaders.size(), [&]() -> optional<mepoo::SharedChunk> {
+            hasSpaceForChunks = true;
+            auto popRet = this->tryPop();
+            if (popRet.has_value())
+            {
+                chunkHeaders[nextChunkHeaderIndex] = popRet->getChunkHeader();
+                ++nextChunkHeaderIndex;
+            }
+            return popRet;
+        });
+
+    if (numberOfReceivedChunks > 0U)
+    {
+        return ok(numberOfReceivedChunks);
+    }
+    return err(hasSpaceForChunks ? ChunkReceiveResult::NO_CHUNK_AVAILABLE
+                                 : ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL);
+}
+
 template <typename ChunkReceiverDataType>
 inline void ChunkReceiver<ChunkReceiverDataType>::release(const mepoo::ChunkHeader* const chunkHeader) noexcept
 {
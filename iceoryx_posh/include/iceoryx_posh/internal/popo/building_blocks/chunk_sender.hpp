@@ -28,6 +28,8 @@
 #include "iox/into.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
+#include "iox/vector.hpp"
 
 namespace iox
 {
@@ -114,6 +116,15 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return the number of receiver the chunk was send to
     uint64_t send(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send multiple allocated chunks to all connected ChunkQueuePopper. The chunks are delivered in the
+    /// provided order with one pass over the connected queues, i.e. the waiting consumers are notified only once for
+    /// the whole batch
+    /// @param[in] chunkHeaders, pointers to the ChunkHeaders to send; the ownership of the pointers is transferred to
+    /// this method
+    /// @return the number of deliveries, i.e. the sum over all chunks of the number of receivers the respective chunk
+    /// was send to
+    uint64_t sendMany(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept;
+
     /// @brief Send an allocated chunk to a specific ChunkQueuePopper
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send; the ownership of the pointer is transferred to this
     /// method
@@ -145,6 +156,16 @@ class ChunkSender : public ChunkDistributor<typename ChunkSenderDataType::ChunkD
     /// @return true if there was a matching chunk with this header, false if not
     bool getChunkReadyForSend(const mepoo::ChunkHeader* const chunkHeader, mepoo::SharedChunk& chunk) noexcept;
 
+    /// @brief Get the slot of the chunk magazine with the next chunk to hand out. If the magazine is empty or holds
+    /// chunks of another mempool than the best fitting one for the provided settings, it is refilled with a batch
+    /// of chunks from the best fitting mempool
+    /// @param[in] chunkSettings of the chunk which shall be allocated
+    /// @return pointer to the slot with the next chunk or nullptr if the magazine is disabled or could not be filled
+    mepoo::ShmSafeUnmanagedChunk* getChunkMagazineTop(const mepoo::ChunkSettings& chunkSettings) noexcept;
+
+    /// @brief Return all chunks of the chunk magazine to their mempool
+    void releaseChunkMagazine() noexcept;
+
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 };
@@ -135,6 +135,28 @@ ChunkSender<ChunkSenderDataType>::tryAllocate(const UniquePortId originId,
             return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
         }
     }
+    else if (auto* chunkMagazineTop = getChunkMagazineTop(chunkSettings))
+    {
+        auto sharedChunk = chunkMagazineTop->cloneToSharedChunk();
+        if (getMembers()->m_chunksInUse.insert(sharedChunk))
+        {
+            // the chunk is only removed from the magazine after it is tracked as chunk in use, therefore it is
+            // never lost if the process terminates in between
+            chunkMagazineTop->releaseToSharedChunk();
+            --getMembers()->m_chunkMagazineSize;
+
+            auto chunkHeader = sharedChunk.getChunkHeader();
+            auto chunkSize = chunkHeader->chunkSize();
+            chunkHeader->~ChunkHeader();
+            new (chunkHeader) mepoo::ChunkHeader(chunkSize, chunkSettings);
+            chunkHeader->setOriginId(originId);
+            return ok(chunkHeader);
+        }
+        else
+        {
+            return err(AllocationError::TOO_MANY_CHUNKS_ALLOCATED_IN_PARALLEL);
+        }
+    }
     else
     {
         // BEGIN of critical section, chunk will be lost if the process terminates in this section
@@ -194,6 +216,38 @@ inline uint64_t ChunkSender<ChunkSenderDataType>::send(mepoo::ChunkHeader* const
     return numberOfReceiverTheChunkWasDelivered;
 }
 
+template <typename ChunkSenderDataType>
+inline uint64_t
+ChunkSender<ChunkSenderDataType>::sendMany(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept
+{
+    // every chunk which is ready for sending was in the list of chunks in use, therefore the batch cannot exceed
+    // its capacity
+    vector<mepoo::SharedChunk, ChunkSenderDataType::MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY> chunks;
+    uint64_t numberOfDeliveries{0};
+    // BEGIN of critical section, chunks will be lost if the process terminates in this section
+    for (uint64_t i = 0U; i < chunkHeaders.size(); ++i)
+    {
+        mepoo::SharedChunk chunk(nullptr);
+        if (getChunkReadyForSend(chunkHeaders[i], chunk))
+        {
+            // AXIVION Next Construct AutosarC++19_03-A0.1.2 : the capacity is sufficient, see above
+            chunks.push_back(chunk);
+        }
+    }
+
+    if (!chunks.empty())
+    {
+        numberOfDeliveries =
+            this->deliverToAllStoredQueues(span<mepoo::SharedChunk>(chunks.begin(), chunks.size()));
+
+        getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+        getMembers()->m_lastChunkUnmanaged = chunks.back();
+    }
+    // END of critical section
+
+    return numberOfDeliveries;
+}
+
 template <typename ChunkSenderDataType>
 inline bool ChunkSender<ChunkSenderDataType>::sendToQueue(mepoo::ChunkHeader* const chunkHeader,
                                                           const UniqueId uniqueQueueId,
@@ -249,6 +303,7 @@ inline void ChunkSender<ChunkSenderDataType>::releaseAll() noexcept
     getMembers()->m_chunksInUse.cleanup();
     this->cleanup();
     getMembers()->m_lastChunkUnmanaged.releaseToSharedChunk();
+    releaseChunkMagazine();
 }
 
 template <typename ChunkSenderDataType>
@@ -267,6 +322,56 @@ inline bool ChunkSender<ChunkSenderDataType>::getChunkReadyForSend(const mepoo::
     }
 }
 
+template <typename ChunkSenderDataType>
+inline mepoo::ShmSafeUnmanagedChunk*
+ChunkSender<ChunkSenderDataType>::getChunkMagazineTop(const mepoo::ChunkSettings& chunkSettings) noexcept
+{
+    auto& members = *getMembers();
+    if (members.m_chunkMagazineCapacity == 0U)
+    {
+        return nullptr;
+    }
+
+    // errors are reported by the regular allocation from the MemoryManager
+    auto bestFittingChunkSize = members.m_memoryMgr->getBestFittingChunkSize(chunkSettings.requiredChunkSize());
+    if (!bestFittingChunkSize.has_value())
+    {
+        return nullptr;
+    }
+
+    if (members.m_chunkMagazineSize > 0U
+        && members.m_chunkMagazine[members.m_chunkMagazineSize - 1U].getChunkHeader()->chunkSize()
+               != bestFittingChunkSize.value())
+    {
+        releaseChunkMagazine();
+    }
+
+    if (members.m_chunkMagazineSize == 0U)
+    {
+        mepoo::SharedChunk chunks[MAX_CHUNK_MAGAZINE_CAPACITY];
+        const auto numberOfChunks =
+            members.m_memoryMgr->getChunks(chunkSettings, &chunks[0], members.m_chunkMagazineCapacity);
+        for (uint32_t i = 0U; i < numberOfChunks; ++i)
+        {
+            members.m_chunkMagazine[i] = chunks[i];
+        }
+        members.m_chunkMagazineSize = numberOfChunks;
+    }
+
+    return (members.m_chunkMagazineSize > 0U) ? &members.m_chunkMagazine[members.m_chunkMagazineSize - 1U] : nullptr;
+}
+
+template <typename ChunkSenderDataType>
+inline void ChunkSender<ChunkSenderDataType>::releaseChunkMagazine() noexcept
+{
+    // all slots are released since the size might be outdated if the process terminated while changing the magazine
+    for (auto& chunk : getMembers()->m_chunkMagazine)
+    {
+        chunk.releaseToSharedChunk();
+    }
+    getMembers()->m_chunkMagazineSize = 0U;
+}
+
 } // namespace popo
 } // namespace iox
 
@@ -36,15 +36,24 @@ struct ChunkSenderData : public ChunkDistributorDataType
     explicit ChunkSenderData(not_null<mepoo::MemoryManager* const> memoryManager,
                              const ConsumerTooSlowPolicy consumerTooSlowPolicy,
                              const uint64_t historyCapacity = 0U,
-                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo()) noexcept;
+                             const mepoo::MemoryInfo& memoryInfo = mepoo::MemoryInfo(),
+                             const uint32_t chunkMagazineCapacity = 0U,
+                             const units::Duration consumerTooSlowTimeout = units::Duration::max()) noexcept;
 
     using ChunkDistributorData_t = ChunkDistributorDataType;
 
+    static constexpr uint32_t MAX_CHUNKS_ALLOCATED_SIMULTANEOUSLY{MaxChunksAllocatedSimultaneously};
+
     const RelativePointer<mepoo::MemoryManager> m_memoryMgr;
     mepoo::MemoryInfo m_memoryInfo;
     UsedChunkList<MaxChunksAllocatedSimultaneously> m_chunksInUse;
     mepoo::SequenceNumber_t m_sequenceNumber{0U};
     mepoo::ShmSafeUnmanagedChunk m_lastChunkUnmanaged;
+    /// @brief chunks which are reserved in advance from the best fitting mempool; like the chunks in use, they are
+    /// owned by the ChunkSenderData and are therefore released by RouDi if the application terminates
+    mepoo::ShmSafeUnmanagedChunk m_chunkMagazine[MAX_CHUNK_MAGAZINE_CAPACITY];
+    const uint32_t m_chunkMagazineCapacity;
+    uint32_t m_chunkMagazineSize{0U};
 };
 
 } // namespace popo
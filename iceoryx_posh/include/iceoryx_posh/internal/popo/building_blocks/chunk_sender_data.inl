@@ -26,11 +26,20 @@ inline ChunkSenderData<MaxChunksAllocatedSimultaneously, ChunkDistributorDataTyp
     not_null<mepoo::MemoryManager* const> memoryManager,
     const ConsumerTooSlowPolicy consumerTooSlowPolicy,
     const uint64_t historyCapacity,
-    const mepoo::MemoryInfo& memoryInfo) noexcept
-    : ChunkDistributorDataType(consumerTooSlowPolicy, historyCapacity)
+    const mepoo::MemoryInfo& memoryInfo,
+    const uint32_t chunkMagazineCapacity,
+    const units::Duration consumerTooSlowTimeout) noexcept
+    : ChunkDistributorDataType(consumerTooSlowPolicy, historyCapacity, consumerTooSlowTimeout)
     , m_memoryMgr(memoryManager)
     , m_memoryInfo(memoryInfo)
+    , m_chunkMagazineCapacity(internal::min(chunkMagazineCapacity, MAX_CHUNK_MAGAZINE_CAPACITY))
 {
+    if (m_chunkMagazineCapacity != chunkMagazineCapacity)
+    {
+        IOX_LOG(WARN,
+                "Chunk magazine too large, reducing from " << chunkMagazineCapacity << " to "
+                                                           << m_chunkMagazineCapacity);
+    }
 }
 
 } // namespace popo
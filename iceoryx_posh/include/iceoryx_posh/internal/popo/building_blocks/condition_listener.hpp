@@ -19,6 +19,7 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/mepoo/memory_info.hpp"
+#include "iceoryx_posh/popo/wait_strategy.hpp"
 #include "iox/algorithm.hpp"
 
 namespace iox
@@ -31,7 +32,11 @@ class ConditionListener
   public:
     using NotificationVector_t = vector<BestFittingType_t<MAX_NUMBER_OF_NOTIFIERS>, MAX_NUMBER_OF_NOTIFIERS>;
 
-    explicit ConditionListener(ConditionVariableData& condVarData) noexcept;
+    /// @brief Creates a ConditionListener
+    /// @param[in] condVarData the condition variable which is used for waiting
+    /// @param[in] waitStrategy defines whether and how long the active notifications are polled before blocking
+    explicit ConditionListener(ConditionVariableData& condVarData,
+                               const WaitStrategy& waitStrategy = WaitStrategy()) noexcept;
     ~ConditionListener() noexcept = default;
     ConditionListener(const ConditionListener& rhs) = delete;
     ConditionListener(ConditionListener&& rhs) noexcept = delete;
@@ -69,14 +74,35 @@ class ConditionListener
     ConditionVariableData* getMembers() volatile noexcept;
 
   private:
-    void resetUnchecked(const uint64_t index) noexcept;
+    /// @brief Collects and resets the active notifications of all words of the ConditionVariableData
+    /// @param[in,out] activeNotifications the indices of the active notifications are appended in ascending order
+    void collectActiveNotifications(NotificationVector_t& activeNotifications) noexcept;
+
+    /// @brief Registers as sleeping listener and blocks with the provided wait call unless there are already active
+    /// notifications; the notifiers only post the semaphore when a listener is registered as sleeping
+    /// @param[in] waitCall blocks on the semaphore
+    /// @return the result of the wait call or true if it was not called
+    bool waitUnlessNotified(const function_ref<bool()> waitCall) noexcept;
+
+    bool hasActiveNotifications() const noexcept;
+
+    /// @brief Polls the active notifications as configured by the wait strategy
+    /// @param[in] maxSpinDuration upper bound for the polling duration in addition to the one of the wait strategy
+    void spinUntilNotified(const units::Duration maxSpinDuration) noexcept;
+
+    /// @brief Executes the spin hint of the wait strategy
+    void relax() const noexcept;
+
+    /// @brief Counts the trailing zero bits of a value which must not be zero
+    static uint64_t countTrailingZeros(const uint64_t value) noexcept;
     void resetSemaphore() noexcept;
 
-    NotificationVector_t waitImpl(const function_ref<bool()> waitCall) noexcept;
+    NotificationVector_t waitImpl(const function_ref<bool()> waitCall, const units::Duration maxSpinDuration) noexcept;
 
   private:
     ConditionVariableData* m_condVarDataPtr{nullptr};
     std::atomic_bool m_toBeDestroyed{false};
+    WaitStrategy m_waitStrategy;
 };
 
 } // namespace popo
@@ -22,6 +22,7 @@
 #include "iox/unnamed_semaphore.hpp"
 
 #include <atomic>
+#include <limits>
 
 namespace iox
 {
@@ -29,6 +30,11 @@ namespace popo
 {
 struct ConditionVariableData
 {
+    using NotificationWord_t = uint64_t;
+    static constexpr uint64_t NOTIFICATIONS_PER_WORD{std::numeric_limits<NotificationWord_t>::digits};
+    static constexpr uint64_t NUMBER_OF_NOTIFICATION_WORDS{(MAX_NUMBER_OF_NOTIFIERS + NOTIFICATIONS_PER_WORD - 1U)
+                                                           / NOTIFICATIONS_PER_WORD};
+
     ConditionVariableData() noexcept;
     explicit ConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
@@ -38,11 +44,33 @@ struct ConditionVariableData
     ConditionVariableData& operator=(ConditionVariableData&& rhs) = delete;
     ~ConditionVariableData() noexcept = default;
 
+    /// @brief Checks if the notification with the provided index is active
+    /// @param[in] index of the notification
+    /// @return true if the notification is active, otherwise false
+    bool isNotificationActive(const uint64_t index) const noexcept;
+
+    /// @brief The word of m_activeNotifications which contains the bit of the notification with the provided index
+    static constexpr uint64_t notificationWordIndex(const uint64_t index) noexcept
+    {
+        return index / NOTIFICATIONS_PER_WORD;
+    }
+
+    /// @brief The mask of the bit of the notification with the provided index in its word of m_activeNotifications
+    static constexpr NotificationWord_t notificationMask(const uint64_t index) noexcept
+    {
+        return static_cast<NotificationWord_t>(1U) << (index % NOTIFICATIONS_PER_WORD);
+    }
+
     optional<UnnamedSemaphore> m_semaphore;
     RuntimeName_t m_runtimeName;
     std::atomic_bool m_toBeDestroyed{false};
-    std::atomic_bool m_activeNotifications[MAX_NUMBER_OF_NOTIFIERS];
+    /// @brief one bit per notifier; the notifiers set their bit and the listener collects all set bits of a word at
+    /// once, therefore a wake up costs only as much as the number of active notifications
+    std::atomic<NotificationWord_t> m_activeNotifications[NUMBER_OF_NOTIFICATION_WORDS];
     std::atomic_bool m_wasNotified{false};
+    /// @brief number of listeners which are about to block on or are blocked on m_semaphore; the notifiers post the
+    /// semaphore only when it is not zero, therefore a notification of an awake listener requires no syscall
+    std::atomic<uint64_t> m_numberOfSleepingListeners{0U};
 };
 
 } // namespace popo
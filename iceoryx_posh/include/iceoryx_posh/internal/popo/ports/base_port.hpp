@@ -80,6 +80,10 @@ class BasePort
     bool toBeDestroyed() const noexcept;
 
   protected:
+    /// @brief Wakes up the RouDi discovery loop to handle a requested state change immediately instead of waiting
+    /// for the next discovery interval
+    void notifyDiscovery() noexcept;
+
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
 
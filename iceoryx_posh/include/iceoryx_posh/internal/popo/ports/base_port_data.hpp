@@ -20,6 +20,7 @@
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/capro/capro_message.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_variable_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/unique_port_id.hpp"
 #include "iox/relative_pointer.hpp"
 
@@ -54,6 +55,9 @@ struct BasePortData
     NodeName_t m_nodeName;
     UniquePortId m_uniqueId;
     std::atomic_bool m_toBeDestroyed{false};
+
+    /// @brief the condition variable of the RouDi discovery loop which is notified when a state change is requested
+    RelativePointer<ConditionVariableData> m_discoveryConditionVariableDataPtr;
 };
 
 } // namespace popo
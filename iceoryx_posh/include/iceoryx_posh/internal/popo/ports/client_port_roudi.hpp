@@ -70,6 +70,12 @@ class ClientPortRouDi : public BasePort
     /// @attention Contract is that user process is no more running when cleanup is called
     void releaseAllChunks() noexcept;
 
+    /// @brief Releases the request queue of a server which is about to be destroyed; the queue is removed if it is
+    /// still stored and it is checked that no request delivery of the client accesses it anymore
+    /// @param[in] queueToRelease is the request queue of the server
+    /// @return true if the client does not access the queue anymore, false if the release has to be retried later
+    bool releaseChunkQueue(not_null<ServerChunkQueueData_t* const> queueToRelease) noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
@@ -64,6 +64,12 @@ class PublisherPortRouDi : public BasePort
     /// Caution: Contract is that user process is no more running when cleanup is called
     void releaseAllChunks() noexcept;
 
+    /// @brief Releases the chunk queue of a subscriber which is about to be destroyed; the queue is removed if it is
+    /// still stored and it is checked that no delivery of the publisher accesses it anymore
+    /// @param[in] queueToRelease is the chunk queue of the subscriber
+    /// @return true if the publisher does not access the queue anymore, false if the release has to be retried later
+    bool releaseChunkQueue(not_null<PublisherPortData::ChunkQueueData_t* const> queueToRelease) noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
@@ -25,6 +25,7 @@
 #include "iox/expected.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
 
 namespace iox
 {
@@ -69,6 +70,11 @@ class PublisherPortUser : public BasePort
     /// @param[in] chunkHeader, pointer to the ChunkHeader to send
     void sendChunk(mepoo::ChunkHeader* const chunkHeader) noexcept;
 
+    /// @brief Send multiple allocated chunks in the provided order to all connected subscriber ports; the subscribers
+    /// are notified only once for all the chunks
+    /// @param[in] chunkHeaders, pointers to the ChunkHeaders to send
+    void sendChunks(const span<mepoo::ChunkHeader* const> chunkHeaders) noexcept;
+
     /// @brief Returns the last sent chunk if there is one
     /// @return pointer to the ChunkHeader of the last sent Chunk if there is one, empty optional if not
     optional<const mepoo::ChunkHeader*> tryGetPreviousChunk() const noexcept;
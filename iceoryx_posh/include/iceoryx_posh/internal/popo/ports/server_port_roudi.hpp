@@ -67,6 +67,12 @@ class ServerPortRouDi : public BasePort
     /// Caution: Contract is that user process is no more running when cleanup is called
     void releaseAllChunks() noexcept;
 
+    /// @brief Releases the response queue of a client which is about to be destroyed; the queue is removed if it is
+    /// still stored and it is checked that no response delivery of the server accesses it anymore
+    /// @param[in] queueToRelease is the response queue of the client
+    /// @return true if the server does not access the queue anymore, false if the release has to be retried later
+    bool releaseChunkQueue(not_null<ClientChunkQueueData_t* const> queueToRelease) noexcept;
+
   private:
     const MemberType_t* getMembers() const noexcept;
     MemberType_t* getMembers() noexcept;
@@ -26,6 +26,7 @@
 #include "iox/expected.hpp"
 #include "iox/not_null.hpp"
 #include "iox/optional.hpp"
+#include "iox/span.hpp"
 
 namespace iox
 {
@@ -67,6 +68,13 @@ class SubscriberPortUser : public BasePort
     /// or if there are no new chunks in the underlying queue
     expected<const mepoo::ChunkHeader*, ChunkReceiveResult> tryGetChunk() noexcept;
 
+    /// @brief Tries to get multiple chunks from the queue at once, the oldest chunks in the queue are received first
+    /// @param[out] chunkHeaders is filled with the ChunkHeaders of the received chunks; its size is the maximum number
+    /// of chunks to receive
+    /// @return the number of received chunks, ChunkReceiveResult on error or if there are no new chunks in the
+    /// underlying queue
+    expected<uint64_t, ChunkReceiveResult> tryGetChunks(const span<const mepoo::ChunkHeader*> chunkHeaders) noexcept;
+
     /// @brief Release a chunk that was obtained with tryGetChunk
     /// @param[in] chunkHeader, pointer to the ChunkHeader to release
     void releaseChunk(const mepoo::ChunkHeader* const chunkHeader) noexcept;
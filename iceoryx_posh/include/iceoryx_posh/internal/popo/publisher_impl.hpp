@@ -22,7 +22,9 @@
 #include "iceoryx_posh/internal/popo/publisher_interface.hpp"
 #include "iceoryx_posh/internal/popo/typed_port_api_trait.hpp"
 #include "iceoryx_posh/popo/sample.hpp"
+#include "iox/span.hpp"
 #include "iox/type_traits.hpp"
+#include "iox/vector.hpp"
 
 namespace iox
 {
@@ -61,6 +63,13 @@ class PublisherImpl : public BasePublisherType, private PublisherInterface<T, H>
     ///
     void publish(Sample<T, H>&& sample) noexcept override;
 
+    ///
+    /// @brief publishMany Publishes the given samples in the given order and then releases their loans. Compared to
+    /// publishing the samples one after another, the subscribers are woken up only once for all the samples.
+    /// @param samples The samples to publish.
+    ///
+    void publishMany(const span<Sample<T, H>> samples) noexcept;
+
     ///
     /// @brief publishCopyOf Copy the provided value into a loaned shared memory chunk and publish it.
     /// @param val Value to copy.
@@ -92,6 +92,26 @@ inline void PublisherImpl<T, H, BasePublisherType>::publish(Sample<T, H>&& sampl
     port().sendChunk(chunkHeader);
 }
 
+template <typename T, typename H, typename BasePublisherType>
+inline void PublisherImpl<T, H, BasePublisherType>::publishMany(const span<Sample<T, H>> samples) noexcept
+{
+    vector<mepoo::ChunkHeader*, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY> chunkHeaders;
+    for (uint64_t i = 0U; i < samples.size(); ++i)
+    {
+        if (chunkHeaders.size() == chunkHeaders.capacity())
+        {
+            port().sendChunks(span<mepoo::ChunkHeader* const>(chunkHeaders.begin(), chunkHeaders.size()));
+            chunkHeaders.clear();
+        }
+        auto userPayload = samples[i].release(); // release the Samples ownership of the chunk before publishing
+        chunkHeaders.push_back(mepoo::ChunkHeader::fromUserPayload(userPayload));
+    }
+    if (!chunkHeaders.empty())
+    {
+        port().sendChunks(span<mepoo::ChunkHeader* const>(chunkHeaders.begin(), chunkHeaders.size()));
+    }
+}
+
 template <typename T, typename H, typename BasePublisherType>
 inline Sample<T, H>
 PublisherImpl<T, H, BasePublisherType>::convertChunkHeaderToSample(mepoo::ChunkHeader* const header) noexcept
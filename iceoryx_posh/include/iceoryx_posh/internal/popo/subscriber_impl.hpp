@@ -20,6 +20,8 @@
 
 #include "iceoryx_posh/internal/popo/base_subscriber.hpp"
 #include "iceoryx_posh/internal/popo/typed_port_api_trait.hpp"
+#include "iox/algorithm.hpp"
+#include "iox/span.hpp"
 
 namespace iox
 {
@@ -52,10 +54,24 @@ class SubscriberImpl : public BaseSubscriberType
     ///
     expected<Sample<const T, const H>, ChunkReceiveResult> take() noexcept;
 
+    ///
+    /// @brief Take multiple samples from the top of the receive queue at once.
+    /// @param maxNumberOfSamples The maximum number of samples to take.
+    /// @param callable Is called with every taken sample, the oldest sample first. It must accept a
+    ///        'Sample<const T, const H>&&'.
+    /// @return Either the number of taken samples or a ChunkReceiveResult if not a single sample was taken.
+    /// @details Compared to consecutive calls of 'take()', the samples are taken from the receive queue in one pass.
+    ///
+    template <typename Callable>
+    expected<uint64_t, ChunkReceiveResult> take(const uint64_t maxNumberOfSamples, Callable&& callable) noexcept;
+
     using PortType = typename BaseSubscriberType::PortType;
 
   protected:
     using BaseSubscriberType::port;
+
+  private:
+    Sample<const T, const H> convertChunkHeaderToSample(const mepoo::ChunkHeader* const header) noexcept;
 };
 
 } // namespace popo
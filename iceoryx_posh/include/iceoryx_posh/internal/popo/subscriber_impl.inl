@@ -39,12 +39,39 @@ inline expected<Sample<const T, const H>, ChunkReceiveResult> SubscriberImpl<T,
     {
         return err(result.error());
     }
-    auto userPayloadPtr = static_cast<const T*>(result.value()->userPayload());
+    return ok(convertChunkHeaderToSample(result.value()));
+}
+
+template <typename T, typename H, typename BaseSubscriberType>
+template <typename Callable>
+inline expected<uint64_t, ChunkReceiveResult>
+SubscriberImpl<T, H, BaseSubscriberType>::take(const uint64_t maxNumberOfSamples, Callable&& callable) noexcept
+{
+    // the application cannot hold more chunks at once
+    const mepoo::ChunkHeader* chunkHeaders[MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY];
+    auto result = BaseSubscriberType::takeChunks(span<const mepoo::ChunkHeader*>(
+        chunkHeaders, algorithm::minVal<uint64_t>(maxNumberOfSamples, MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY)));
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+    for (uint64_t i = 0U; i < result.value(); ++i)
+    {
+        callable(convertChunkHeaderToSample(chunkHeaders[i]));
+    }
+    return ok(result.value());
+}
+
+template <typename T, typename H, typename BaseSubscriberType>
+inline Sample<const T, const H>
+SubscriberImpl<T, H, BaseSubscriberType>::convertChunkHeaderToSample(const mepoo::ChunkHeader* const header) noexcept
+{
+    auto userPayloadPtr = static_cast<const T*>(header->userPayload());
     auto samplePtr = iox::unique_ptr<const T>(userPayloadPtr, [this](const T* userPayload) {
         auto* chunkHeader = iox::mepoo::ChunkHeader::fromUserPayload(userPayload);
         this->port().releaseChunk(chunkHeader);
     });
-    return ok<Sample<const T, const H>>(std::move(samplePtr));
+    return Sample<const T, const H>(std::move(samplePtr));
 }
 
 template <typename T, typename H, typename BaseSubscriberType>
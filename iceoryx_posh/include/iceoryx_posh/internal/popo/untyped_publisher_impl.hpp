@@ -20,6 +20,8 @@
 
 #include "iceoryx_posh/internal/popo/base_publisher.hpp"
 #include "iceoryx_posh/popo/sample.hpp"
+#include "iox/span.hpp"
+#include "iox/vector.hpp"
 
 namespace iox
 {
@@ -60,6 +62,13 @@ class UntypedPublisherImpl : public BasePublisherType
     ///
     void publish(void* const userPayload) noexcept;
 
+    ///
+    /// @brief Publish the provided memory chunks in the provided order. Compared to publishing the chunks one after
+    ///        another, the subscribers are woken up only once for all the chunks.
+    /// @param userPayloads Pointers to the user-payloads of the allocated shared memory chunks.
+    ///
+    void publishMany(const span<void* const> userPayloads) noexcept;
+
     ///
     /// @brief Releases the ownership of the chunk provided by the user-payload pointer.
     /// @param userPayload pointer to the user-payload of the chunk to be released
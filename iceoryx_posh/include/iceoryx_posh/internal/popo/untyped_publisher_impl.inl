@@ -38,6 +38,25 @@ inline void UntypedPublisherImpl<BasePublisherType>::publish(void* const userPay
     port().sendChunk(chunkHeader);
 }
 
+template <typename BasePublisherType>
+inline void UntypedPublisherImpl<BasePublisherType>::publishMany(const span<void* const> userPayloads) noexcept
+{
+    vector<mepoo::ChunkHeader*, MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY> chunkHeaders;
+    for (uint64_t i = 0U; i < userPayloads.size(); ++i)
+    {
+        if (chunkHeaders.size() == chunkHeaders.capacity())
+        {
+            port().sendChunks(span<mepoo::ChunkHeader* const>(chunkHeaders.begin(), chunkHeaders.size()));
+            chunkHeaders.clear();
+        }
+        chunkHeaders.push_back(mepoo::ChunkHeader::fromUserPayload(userPayloads[i]));
+    }
+    if (!chunkHeaders.empty())
+    {
+        port().sendChunks(span<mepoo::ChunkHeader* const>(chunkHeaders.begin(), chunkHeaders.size()));
+    }
+}
+
 template <typename BasePublisherType>
 inline expected<void*, AllocationError>
 UntypedPublisherImpl<BasePublisherType>::loan(const uint32_t userPayloadSize,
@@ -21,7 +21,9 @@
 #include "iceoryx_posh/capro/service_description.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/popo/base_subscriber.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/expected.hpp"
+#include "iox/span.hpp"
 #include "iox/unique_ptr.hpp"
 
 namespace iox
@@ -57,6 +59,17 @@ class UntypedSubscriberImpl : public BaseSubscriberType
     ///
     expected<const void*, ChunkReceiveResult> take() noexcept;
 
+    ///
+    /// @brief Take multiple chunks from the top of the receive queue at once.
+    /// @param userPayloads Is filled from the beginning with the user-payload pointers of the chunks taken, the oldest
+    ///        chunk first. Its size is the maximum number of chunks to take.
+    /// @return Either the number of chunks taken or a ChunkReceiveResult if not a single chunk was taken.
+    /// @details Compared to consecutive calls of 'take()', the chunks are taken from the receive queue in one pass.
+    ///          No automatic cleanup of the associated chunks is performed and must be manually done by calling
+    ///          'release' for every chunk
+    ///
+    expected<uint64_t, ChunkReceiveResult> takeBatch(const span<const void*> userPayloads) noexcept;
+
     ///
     /// @brief Releases the ownership of the chunk provided by the user-payload pointer.
     /// @param userPayload pointer to the user-payload of the chunk to be released
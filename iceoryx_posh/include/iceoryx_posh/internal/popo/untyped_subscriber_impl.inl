@@ -42,6 +42,25 @@ inline expected<const void*, ChunkReceiveResult> UntypedSubscriberImpl<BaseSubsc
     return ok(result.value()->userPayload());
 }
 
+template <typename BaseSubscriberType>
+inline expected<uint64_t, ChunkReceiveResult>
+UntypedSubscriberImpl<BaseSubscriberType>::takeBatch(const span<const void*> userPayloads) noexcept
+{
+    // the application cannot hold more chunks at once
+    const mepoo::ChunkHeader* chunkHeaders[MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY];
+    auto result = BaseSubscriber::takeChunks(span<const mepoo::ChunkHeader*>(
+        chunkHeaders, algorithm::minVal<uint64_t>(userPayloads.size(), MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY)));
+    if (result.has_error())
+    {
+        return err(result.error());
+    }
+    for (uint64_t i = 0U; i < result.value(); ++i)
+    {
+        userPayloads[i] = chunkHeaders[i]->userPayload();
+    }
+    return ok(result.value());
+}
+
 template <typename BaseSubscriberType>
 inline void UntypedSubscriberImpl<BaseSubscriberType>::release(const void* const userPayload) noexcept
 {
@@ -20,6 +20,7 @@
 #include "iceoryx_posh/internal/mepoo/shared_chunk.hpp"
 #include "iceoryx_posh/internal/mepoo/shm_safe_unmanaged_chunk.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
+#include "iox/optional.hpp"
 
 #include <atomic>
 #include <cstdint>
@@ -38,6 +39,9 @@ namespace popo
 ///        accessed. Additionally, the type stored is this array must be less or equal to 64 bit in order to write it
 ///        within one clock cycle to prevent torn writes, which would corrupt the list and could potentially crash
 ///        RouDi.
+///        The slots of the stored chunks are additionally indexed by their ChunkHeader in an open addressing hash
+///        table in order to find the chunk to remove in constant time. The index is only used from runtime context;
+///        RouDi does not rely on it for the cleanup.
 template <uint32_t Capacity>
 class UsedChunkList
 {
@@ -53,7 +57,18 @@ class UsedChunkList
     /// @note only from runtime context
     bool insert(mepoo::SharedChunk chunk) noexcept;
 
-    /// @brief Removes a chunk from the list
+    /// @brief Inserts the SharedChunks provided by a chunk source into the list until either maxNumberOfChunks are
+    /// inserted, the list is full or the chunk source does not provide further chunks. The list is synchronized only
+    /// once for all the inserted chunks.
+    /// @param[in] maxNumberOfChunks is the maximum number of chunks to insert
+    /// @param[in] chunkSource callable with the signature 'optional<mepoo::SharedChunk>()'; it is called only if there
+    /// is space in the list, therefore a provided chunk is never discarded
+    /// @return the number of inserted chunks
+    /// @note only from runtime context
+    template <typename ChunkSource>
+    uint64_t insertMany(const uint64_t maxNumberOfChunks, ChunkSource&& chunkSource) noexcept;
+
+    /// @brief Removes a chunk from the list in constant time
     /// @param[in] chunkHeader to look for a corresponding SharedChunk
     /// @param[out] chunk which is removed
     /// @return true if successfully removed, otherwise false if e.g. the chunkHeader was not found in the list
@@ -68,17 +83,26 @@ class UsedChunkList
   private:
     void init() noexcept;
 
+    void insertIntoFreeSlot(mepoo::SharedChunk&& chunk) noexcept;
+
+    static uint32_t indexTablePosition(const mepoo::ChunkHeader* chunkHeader) noexcept;
+    static uint32_t nextIndexTablePosition(const uint32_t position) noexcept;
+    void eraseFromIndexTable(const uint32_t position) noexcept;
+
   private:
     static constexpr uint32_t INVALID_INDEX{Capacity};
+    /// @brief with twice the capacity the load factor of the index table is at most 0.5 and there are always empty
+    /// positions which terminate a lookup
+    static constexpr uint32_t INDEX_TABLE_SIZE{2U * Capacity};
 
     using DataElement_t = mepoo::ShmSafeUnmanagedChunk;
     static constexpr DataElement_t DATA_ELEMENT_LOGICAL_NULLPTR{};
 
   private:
     std::atomic_flag m_synchronizer = ATOMIC_FLAG_INIT;
-    uint32_t m_usedListHead{INVALID_INDEX};
     uint32_t m_freeListHead{0u};
     uint32_t m_listIndices[Capacity];
+    uint32_t m_indexTable[INDEX_TABLE_SIZE];
     DataElement_t m_listData[Capacity];
 };
 
@@ -41,17 +41,7 @@ bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
     auto hasFreeSpace = m_freeListHead != INVALID_INDEX;
     if (hasFreeSpace)
     {
-        // get next free entry after freelistHead
-        auto nextFree = m_listIndices[m_freeListHead];
-
-        // freeListHead is getting new usedListHead, next of this entry is updated to next in usedList
-        m_listIndices[m_freeListHead] = m_usedListHead;
-        m_usedListHead = m_freeListHead;
-
-        m_listData[m_usedListHead] = DataElement_t(chunk);
-
-        // set freeListHead to the next free entry
-        m_freeListHead = nextFree;
+        insertIntoFreeSlot(std::move(chunk));
 
         /// @todo iox-#623 can we do this cheaper with a global fence in cleanup?
         m_synchronizer.clear(std::memory_order_release);
@@ -64,44 +54,113 @@ bool UsedChunkList<Capacity>::insert(mepoo::SharedChunk chunk) noexcept
 }
 
 template <uint32_t Capacity>
-bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept
+template <typename ChunkSource>
+uint64_t UsedChunkList<Capacity>::insertMany(const uint64_t maxNumberOfChunks, ChunkSource&& chunkSource) noexcept
+{
+    uint64_t numberOfInsertedChunks{0U};
+    while (numberOfInsertedChunks < maxNumberOfChunks && m_freeListHead != INVALID_INDEX)
+    {
+        optional<mepoo::SharedChunk> chunk = chunkSource();
+        if (!chunk.has_value())
+        {
+            break;
+        }
+        insertIntoFreeSlot(std::move(chunk.value()));
+        ++numberOfInsertedChunks;
+    }
+
+    if (numberOfInsertedChunks > 0U)
+    {
+        // one release for all inserted chunks, RouDi acquires the list in cleanup
+        m_synchronizer.clear(std::memory_order_release);
+    }
+    return numberOfInsertedChunks;
+}
+
+template <uint32_t Capacity>
+void UsedChunkList<Capacity>::insertIntoFreeSlot(mepoo::SharedChunk&& chunk) noexcept
 {
-    auto previous = INVALID_INDEX;
+    const auto slot = m_freeListHead;
+
+    // set freeListHead to the next free entry
+    m_freeListHead = m_listIndices[slot];
 
-    // go through usedList with stored chunks
-    for (auto current = m_usedListHead; current != INVALID_INDEX; current = m_listIndices[current])
+    auto position = indexTablePosition(chunk.getChunkHeader());
+    while (m_indexTable[position] != INVALID_INDEX)
     {
-        if (!m_listData[current].isLogicalNullptr())
+        position = nextIndexTablePosition(position);
+    }
+    m_indexTable[position] = slot;
+
+    m_listData[slot] = DataElement_t(std::move(chunk));
+}
+
+template <uint32_t Capacity>
+bool UsedChunkList<Capacity>::remove(const mepoo::ChunkHeader* chunkHeader, mepoo::SharedChunk& chunk) noexcept
+{
+    // go through the slots with the same or a colliding hash, an empty position terminates the lookup
+    for (auto position = indexTablePosition(chunkHeader); m_indexTable[position] != INVALID_INDEX;
+         position = nextIndexTablePosition(position))
+    {
+        const auto slot = m_indexTable[position];
+        // does the entry match the one we want to remove?
+        if (m_listData[slot].getChunkHeader() == chunkHeader)
         {
-            // does the entry match the one we want to remove?
-            if (m_listData[current].getChunkHeader() == chunkHeader)
-            {
-                chunk = m_listData[current].releaseToSharedChunk();
-
-                // remove index from used list
-                if (current == m_usedListHead)
-                {
-                    m_usedListHead = m_listIndices[current];
-                }
-                else
-                {
-                    m_listIndices[previous] = m_listIndices[current];
-                }
-
-                // insert index to free list
-                m_listIndices[current] = m_freeListHead;
-                m_freeListHead = current;
-
-                /// @todo iox-#623 can we do this cheaper with a global fence in cleanup?
-                m_synchronizer.clear(std::memory_order_release);
-                return true;
-            }
+            chunk = m_listData[slot].releaseToSharedChunk();
+
+            eraseFromIndexTable(position);
+
+            // insert index to free list
+            m_listIndices[slot] = m_freeListHead;
+            m_freeListHead = slot;
+
+            /// @todo iox-#623 can we do this cheaper with a global fence in cleanup?
+            m_synchronizer.clear(std::memory_order_release);
+            return true;
         }
-        previous = current;
     }
     return false;
 }
 
+template <uint32_t Capacity>
+uint32_t UsedChunkList<Capacity>::indexTablePosition(const mepoo::ChunkHeader* chunkHeader) noexcept
+{
+    // chunk headers are aligned and therefore the lower bits are always zero; the multiplication with the 64 bit golden
+    // ratio spreads the address bits to the upper bits which are used for the position
+    constexpr uint64_t GOLDEN_RATIO{0x9E3779B97F4A7C15U};
+    // AXIVION Next Construct AutosarC++19_03-M5.2.9 : the address is only used to compute the hash
+    const uint64_t address = reinterpret_cast<uintptr_t>(chunkHeader);
+    constexpr uint64_t HASH_SHIFT{32U};
+    return static_cast<uint32_t>(((address * GOLDEN_RATIO) >> HASH_SHIFT) % INDEX_TABLE_SIZE);
+}
+
+template <uint32_t Capacity>
+uint32_t UsedChunkList<Capacity>::nextIndexTablePosition(const uint32_t position) noexcept
+{
+    return (position + 1U == INDEX_TABLE_SIZE) ? 0U : position + 1U;
+}
+
+template <uint32_t Capacity>
+void UsedChunkList<Capacity>::eraseFromIndexTable(const uint32_t position) noexcept
+{
+    // backward shift deletion; entries following the erased one are moved into the hole unless this would move them
+    // in front of their hash position, this keeps every entry reachable without tombstones
+    auto hole = position;
+    for (auto current = nextIndexTablePosition(hole); m_indexTable[current] != INVALID_INDEX;
+         current = nextIndexTablePosition(current))
+    {
+        const auto home = indexTablePosition(m_listData[m_indexTable[current]].getChunkHeader());
+        const auto distanceFromHome = (current + INDEX_TABLE_SIZE - home) % INDEX_TABLE_SIZE;
+        const auto distanceFromHole = (current + INDEX_TABLE_SIZE - hole) % INDEX_TABLE_SIZE;
+        if (distanceFromHome >= distanceFromHole)
+        {
+            m_indexTable[hole] = m_indexTable[current];
+            hole = current;
+        }
+    }
+    m_indexTable[hole] = INVALID_INDEX;
+}
+
 template <uint32_t Capacity>
 void UsedChunkList<Capacity>::cleanup() noexcept
 {
@@ -138,9 +197,13 @@ void UsedChunkList<Capacity>::init() noexcept
     }
 
 
-    m_usedListHead = INVALID_INDEX;
     m_freeListHead = 0U;
 
+    for (auto& position : m_indexTable)
+    {
+        position = INVALID_INDEX;
+    }
+
     // clear data
     for (auto& data : m_listData)
     {
@@ -0,0 +1,107 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_OWNED_PORT_SLOTS_HPP
+#define IOX_POSH_ROUDI_OWNED_PORT_SLOTS_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+
+#include <array>
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief A set of slot indices of a container with a fixed capacity, stored as one bit per slot
+/// @tparam Capacity is the number of slots of the container
+template <uint64_t Capacity>
+class SlotSet
+{
+  public:
+    /// @brief adds a slot to the set; out of bounds indices are ignored
+    /// @param[in] index of the slot
+    void insert(const uint64_t index) noexcept
+    {
+        if (index < Capacity)
+        {
+            m_words[index / BITS_PER_WORD] |= (uint64_t{1U} << (index % BITS_PER_WORD));
+        }
+    }
+
+    /// @brief removes a slot from the set; out of bounds indices are ignored
+    /// @param[in] index of the slot
+    void erase(const uint64_t index) noexcept
+    {
+        if (index < Capacity)
+        {
+            m_words[index / BITS_PER_WORD] &= ~(uint64_t{1U} << (index % BITS_PER_WORD));
+        }
+    }
+
+    /// @brief checks whether a slot is in the set
+    /// @param[in] index of the slot
+    /// @return true if the slot is in the set, false otherwise
+    bool contains(const uint64_t index) const noexcept
+    {
+        return (index < Capacity) && ((m_words[index / BITS_PER_WORD] >> (index % BITS_PER_WORD)) & 1U) != 0U;
+    }
+
+    /// @brief calls the callable with the index of each slot in the set in ascending order; empty words of the set
+    /// are skipped as a whole
+    /// @param[in] callable which takes the slot index as uint64_t
+    template <typename Callable>
+    void forEach(const Callable& callable) const noexcept
+    {
+        for (uint64_t word = 0U; word < NUMBER_OF_WORDS; ++word)
+        {
+            auto bits = m_words[word];
+            for (uint64_t bit = 0U; bits != 0U; ++bit, bits >>= 1U)
+            {
+                if ((bits & 1U) != 0U)
+                {
+                    callable(word * BITS_PER_WORD + bit);
+                }
+            }
+        }
+    }
+
+  private:
+    static constexpr uint64_t BITS_PER_WORD{64U};
+    static constexpr uint64_t NUMBER_OF_WORDS{(Capacity + BITS_PER_WORD - 1U) / BITS_PER_WORD};
+
+    std::array<uint64_t, NUMBER_OF_WORDS> m_words{};
+};
+
+/// @brief The slots of the port pool containers which were acquired for a process. It is used to clean up the
+/// resources of a process without searching through all containers of the port pool.
+/// @note Resources which are destroyed by RouDi while the process is running are not removed from the index, therefore
+/// the user of the index must check whether a slot is still in use and still belongs to the process.
+struct OwnedPortSlots
+{
+    SlotSet<MAX_PUBLISHERS> publishers;
+    SlotSet<MAX_SUBSCRIBERS> subscribers;
+    SlotSet<MAX_CLIENTS> clients;
+    SlotSet<MAX_SERVERS> servers;
+    SlotSet<MAX_INTERFACE_NUMBER> interfaces;
+    SlotSet<MAX_NODE_NUMBER> nodes;
+    SlotSet<MAX_NUMBER_OF_CONDITION_VARIABLES> conditionVariables;
+};
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_OWNED_PORT_SLOTS_HPP
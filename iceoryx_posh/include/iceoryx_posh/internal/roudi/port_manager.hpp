@@ -32,13 +32,16 @@
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_single_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
 #include "iceoryx_posh/internal/roudi/introspection/port_introspection.hpp"
+#include "iceoryx_posh/internal/roudi/owned_port_slots.hpp"
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry_delta.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 #include "iceoryx_posh/internal/runtime/node_data.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_interface.hpp"
 #include "iceoryx_posh/roudi/port_pool.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/deadline_timer.hpp"
 #include "iox/optional.hpp"
 #include "iox/posix_shared_memory_object.hpp"
 #include "iox/type_traits.hpp"
@@ -64,6 +67,11 @@ class PortManager
 
     void doDiscovery() noexcept;
 
+    /// @brief Returns the condition variable which wakes up the discovery loop; it is notified by the ports when a
+    /// state change is requested
+    /// @return reference to the discovery condition variable
+    popo::ConditionVariableData& getDiscoveryConditionVariable() noexcept;
+
     expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     acquirePublisherPortData(const capro::ServiceDescription& service,
                              const popo::PublisherOptions& publisherOptions,
@@ -120,15 +128,45 @@ class PortManager
     expected<popo::ConditionVariableData*, PortPoolError>
     acquireConditionVariableData(const RuntimeName_t& runtimeName) noexcept;
 
-    /// @brief Used to unblock potential locks in the shutdown phase of a process
+    /// @brief Records the slot of a port which was acquired for a process in the index of the process
+    /// @param[in] ownedPortSlots is the index of the process
+    /// @param[in] portData which was acquired for the process
+    void addToOwnedPortSlots(OwnedPortSlots& ownedPortSlots,
+                             const PublisherPortRouDiType::MemberType_t* const portData) noexcept;
+    void addToOwnedPortSlots(OwnedPortSlots& ownedPortSlots,
+                             const SubscriberPortType::MemberType_t* const portData) noexcept;
+    void addToOwnedPortSlots(OwnedPortSlots& ownedPortSlots, const popo::ClientPortData* const portData) noexcept;
+    void addToOwnedPortSlots(OwnedPortSlots& ownedPortSlots, const popo::ServerPortData* const portData) noexcept;
+    void addToOwnedPortSlots(OwnedPortSlots& ownedPortSlots, const popo::InterfacePortData* const portData) noexcept;
+    void addToOwnedPortSlots(OwnedPortSlots& ownedPortSlots, const runtime::NodeData* const nodeData) noexcept;
+    void addToOwnedPortSlots(OwnedPortSlots& ownedPortSlots,
+                             const popo::ConditionVariableData* const conditionVariableData) noexcept;
+
+    /// @brief Used to unblock potential locks in the shutdown phase of a process; all ports with the runtime name
+    /// are visited, including the ones which were not acquired via the ProcessManager
     /// @param [in] name of the process runtime which is about to shut down
     void unblockProcessShutdown(const RuntimeName_t& runtimeName) noexcept;
 
+    /// @brief Used to unblock potential locks in the shutdown phase of a process; only the ports in the index of
+    /// the process are visited
+    /// @param [in] name of the process runtime which is about to shut down
+    /// @param [in] ownedPortSlots is the index of the ports of the process
+    void unblockProcessShutdown(const RuntimeName_t& runtimeName, const OwnedPortSlots& ownedPortSlots) noexcept;
+
     /// @brief Used to unblock potential locks in the shutdown phase of RouDi
     void unblockRouDiShutdown() noexcept;
 
+    /// @brief Deletes the ports and the other resources of a process; all resources with the runtime name are
+    /// deleted, including the ones which were not acquired via the ProcessManager
+    /// @param [in] name of the process runtime whose resources are deleted
     void deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcept;
 
+    /// @brief Deletes the ports and the other resources of a process; only the slots in the index of the process are
+    /// visited instead of all containers of the port pool
+    /// @param [in] name of the process runtime whose resources are deleted
+    /// @param [in] ownedPortSlots is the index of the resources of the process
+    void deletePortsOfProcess(const RuntimeName_t& runtimeName, const OwnedPortSlots& ownedPortSlots) noexcept;
+
   protected:
     void makeAllPublisherPortsToStopOffer() noexcept;
 
@@ -182,6 +220,14 @@ class PortManager
 
     void sendToAllMatchingInterfacePorts(const capro::CaproMessage& message) noexcept;
 
+    /// @brief Releases the chunk queue of a port which is about to be destroyed from all ports which deliver to it. A
+    /// delivery of a process which is neither terminated nor removed, e.g. a stalled one, might still access the
+    /// queue after the disconnection, the port must then not be destroyed
+    /// @return true if the queue is not accessed anymore, false if the destruction has to be retried later
+    bool releaseChunkQueueOfSubscriber(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept;
+    bool releaseResponseQueueOfClient(popo::ClientPortData* const clientPortData) noexcept;
+    bool releaseRequestQueueOfServer(popo::ServerPortData* const serverPortData) noexcept;
+
     void addPublisherToServiceRegistry(const capro::ServiceDescription& service) noexcept;
     void removePublisherFromServiceRegistry(const capro::ServiceDescription& service) noexcept;
 
@@ -197,10 +243,27 @@ class PortManager
 
     bool isInternal(const capro::ServiceDescription& service) const noexcept;
 
+    OwnedPortSlots collectOwnedPortSlots(const RuntimeName_t& runtimeName) noexcept;
+
     void publishServiceRegistry() noexcept;
 
     const ServiceRegistry& serviceRegistry() const noexcept;
 
+    template <typename T, uint64_t Capacity, uint64_t SlotCapacity>
+    static void addToSlotSet(FixedPositionContainer<T, Capacity>& container,
+                             const T* const element,
+                             SlotSet<SlotCapacity>& slots) noexcept;
+
+    template <typename T, uint64_t Capacity, uint64_t SlotCapacity>
+    static void addSlotsOfRuntimeName(FixedPositionContainer<T, Capacity>& container,
+                                      const RuntimeName_t& runtimeName,
+                                      SlotSet<SlotCapacity>& slots) noexcept;
+
+    template <typename T, uint64_t Capacity, uint64_t SlotCapacity, typename Callable>
+    static void forEachElementInSlotSet(FixedPositionContainer<T, Capacity>& container,
+                                        const SlotSet<SlotCapacity>& slots,
+                                        const Callable& callable) noexcept;
+
   private:
     RouDiMemoryInterface* m_roudiMemoryInterface{nullptr};
     PortPool* m_portPool{nullptr};
@@ -208,6 +271,19 @@ class PortManager
     PortIntrospectionType m_portIntrospection;
     vector<capro::ServiceDescription, NUMBER_OF_INTERNAL_PUBLISHERS> m_internalServices;
     optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryPublisherPortData;
+    optional<PublisherPortRouDiType::MemberType_t*> m_serviceRegistryDeltaPublisherPortData;
+
+    // the service registry is distributed as deltas with the changed entries, the full registry is only published
+    // as snapshot for late joiners and for subscribers which missed a delta
+    vector<capro::ServiceDescription, ServiceRegistryDelta::CAPACITY> m_pendingServiceRegistryChanges;
+    uint64_t m_serviceRegistrySequenceNumber{0U};
+    uint64_t m_deltasSinceServiceRegistrySnapshot{0U};
+    bool m_isServiceRegistrySnapshotPublished{false};
+    deadline_timer m_serviceRegistrySnapshotTimer{SERVICE_REGISTRY_SNAPSHOT_INTERVAL};
+
+    void recordServiceRegistryChange(const capro::ServiceDescription& service) noexcept;
+    void publishServiceRegistryDelta() noexcept;
+    void publishServiceRegistrySnapshot() noexcept;
 
     // some ports for the service registry requires special handling
     // as we cannot send registry information if it was not created yet
@@ -52,6 +52,58 @@ PortManager::doesViolateCommunicationPolicy(const capro::ServiceDescription& ser
     return nullopt;
 }
 
+template <typename T, uint64_t Capacity, uint64_t SlotCapacity>
+inline void PortManager::addToSlotSet(FixedPositionContainer<T, Capacity>& container,
+                                      const T* const element,
+                                      SlotSet<SlotCapacity>& slots) noexcept
+{
+    static_assert(Capacity <= SlotCapacity, "The slot set must be able to hold every slot of the container");
+
+    if (element == nullptr)
+    {
+        return;
+    }
+
+    // aborts if the element is not located in the container
+    const auto slot = container.iter_from_ptr(element);
+    if (slot != container.end())
+    {
+        slots.insert(slot.to_index());
+    }
+}
+
+template <typename T, uint64_t Capacity, uint64_t SlotCapacity>
+inline void PortManager::addSlotsOfRuntimeName(FixedPositionContainer<T, Capacity>& container,
+                                               const RuntimeName_t& runtimeName,
+                                               SlotSet<SlotCapacity>& slots) noexcept
+{
+    static_assert(Capacity <= SlotCapacity, "The slot set must be able to hold every slot of the container");
+
+    for (auto element = container.begin(); element != container.end(); ++element)
+    {
+        if (element->m_runtimeName == runtimeName)
+        {
+            slots.insert(element.to_index());
+        }
+    }
+}
+
+template <typename T, uint64_t Capacity, uint64_t SlotCapacity, typename Callable>
+inline void PortManager::forEachElementInSlotSet(FixedPositionContainer<T, Capacity>& container,
+                                                 const SlotSet<SlotCapacity>& slots,
+                                                 const Callable& callable) noexcept
+{
+    using IndexType = typename FixedPositionContainer<T, Capacity>::IndexType;
+    slots.forEach([&](const uint64_t slot) {
+        // the slot might be released or reused in the meantime
+        auto element = container.iter_from_index(static_cast<IndexType>(slot));
+        if (element != container.end())
+        {
+            callable(element.to_ptr());
+        }
+    });
+}
+
 template <typename T, std::enable_if_t<std::is_same<T, iox::build::ManyToManyPolicy>::value>*>
 inline optional<RuntimeName_t> PortManager::doesViolateCommunicationPolicy(const capro::ServiceDescription&) noexcept
 {
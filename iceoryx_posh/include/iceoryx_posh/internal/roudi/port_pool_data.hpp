@@ -55,6 +55,9 @@ struct PortPoolData
 
     using ClientContainer = FixedPositionContainer<iox::popo::ClientPortData, MAX_CLIENTS>;
     ClientContainer m_clientPortMembers;
+
+    /// @brief wakes up the discovery loop of RouDi; all ports notify it when a state change is requested
+    popo::ConditionVariableData m_discoveryConditionVariable;
 };
 
 } // namespace roudi
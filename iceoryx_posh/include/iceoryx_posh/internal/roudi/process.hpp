@@ -18,6 +18,7 @@
 #define IOX_POSH_ROUDI_PROCESS_HPP
 
 #include "iceoryx_posh/internal/mepoo/segment_manager.hpp"
+#include "iceoryx_posh/internal/roudi/owned_port_slots.hpp"
 #include "iceoryx_posh/internal/roudi/port_manager.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
@@ -49,18 +50,32 @@ class Process
             const HeartbeatPoolIndexType heartbeatPoolIndex,
             const uint64_t sessionId) noexcept;
 
+    /// @brief This class represents an application which has registered at RouDi and manages the communication to the
+    /// application
+    /// @param [in] ipcChannel is the already opened IPC channel to the process; its name is the name of the process
+    /// @param [in] pid is the host system process id
+    /// @param [in] user is user used in the operating system for this process
+    /// @param [in] heartbeatPoolIndex index to the Heartbeat instance for this process; if the index is invalid, no
+    /// monitoring takes place
+    /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
+    Process(runtime::IpcInterfaceUser&& ipcChannel,
+            const uint32_t pid,
+            const PosixUser& user,
+            const HeartbeatPoolIndexType heartbeatPoolIndex,
+            const uint64_t sessionId) noexcept;
+
     Process(const Process& other) = delete;
     Process& operator=(const Process& other) = delete;
     /// @note the move cTor and assignment operator are already implicitly deleted because of the atomic
     Process(Process&& other) = delete;
     Process& operator=(Process&& other) = delete;
-    ~Process() noexcept = default;
+    ~Process() noexcept;
 
     uint32_t getPid() const noexcept;
 
     const RuntimeName_t getName() const noexcept;
 
-    void sendViaIpcChannel(const runtime::IpcMessage& data) noexcept;
+    void sendViaIpcChannel(const runtime::IpcMessage& data) const noexcept;
 
     /// @brief The session ID which is used to check outdated IPC channel transmissions for this process
     /// @return the session ID for this process
@@ -72,12 +87,34 @@ class Process
 
     bool isMonitored() const noexcept;
 
+    /// @brief Watches the process with a pidfd to detect its termination without waiting for a heartbeat timeout;
+    /// if pidfds are not supported, a warning is logged and the termination is only detected by the heartbeat
+    /// @param[in] pidfdWatcher watcher to which the pidfd is added in order to wake up the discovery loop when the
+    /// process terminates
+    /// @return true if the process is watched, false otherwise
+    bool watchTermination(const int pidfdWatcher) noexcept;
+
+    /// @brief Checks without blocking whether the watched process has terminated
+    /// @return true if the process is watched and has terminated, false otherwise
+    bool hasTerminated() const noexcept;
+
+    /// @brief The index of the ports and other resources of the port pool which were acquired for this process
+    /// @return a reference to the index
+    OwnedPortSlots& getOwnedPortSlots() noexcept;
+
+    /// @copydoc Process::getOwnedPortSlots()
+    const OwnedPortSlots& getOwnedPortSlots() const noexcept;
+
   private:
+    static constexpr int INVALID_PIDFD{-1};
+
     const uint32_t m_pid{0U};
     runtime::IpcInterfaceUser m_ipcChannel;
     HeartbeatPoolIndexType m_heartbeatPoolIndex;
     PosixUser m_user;
     std::atomic<uint64_t> m_sessionId{0U};
+    OwnedPortSlots m_ownedPortSlots;
+    int m_pidfd{INVALID_PIDFD};
 };
 
 } // namespace roudi
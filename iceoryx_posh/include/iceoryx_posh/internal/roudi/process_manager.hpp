@@ -24,6 +24,7 @@
 #include "iceoryx_posh/internal/runtime/ipc_interface_user.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "iceoryx_posh/roudi/heartbeat_pool.hpp"
+#include "iceoryx_posh/runtime/port_batch.hpp"
 #include "iceoryx_posh/version/compatibility_check_level.hpp"
 #include "iceoryx_posh/version/version_info.hpp"
 #include "iox/list.hpp"
@@ -58,8 +59,9 @@ class ProcessManager : public ProcessManagerInterface
 
     ProcessManager(RouDiMemoryInterface& roudiMemoryInterface,
                    PortManager& portManager,
-                   const version::CompatibilityCheckLevel compatibilityCheckLevel) noexcept;
-    virtual ~ProcessManager() noexcept override = default;
+                   const version::CompatibilityCheckLevel compatibilityCheckLevel,
+                   const ProcessExitDetection processExitDetection = ProcessExitDetection::HEARTBEAT) noexcept;
+    virtual ~ProcessManager() noexcept override;
 
     ProcessManager(const ProcessManager& other) = delete;
     ProcessManager& operator=(const ProcessManager& other) = delete;
@@ -72,6 +74,8 @@ class ProcessManager : public ProcessManagerInterface
     /// @param [in] transmissionTimestamp is an ID for the application to check for the expected response
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
     /// @param [in] versionInfo Version of iceoryx used
+    /// @param [in] pidNamespaceId is the id of the PID namespace of the process; the process is only watched with a
+    /// pidfd if it is the PID namespace of RouDi, since the pid could refer to another process otherwise
     /// @return false if process was already registered, true otherwise
     bool registerProcess(const RuntimeName_t& name,
                          const uint32_t pid,
@@ -79,10 +83,34 @@ class ProcessManager : public ProcessManagerInterface
                          const bool isMonitored,
                          const int64_t transmissionTimestamp,
                          const uint64_t sessionId,
-                         const version::VersionInfo& versionInfo) noexcept;
+                         const version::VersionInfo& versionInfo,
+                         const uint64_t pidNamespaceId = 0U) noexcept;
+
+    /// @brief Registers a process at the ProcessManager
+    /// @param [in] ipcChannel is the IPC channel to the process which wants to register; it is opened by the caller
+    /// in advance to keep it out of the critical section of the ProcessManager and its name is the name of the process
+    /// @param [in] pid is the host system process id
+    /// @param [in] user is the posix user id to which the process belongs
+    /// @param [in] isMonitored indicates if the process should be monitored for being alive
+    /// @param [in] transmissionTimestamp is an ID for the application to check for the expected response
+    /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
+    /// @param [in] versionInfo Version of iceoryx used
+    /// @param [in] pidNamespaceId is the id of the PID namespace of the process; the process is only watched with a
+    /// pidfd if it is the PID namespace of RouDi, since the pid could refer to another process otherwise
+    /// @return false if process was already registered, true otherwise
+    bool registerProcess(runtime::IpcInterfaceUser&& ipcChannel,
+                         const uint32_t pid,
+                         const PosixUser user,
+                         const bool isMonitored,
+                         const int64_t transmissionTimestamp,
+                         const uint64_t sessionId,
+                         const version::VersionInfo& versionInfo,
+                         const uint64_t pidNamespaceId = 0U) noexcept;
 
     /// @brief Unregisters a process at the ProcessManager
     /// @param [in] name of the process which wants to unregister
+    /// @note only the resources which were acquired via the ProcessManager are deleted; resources which were acquired
+    /// directly via the PortManager have to be deleted with PortManager::deletePortsOfProcess(runtimeName)
     /// @return true if known process was unregistered, false if process is unknown
     bool unregisterProcess(const RuntimeName_t& name) noexcept;
 
@@ -102,6 +130,7 @@ class ProcessManager : public ProcessManagerInterface
 
     /// @brief A process is about to shut down and needs to be unblock by a potentially block publisher
     /// @param [in] name of the process runtime which is about to shut down
+    /// @note only the ports which were acquired via the ProcessManager are unblocked
     void handleProcessShutdownPreparationRequest(const RuntimeName_t& name) noexcept;
 
     /// @brief Tries to gracefully terminate all registered processes
@@ -122,6 +151,12 @@ class ProcessManager : public ProcessManagerInterface
                                 const popo::PublisherOptions& publisherOptions,
                                 const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept;
 
+    /// @brief Adds all publisher and subscriber ports of a batch to the internal process object and sends them to
+    /// the OS process with a single response
+    /// @param[in] name is the name of the runtime requesting the ports
+    /// @param[in] batch contains the descriptions of the requested ports
+    void addPortsForProcess(const RuntimeName_t& name, const runtime::PortBatch& batch) noexcept;
+
     /// @brief Adds a client port to the internal process object and sends it to the OS process
     /// @param[in] name is the name of the runtime requesting the port
     /// @param[in] service is the service description for the new client port
@@ -155,30 +190,59 @@ class ProcessManager : public ProcessManagerInterface
     popo::PublisherPortData* addIntrospectionPublisherPort(const capro::ServiceDescription& service) noexcept;
 
     /// @brief Notify the application that it sent an unsupported message
-    void sendMessageNotSupportedToRuntime(const RuntimeName_t& name) noexcept;
+    void sendMessageNotSupportedToRuntime(const RuntimeName_t& name) const noexcept;
+
+    /// @brief The watcher to which the pidfds of the processes are added with the PIDFD exit detection; it is valid
+    /// for the lifetime of the ProcessManager and waiting on it does not require to lock the ProcessManager
+    /// @return the file descriptor of the watcher or INVALID_PIDFD_WATCHER if processes are not watched with a pidfd
+    int pidfdWatcher() const noexcept;
+
+    static constexpr int INVALID_PIDFD_WATCHER{-1};
 
 
   private:
     optional<Process*> findProcess(const RuntimeName_t& name) noexcept;
+    optional<const Process*> findProcess(const RuntimeName_t& name) const noexcept;
+
+    /// @brief creates a publisher port for the process and appends its response entries to response
+    void acquirePublisherForProcess(Process& process,
+                                    const capro::ServiceDescription& service,
+                                    const popo::PublisherOptions& publisherOptions,
+                                    const PortConfigInfo& portConfigInfo,
+                                    runtime::IpcMessage& response) noexcept;
+
+    /// @brief creates a subscriber port for the process and appends its response entries to response
+    void acquireSubscriberForProcess(Process& process,
+                                     const capro::ServiceDescription& service,
+                                     const popo::SubscriberOptions& subscriberOptions,
+                                     const PortConfigInfo& portConfigInfo,
+                                     runtime::IpcMessage& response) noexcept;
 
     void monitorProcesses() noexcept;
+
+    /// @brief The heartbeat of the process is stored in the ChunkDistributors of its ports which deliver chunks, in
+    /// order to reclaim the queue snapshots of deliveries which were interrupted by the termination of the process
+    /// @return the heartbeat or a nullptr if the process is not monitored
+    runtime::Heartbeat* heartbeatOfProcess(const Process& process) noexcept;
     void discoveryUpdate() noexcept override;
 
-    /// @param [in] name of the process; this is equal to the IPC channel name, which is used for communication
+    /// @param [in] ipcChannel is the opened IPC channel to the process; its name is the name of the process
     /// @param [in] pid is the host system process id
     /// @param [in] user is user used in the operating system for this process
     /// @param [in] isMonitored indicates if the process should be monitored for being alive
     /// @param [in] transmissionTimestamp is an ID for the application to check for the expected response
     /// @param [in] sessionId is an ID generated by RouDi to prevent sending outdated IPC channel transmission
     /// @param [in] versionInfo Version of iceoryx used
+    /// @param [in] pidNamespaceId is the id of the PID namespace of the process
     /// @return Returns if the process could be added successfully.
-    bool addProcess(const RuntimeName_t& name,
+    bool addProcess(runtime::IpcInterfaceUser&& ipcChannel,
                     const uint32_t pid,
                     const PosixUser& user,
                     const bool isMonitored,
                     const int64_t transmissionTimestamp,
                     const uint64_t sessionId,
-                    const version::VersionInfo& versionInfo) noexcept;
+                    const version::VersionInfo& versionInfo,
+                    const uint64_t pidNamespaceId) noexcept;
 
     /// @brief Removes the process from the managed client process list, identified by its id.
     /// @param [in] name The process name which should be removed.
@@ -231,7 +295,10 @@ class ProcessManager : public ProcessManagerInterface
     ProcessList_t m_processList;
     ProcessIntrospectionType* m_processIntrospection{nullptr};
     version::CompatibilityCheckLevel m_compatibilityCheckLevel;
+    ProcessExitDetection m_processExitDetection{ProcessExitDetection::HEARTBEAT};
     HeartbeatPool* m_heartbeatPool;
+    uint64_t m_pidNamespaceId{0U};
+    int m_pidfdWatcher{INVALID_PIDFD_WATCHER};
 };
 
 } // namespace roudi
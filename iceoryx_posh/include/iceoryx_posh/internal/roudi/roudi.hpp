@@ -22,7 +22,6 @@
 #include "iceoryx_posh/internal/roudi/introspection/mempool_introspection.hpp"
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
-#include "iceoryx_posh/popo/user_trigger.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_interface.hpp"
 #include "iceoryx_posh/roudi/memory/roudi_memory_manager.hpp"
 #include "iceoryx_posh/roudi/roudi_app.hpp"
@@ -59,13 +58,17 @@ class RouDi
             const RuntimeMessagesThreadStart RuntimeMessagesThreadStart = RuntimeMessagesThreadStart::IMMEDIATE,
             const version::CompatibilityCheckLevel compatibilityCheckLevel = version::CompatibilityCheckLevel::PATCH,
             const units::Duration processKillDelay = roudi::PROCESS_DEFAULT_KILL_DELAY,
-            const units::Duration processTerminationDelay = roudi::PROCESS_DEFAULT_TERMINATION_DELAY) noexcept
+            const units::Duration processTerminationDelay = roudi::PROCESS_DEFAULT_TERMINATION_DELAY,
+            const uint32_t runtimeMessagesThreadCount = roudi::RUNTIME_MESSAGES_DEFAULT_THREAD_COUNT,
+            const roudi::ProcessExitDetection processExitDetection = roudi::ProcessExitDetection::HEARTBEAT) noexcept
             : m_monitoringMode(monitoringMode)
             , m_killProcessesInDestructor(killProcessesInDestructor)
             , m_runtimesMessagesThreadStart(RuntimeMessagesThreadStart)
             , m_compatibilityCheckLevel(compatibilityCheckLevel)
             , m_processKillDelay(processKillDelay)
             , m_processTerminationDelay(processTerminationDelay)
+            , m_runtimeMessagesThreadCount(runtimeMessagesThreadCount)
+            , m_processExitDetection(processExitDetection)
         {
         }
 
@@ -75,6 +78,8 @@ class RouDi
         const version::CompatibilityCheckLevel m_compatibilityCheckLevel;
         const units::Duration m_processKillDelay;
         const units::Duration m_processTerminationDelay;
+        const uint32_t m_runtimeMessagesThreadCount;
+        const roudi::ProcessExitDetection m_processExitDetection;
     };
 
     RouDi& operator=(const RouDi& other) = delete;
@@ -110,7 +115,12 @@ class RouDi
     version::VersionInfo parseRegisterMessage(const runtime::IpcMessage& message,
                                               uint32_t& pid,
                                               uid_t& userId,
-                                              int64_t& transmissionTimestamp) noexcept;
+                                              int64_t& transmissionTimestamp,
+                                              uint64_t& pidNamespaceId) noexcept;
+
+    /// @brief deserializes the next port description of a CREATE_PORTS message from the cursor and adds it to batch
+    /// @return false if the port description could not be deserialized
+    bool addPortToBatch(runtime::IpcMessage::Cursor& cursor, runtime::PortBatch& batch) noexcept;
 
     /// @brief Handles the registration request from process
     /// @param [in] name of the process which wants to register at roudi; this is equal to the IPC channel name
@@ -124,7 +134,8 @@ class RouDi
                          const PosixUser user,
                          const int64_t transmissionTimestamp,
                          const uint64_t sessionId,
-                         const version::VersionInfo& versionInfo) noexcept;
+                         const version::VersionInfo& versionInfo,
+                         const uint64_t pidNamespaceId = 0U) noexcept;
 
     /// @brief Creates a unique ID which can be used to check outdated IPC channel transmissions
     /// @return a unique, monotonic and consecutive increasing number
@@ -133,14 +144,24 @@ class RouDi
   private:
     void processRuntimeMessages() noexcept;
 
+    /// @brief Receives and processes messages from the runtimes until the thread is requested to stop; runs on all
+    /// threads processing runtime messages which share the IPC channel of RouDi
+    void receiveAndProcessRuntimeMessages(const runtime::IpcInterfaceCreator& roudiIpcInterface) noexcept;
+
     void monitorAndDiscoveryUpdate() noexcept;
 
+    /// @brief Wakes up the discovery loop when a process which is watched with a pidfd terminates; only runs with the
+    /// PIDFD exit detection
+    void watchProcessTermination() noexcept;
+
+    /// @brief Wakes up the discovery loop by notifying the discovery condition variable
+    void triggerDiscoveryLoop() noexcept;
+
     ScopeGuard m_unregisterRelativePtr{[] { UntypedRelativePointer::unregisterAll(); }};
     bool m_killProcessesInDestructor;
     std::atomic_bool m_runMonitoringAndDiscoveryThread;
     std::atomic_bool m_runHandleRuntimeMessageThread;
 
-    popo::UserTrigger m_discoveryLoopTrigger;
     optional<UnnamedSemaphore> m_discoveryFinishedSemaphore;
 
     const units::Duration m_runtimeMessagesThreadTimeout{100_ms};
@@ -161,6 +182,7 @@ class RouDi
 
   private:
     std::thread m_monitoringAndDiscoveryThread;
+    std::thread m_processTerminationWatcherThread;
     std::thread m_handleRuntimeMessageThread;
 
   protected:
@@ -171,6 +193,7 @@ class RouDi
     roudi::MonitoringMode m_monitoringMode{roudi::MonitoringMode::ON};
     units::Duration m_processTerminationDelay;
     units::Duration m_processKillDelay;
+    uint32_t m_runtimeMessagesThreadCount{roudi::RUNTIME_MESSAGES_DEFAULT_THREAD_COUNT};
 };
 
 } // namespace roudi
@@ -56,6 +56,115 @@ class ServiceRegistry
         ReferenceCounter_t serverCount{0U};
     };
 
+    static constexpr uint32_t NO_INDEX = CAPACITY;
+
+    class Index;
+
+    /// @brief The entries of the service registry in their slots. Only the entries are published in the snapshots of
+    ///        the service registry; the hash indices are not part of them and are rebuilt by the subscribers with an
+    ///        Index, which keeps the snapshot chunks and the copies of the subscribers small.
+    class Entries
+    {
+      public:
+        /// @brief Applies a callable to all entries in the order of their slots
+        /// @param[in] callable, callable to apply to each entry
+        void forEach(function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept;
+
+      private:
+        friend class ServiceRegistry;
+        friend class Index;
+
+        vector<optional<ServiceDescriptionEntry>, CAPACITY> m_slots;
+    };
+
+    /// @brief The hash indices over the entries for exact searches and for searches with wildcards. The indices refer
+    ///        to the slots of the entries and are only valid for the Entries they were built for.
+    class Index
+    {
+      public:
+        /// @brief Rebuilds all indices for the provided entries
+        /// @param[in] entries, the entries to index
+        void build(const Entries& entries) noexcept;
+
+        /// @brief Searches for given service description in the indexed entries; an exact search or a search with
+        ///        at least one string is served by a hash index and does not depend on the number of entries. The
+        ///        matches of a search with at least one string are visited in the order in which they were added to
+        ///        the index, the matches of a search with only wildcards in the order of the slots.
+        /// @param[in] entries, the entries the index was built for
+        /// @param[in] service, string or wildcard (= iox::nullopt) to search for
+        /// @param[in] instance, string or wildcard (= iox::nullopt) to search for
+        /// @param[in] event, string or wildcard (= iox::nullopt) to search for
+        /// @param[in] callable, callable to apply to each matching entry
+        void find(const Entries& entries,
+                  const optional<capro::IdString_t>& service,
+                  const optional<capro::IdString_t>& instance,
+                  const optional<capro::IdString_t>& event,
+                  function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept;
+
+      private:
+        friend class ServiceRegistry;
+
+        /// @brief Fixed capacity hash index which maps the hash of a key to the indices of the entries in the
+        ///        registry. The entries of a bucket are doubly linked by their indices. New indices are appended to
+        ///        the bucket in order to keep the order in which the entries were added.
+        class HashIndex
+        {
+          public:
+            HashIndex() noexcept;
+
+            void clear() noexcept;
+            void insert(const uint64_t hash, const uint32_t index) noexcept;
+            void remove(const uint64_t hash, const uint32_t index) noexcept;
+
+            /// @brief Returns the first index in the bucket of the hash or NO_INDEX if the bucket is empty; the
+            ///        entries in the bucket are candidates and must still be compared with the key
+            uint32_t first(const uint64_t hash) const noexcept;
+
+            /// @brief Returns the index following the provided one in the same bucket or NO_INDEX at the end
+            uint32_t next(const uint32_t index) const noexcept;
+
+          private:
+            static constexpr uint32_t BUCKET_COUNT{CAPACITY};
+
+            uint32_t m_buckets[BUCKET_COUNT];
+            uint32_t m_bucketTails[BUCKET_COUNT];
+            uint32_t m_next[CAPACITY];
+            uint32_t m_previous[CAPACITY];
+        };
+
+        uint32_t findIndex(const Entries& entries,
+                           const capro::IdString_t& service,
+                           const capro::IdString_t& instance,
+                           const capro::IdString_t& event) const noexcept;
+
+        /// @brief Adds the entry at the index to the hash indices
+        void link(const Entries& entries, const uint32_t index) noexcept;
+
+        /// @brief Removes the entry at the index from the hash indices
+        void unlink(const Entries& entries, const uint32_t index) noexcept;
+
+        HashIndex m_serviceDescriptionIndex;
+        HashIndex m_serviceIndex;
+        HashIndex m_instanceIndex;
+        HashIndex m_eventIndex;
+    };
+
+    ServiceRegistry() noexcept = default;
+
+    /// @brief Creates a registry with the provided entries, e.g. from a published snapshot, and builds its indices
+    /// @param[in] entries, the entries of the registry
+    explicit ServiceRegistry(const Entries& entries) noexcept;
+
+    /// @brief Replaces the entries of the registry, e.g. with a published snapshot, and rebuilds its indices
+    /// @param[in] entries, the new entries of the registry
+    void assign(const Entries& entries) noexcept;
+
+    /// @brief Returns the entries of the registry without the indices, e.g. to publish them
+    const Entries& entries() const noexcept;
+
+    /// @brief Returns the indices of the registry which are valid for the entries of the registry
+    const Index& index() const noexcept;
+
     /// @brief Adds a given publisher service description to registry
     /// @param[in] serviceDescription, service to be added
     /// @return ServiceRegistryError, error wrapped in expected
@@ -81,7 +190,14 @@ class ServiceRegistry
     /// @param[in] serviceDescription, service to be removed
     void purge(const capro::ServiceDescription& serviceDescription) noexcept;
 
-    /// @brief Searches for given service description in registry
+    /// @brief Sets the counters of the entry with the service description of the provided change. The entry is added
+    ///        if it does not exist yet and removed if both counters of the change are zero
+    /// @param[in] change, the service description with the new counters
+    /// @return ServiceRegistryError, error wrapped in expected
+    expected<void, Error> applyChange(const ServiceDescriptionEntry& change) noexcept;
+
+    /// @brief Searches for given service description in registry; see Index::find for the complexity and the order
+    ///        of the matches
     /// @param[in] service, string or wildcard (= iox::nullopt) to search for
     /// @param[in] instance, string or wildcard (= iox::nullopt) to search for
     /// @param[in] event, string or wildcard (= iox::nullopt) to search for
@@ -96,31 +212,28 @@ class ServiceRegistry
     /// @note Can be used to obtain all entries or count them
     void forEach(function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept;
 
-    /// @brief Checks whether the registry data changed since the last time this method was called
-    /// @return true when the registry changed since the last call, false otherwise
-    bool hasDataChangedSinceLastCall() noexcept;
-
   private:
-    using Entry_t = optional<ServiceDescriptionEntry>;
-    using ServiceDescriptionContainer_t = vector<Entry_t, CAPACITY>;
-
-    static constexpr uint32_t NO_INDEX = CAPACITY;
-
-    ServiceDescriptionContainer_t m_serviceDescriptions;
+    Entries m_entries;
+    Index m_index;
 
     // store the last known free Index (if any is known)
     // we could use a queue (or stack) here since they are not optimal
     // for the filling pattern of a vector (prefer entries close to the front)
     uint32_t m_freeIndex{NO_INDEX};
 
-    bool m_dataChanged{true}; // initially true in order to also get notified of the empty registry
-
   private:
     uint32_t findIndex(const capro::ServiceDescription& serviceDescription) const noexcept;
 
+    /// @brief Removes the entry at the index from the hash indices and frees its slot
+    void erase(const uint32_t index) noexcept;
+
 
     expected<void, Error> add(const capro::ServiceDescription& serviceDescription,
                               ReferenceCounter_t ServiceDescriptionEntry::*count);
+
+    /// @brief Inserts an entry with zero counters for a service description which is not contained yet
+    /// @return the index of the new entry or an error if the registry is full
+    expected<uint32_t, Error> insert(const capro::ServiceDescription& serviceDescription) noexcept;
 };
 
 } // namespace roudi
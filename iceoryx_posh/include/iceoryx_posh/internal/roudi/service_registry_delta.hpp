@@ -0,0 +1,60 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_ROUDI_SERVICE_REGISTRY_DELTA_HPP
+#define IOX_POSH_ROUDI_SERVICE_REGISTRY_DELTA_HPP
+
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iox/algorithm.hpp"
+#include "iox/vector.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace roudi
+{
+/// @brief The changes of the service registry which are published by RouDi. A change is the state of an entry after
+/// the modification, an entry whose counters are both zero was removed from the service registry. Applying the
+/// changes of all deltas in the order of their sequence numbers to a snapshot of the service registry results in the
+/// current service registry.
+struct ServiceRegistryDelta
+{
+    /// @brief Maximum number of changes in one delta; more changes are split into multiple deltas
+    static constexpr uint32_t CAPACITY{16U};
+
+    /// @brief Number of deltas which are kept in the history of the publisher. A snapshot is published at the latest
+    /// after this number of deltas, therefore a late joiner can catch up from the latest snapshot with the history.
+    static constexpr uint64_t HISTORY_CAPACITY{algorithm::minVal(uint64_t{8U}, MAX_PUBLISHER_HISTORY)};
+
+    /// @brief The sequence number of the delta, it is incremented by one for every delta
+    uint64_t sequenceNumber{0U};
+
+    vector<ServiceRegistry::ServiceDescriptionEntry, CAPACITY> changes;
+};
+
+/// @brief The user header of a service registry snapshot
+struct ServiceRegistrySnapshotHeader
+{
+    /// @brief The sequence number of the last delta which is contained in the snapshot
+    uint64_t sequenceNumber{0U};
+};
+
+} // namespace roudi
+} // namespace iox
+
+#endif // IOX_POSH_ROUDI_SERVICE_REGISTRY_DELTA_HPP
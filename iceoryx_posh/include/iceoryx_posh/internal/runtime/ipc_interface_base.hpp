@@ -88,6 +88,8 @@ enum class IpcMessageType : int32_t
     WAKEUP_TRIGGER,
     REPLAY,
     MESSAGE_NOT_SUPPORTED,
+    CREATE_PORTS, // create several publisher and subscriber ports with one request
+    CREATE_PORTS_ACK,
     // etc..
     END,
 };
@@ -233,9 +235,10 @@ class IpcInterface
 
     IpcInterface(const RuntimeName_t& runtimeName, const uint64_t maxMessages, const uint64_t messageSize) noexcept;
 
-    /// @brief delete copy and move ctor and assignment since they are not needed
+    /// @brief delete copy ctor and assignment since they are not needed; the move ctor is needed to hand an opened
+    /// IPC channel over to its owner
     IpcInterface(const IpcInterface&) = delete;
-    IpcInterface(IpcInterface&&) = delete;
+    IpcInterface(IpcInterface&&) noexcept = default;
     IpcInterface& operator=(const IpcInterface&) = delete;
     IpcInterface& operator=(IpcInterface&&) = delete;
 
@@ -245,6 +248,12 @@ class IpcInterface
     /// @return answer.isValid()
     static bool setMessageFromString(const char* buffer, IpcMessage& answer) noexcept;
 
+    /// @brief Set the content of answer from buffer by taking over the received string.
+    /// @param[in] buffer Raw message as received from the IPC channel
+    /// @param[out] answer Raw message is setting this IpcMessage
+    /// @return answer.isValid()
+    static bool setMessageFromString(std::string&& buffer, IpcMessage& answer) noexcept;
+
     /// @brief Opens a IPC channel and default permissions
     ///         stored in m_perms and stores the descriptor
     /// @param[in] channelSide of the queue. SERVER will also destroy the IPC channel in the dTor, while CLIENT
@@ -40,12 +40,15 @@ class IpcInterfaceUser : public IpcInterfaceBase
 
     /// @brief The copy constructor and assignment operator are deleted since
     ///         this class manages a resource (IPC channel) which cannot
-    ///         be copied. Since move is not needed it is also deleted.
+    ///         be copied.
     IpcInterfaceUser(const IpcInterfaceUser&) = delete;
     IpcInterfaceUser& operator=(const IpcInterfaceUser&) = delete;
 
+    /// @brief The move constructor allows to open the IPC channel before it is handed over to its owner, e.g. RouDi
+    ///         opens the channel of a registering process before the process is added to the ProcessManager
+    IpcInterfaceUser(IpcInterfaceUser&&) noexcept = default;
+
     /// @brief Not needed therefore deleted
-    IpcInterfaceUser(IpcInterfaceUser&&) = delete;
     IpcInterfaceUser& operator=(IpcInterfaceUser&&) = delete;
 };
 
@@ -18,10 +18,13 @@
 #define IOX_POSH_RUNTIME_IPC_MESSAGE_HPP
 
 #include "iox/logging.hpp"
+#include "iox/string.hpp"
 
 #include <cstdint>
+#include <cstring>
 #include <sstream>
 #include <string>
+#include <type_traits>
 
 namespace iox
 {
@@ -75,8 +78,47 @@ class IpcMessage
     /// @return If the element exists it returns the element at f_index
     ///         otherwise an empty string
     //          If the message is invalid the return value is undefined.
+    /// @note Every call searches the entry from the beginning of the message,
+    ///         use a Cursor to read several entries in ascending order.
     std::string getElementAtIndex(const uint32_t index) const noexcept;
 
+    /// @brief Reads the entries of an IpcMessage in ascending order. Every
+    ///         entry is searched from the end of the previous one, therefore
+    ///         reading all entries is linear in the length of the message.
+    ///         A Cursor does not modify the message, several Cursors can
+    ///         read the same message concurrently. The message must outlive
+    ///         the Cursor and must not be modified while it is read.
+    class Cursor
+    {
+      public:
+        /// @brief Creates a Cursor which starts reading at the entry at index
+        /// @param[in] message whose entries are read
+        /// @param[in] index of the first entry to read
+        explicit Cursor(const IpcMessage& message, const uint32_t index = 0U) noexcept;
+
+        /// @brief A Cursor of a temporary message would dangle
+        Cursor(IpcMessage&& message, const uint32_t index = 0U) = delete;
+
+        /// @brief Returns the current entry and advances to the next one
+        /// @return the current entry or std::string() if all entries were
+        ///         read
+        std::string next() noexcept;
+
+        /// @brief Advances over entries without copying them. Skipping beyond
+        ///         the last entry ends the reading.
+        /// @param[in] numberOfEntries number of entries to skip
+        void skip(const uint32_t numberOfEntries) noexcept;
+
+        /// @brief Returns the number of entries which were not read yet
+        /// @return number of remaining entries
+        uint32_t getNumberOfRemainingElements() const noexcept;
+
+      private:
+        const IpcMessage& m_message;
+        uint32_t m_index{0U};
+        uint64_t m_offset{0U};
+    };
+
     /// @brief returns if an entry is valid.
     ///      Non valid entries are containing at least one separator
     /// @param[in] entry sstring to check
@@ -94,6 +136,11 @@ class IpcMessage
     /// @return the current message as separator separated string
     std::string getMessage() const noexcept;
 
+    /// @brief Returns the length of the separator separated string without
+    ///         copying it
+    /// @return the number of characters of the current message
+    uint64_t getMessageSize() const noexcept;
+
     /// @brief Takes a separator separated string and interprets it as
     ///      a IpcMessage. In this case the IpcMessage can only become
     ///      invalid if it is not empty and does not end with the separator.
@@ -102,6 +149,11 @@ class IpcMessage
     /// @param[in] separator separated string for the message
     void setMessage(const std::string& msg) noexcept;
 
+    /// @brief Same as setMessage(const std::string&) but takes over the
+    ///      buffer of the provided string instead of copying it.
+    /// @param[in] separator separated string for the message
+    void setMessage(std::string&& msg) noexcept;
+
     /// @brief Clears the message. After a call to clearMessage() the
     //      message becomes valid again.
     void clearMessage() noexcept;
@@ -114,15 +166,28 @@ class IpcMessage
     template <typename T>
     void addEntry(const T& entry) noexcept;
 
+    /// @brief Appends all entries of another IpcMessage. If the other
+    ///         IpcMessage is invalid no entry is added and the IpcMessage
+    ///         becomes invalid.
+    /// @param[in] msg IpcMessage whose entries are appended
+    void addEntries(const IpcMessage& msg) noexcept;
+
     /// @brief Compares two IpcMessages to be equal
     /// @param rhs IpcMessage to compare with
     bool operator==(const IpcMessage& rhs) const noexcept;
 
   private:
+    /// @brief Appends an entry which is already available as character sequence
+    ///         without going through a std::stringstream.
+    void addEntry(const char* entry, const uint64_t size) noexcept;
+
+    /// @brief Validates a message which was set as a whole and counts its entries
+    void tokenize() noexcept;
+
     static const char m_separator; // default value is ,
     std::string m_msg;
     bool m_isValid{true};
-    uint32_t m_numberOfElements{0};
+    uint32_t m_numberOfElements{0U};
 };
 
 } // namespace runtime
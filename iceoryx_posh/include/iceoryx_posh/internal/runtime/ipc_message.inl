@@ -26,18 +26,31 @@ namespace runtime
 template <typename T>
 void IpcMessage::addEntry(const T& entry) noexcept
 {
-    std::stringstream newEntry;
-    newEntry << entry;
-
-    if (!isValidEntry(newEntry.str()))
+    // most entries are strings or integers; they are appended directly since a std::stringstream per entry
+    // dominates the cost of assembling a request
+    if constexpr (std::is_same<T, std::string>::value || is_iox_string<T>::value)
+    {
+        addEntry(entry.c_str(), entry.size());
+    }
+    else if constexpr (is_char_array<T>::value)
+    {
+        addEntry(&entry[0], strnlen(&entry[0], sizeof(T)));
+    }
+    else if constexpr (std::is_same<T, const char*>::value || std::is_same<T, char*>::value)
+    {
+        addEntry(entry, std::strlen(entry));
+    }
+    else if constexpr (std::is_integral<T>::value && !std::is_same<T, bool>::value && (sizeof(T) > 1U))
     {
-        IOX_LOG(ERROR, "\'" << newEntry.str().c_str() << "\' is an invalid IPC channel entry");
-        m_isValid = false;
+        const auto newEntry = std::to_string(entry);
+        addEntry(newEntry.c_str(), newEntry.size());
     }
     else
     {
-        m_msg.append(newEntry.str() + m_separator);
-        ++m_numberOfElements;
+        std::stringstream newEntry;
+        newEntry << entry;
+        const auto newEntryString = newEntry.str();
+        addEntry(newEntryString.c_str(), newEntryString.size());
     }
 }
 
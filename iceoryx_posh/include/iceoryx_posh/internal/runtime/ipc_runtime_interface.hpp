@@ -58,6 +58,10 @@ class IpcRuntimeInterface
     /// @return size in bytes
     size_t getShmTopicSize() noexcept;
 
+    /// @brief checks whether the management shared memory object must be locked in RAM after mapping
+    /// @return true if RouDi locked the management shared memory object in RAM
+    bool isShmLockedInMemory() const noexcept;
+
     /// @brief get the segment id of the shared memory object
     /// @return segment id
     uint64_t getSegmentId() const noexcept;
@@ -85,6 +89,7 @@ class IpcRuntimeInterface
     IpcInterfaceUser m_RoudiIpcInterface;
     uint64_t m_shmTopicSize{0U};
     uint64_t m_segmentId{0U};
+    bool m_lockShmInMemory{false};
     optional<UntypedRelativePointer::offset_t> m_heartbeatAddressOffset;
 };
 
@@ -57,6 +57,9 @@ class PoshRuntimeImpl : public PoshRuntime
                             const popo::SubscriberOptions& subscriberOptions = popo::SubscriberOptions(),
                             const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept override;
 
+    /// @copydoc PoshRuntime::getMiddlewarePorts
+    void getMiddlewarePorts(PortBatch& batch) noexcept override;
+
     /// @copydoc PoshRuntime::getMiddlewareClient
     popo::ClientPortUser::MemberType_t*
     getMiddlewareClient(const capro::ServiceDescription& service,
@@ -91,6 +94,17 @@ class PoshRuntimeImpl : public PoshRuntime
                     const RuntimeLocation location = RuntimeLocation::SEPARATE_PROCESS_FROM_ROUDI) noexcept;
 
   private:
+    popo::PublisherOptions preparePublisherOptions(const popo::PublisherOptions& publisherOptions) const noexcept;
+
+    popo::SubscriberOptions prepareSubscriberOptions(const capro::ServiceDescription& service,
+                                                     const popo::SubscriberOptions& subscriberOptions) const noexcept;
+
+    void handlePublisherRequestError(const capro::ServiceDescription& service,
+                                     const IpcMessageErrorType error) const noexcept;
+
+    void handleSubscriberRequestError(const capro::ServiceDescription& service,
+                                      const IpcMessageErrorType error) const noexcept;
+
     expected<PublisherPortUserType::MemberType_t*, IpcMessageErrorType>
     requestPublisherFromRoudi(const IpcMessage& sendBuffer) noexcept;
 
@@ -106,8 +120,23 @@ class PoshRuntimeImpl : public PoshRuntime
     expected<popo::ConditionVariableData*, IpcMessageErrorType>
     requestConditionVariableFromRoudi(const IpcMessage& sendBuffer) noexcept;
 
+    /// @brief sends the CREATE_PORTS request for the batch entries [begin, end) and stores the created ports
+    void requestPortsFromRoudi(const IpcMessage& sendBuffer,
+                               PortBatch& batch,
+                               const uint64_t begin,
+                               const uint64_t end) noexcept;
+
+    /// @brief reads the response for a single port of a CREATE_PORTS_ACK from the cursor, which afterwards points to
+    ///        the response of the next port
+    expected<void*, IpcMessageErrorType> convertPortResponse(IpcMessage::Cursor& cursor,
+                                                             const PortBatch::PortKind kind) noexcept;
+
+    expected<std::tuple<segment_id_underlying_t, UntypedRelativePointer::offset_t>, IpcMessageErrorType>
+    convert_id_and_offset(const IpcMessage& msg, const uint32_t offsetIndex = 1U);
+
+    /// @brief reads the offset and the segment id which follows it from the cursor
     expected<std::tuple<segment_id_underlying_t, UntypedRelativePointer::offset_t>, IpcMessageErrorType>
-    convert_id_and_offset(IpcMessage& msg);
+    convert_id_and_offset(IpcMessage::Cursor& cursor);
 
     mutable optional<mutex> m_appIpcRequestMutex;
 
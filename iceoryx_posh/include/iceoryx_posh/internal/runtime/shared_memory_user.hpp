@@ -38,9 +38,12 @@ class SharedMemoryUser
     /// @param[in] segmentManagerAddr adress of the segment manager that does the final mapping of memory in the process
     /// @param[in] segmentId of the relocatable shared memory segment
     /// address space
+    /// @param[in] lockInMemory locks the pages of the management segment in RAM after mapping; the data segments
+    /// are locked as configured for each segment in RouDi
     SharedMemoryUser(const size_t topicSize,
                      const uint64_t segmentId,
-                     const UntypedRelativePointer::offset_t segmentManagerAddressOffset) noexcept;
+                     const UntypedRelativePointer::offset_t segmentManagerAddressOffset,
+                     const bool lockInMemory = false) noexcept;
 
   private:
     void openDataSegments(const uint64_t segmentId,
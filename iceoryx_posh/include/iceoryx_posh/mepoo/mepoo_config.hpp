@@ -29,6 +29,16 @@ class PortManager;
 }
 namespace mepoo
 {
+/// @brief Defines from which mempool a chunk is acquired
+/// BEST_FIT - the chunk is only acquired from the smallest mempool with fitting chunks
+/// FALL_THROUGH_TO_LARGER_MEMPOOL - if the best fitting mempool is exhausted, the chunk is acquired from the next
+/// larger mempool which has free chunks
+enum class MemPoolAllocationPolicy : uint8_t
+{
+    BEST_FIT,
+    FALL_THROUGH_TO_LARGER_MEMPOOL
+};
+
 struct MePooConfig
 {
   public:
@@ -46,6 +56,7 @@ struct MePooConfig
 
     using MePooConfigContainerType = vector<Entry, MAX_NUMBER_OF_MEMPOOLS>;
     MePooConfigContainerType m_mempoolConfig;
+    MemPoolAllocationPolicy m_allocationPolicy{MemPoolAllocationPolicy::BEST_FIT};
 
     /// @brief Default constructor to set the configuration for memory pools
     MePooConfig() noexcept = default;
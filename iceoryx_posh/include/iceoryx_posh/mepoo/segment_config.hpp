@@ -20,13 +20,40 @@
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/optional.hpp"
 #include "iox/posix_group.hpp"
+#include "iox/posix_shared_memory_object.hpp"
+#include "iox/string.hpp"
 #include "iox/vector.hpp"
 
 namespace iox
 {
 namespace mepoo
 {
+/// @brief The size of the pages which back the memory of a segment
+enum class HugePageSize : uint8_t
+{
+    /// @brief regular pages of the system
+    NONE,
+    SIZE_2MB,
+    SIZE_1GB,
+};
+
+/// @brief the mount point of a hugetlbfs
+using HugePageMount_t = string<platform::IOX_MAX_PATH_LENGTH>;
+
+/// @brief returns the size of a huge page in bytes; zero for HugePageSize::NONE
+uint64_t hugePageSizeInBytes(const HugePageSize hugePageSize) noexcept;
+
+/// @brief returns the mount point of the hugetlbfs which is used for a huge page size if none is configured
+/// @return the common mount point of the hugetlbfs for the given huge page size; nullopt for HugePageSize::NONE
+optional<HugePageMount_t> defaultHugePageMount(const HugePageSize hugePageSize) noexcept;
+
+/// @brief checks whether a directory is on a hugetlbfs with huge pages of the given size
+/// @return true if segments with the given huge page size can be created in the directory; false for
+/// HugePageSize::NONE, for other file systems, for a hugetlbfs with another page size or when the check fails
+bool isHugePageMount(const HugePageMount_t& directory, const HugePageSize hugePageSize) noexcept;
+
 struct SegmentConfig
 {
     struct SegmentEntry
@@ -47,6 +74,23 @@ struct SegmentConfig
         PosixGroup::groupName_t m_writerGroup;
         MePooConfig m_mempoolConfig;
         iox::mepoo::MemoryInfo m_memoryInfo;
+        /// @brief number of threads which zero and prefault the segment on creation; large segments are created
+        ///        considerably faster with multiple threads
+        uint32_t m_zeroingThreadCount{SHM_SEGMENT_DEFAULT_ZEROING_THREAD_COUNT};
+        /// @brief the size of the huge pages which back the segment; if no huge pages are available, the segment
+        ///        falls back to regular pages
+        HugePageSize m_hugePageSize{HugePageSize::NONE};
+        /// @brief the mount point of a hugetlbfs with pages of m_hugePageSize; if empty, the default mount point
+        ///        of the huge page size is used
+        HugePageMount_t m_hugePageMount;
+        /// @brief the NUMA memory policy which places the pages of the segment before they are prefaulted; with
+        ///        the default policy the pages are placed on the nodes of the zeroing threads of RouDi
+        NumaMemoryPolicy m_numaPolicy{NumaMemoryPolicy::DEFAULT};
+        /// @brief the NUMA nodes for m_numaPolicy with one bit per node, e.g. 0b10 for node 1
+        uint64_t m_numaNodeMask{0U};
+        /// @brief locks the pages of the segment in RAM in RouDi and in every application which maps the segment,
+        ///        so that accessing a chunk never causes a major page fault; requires a sufficient RLIMIT_MEMLOCK
+        bool m_lockInMemory{false};
     };
 
     vector<SegmentEntry, MAX_SHM_SEGMENTS> m_sharedMemorySegments;
@@ -22,6 +22,7 @@
 #include "iceoryx_posh/popo/notification_attorney.hpp"
 #include "iceoryx_posh/popo/notification_callback.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
+#include "iceoryx_posh/popo/wait_strategy.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iox/detail/mpmc_loffli.hpp"
 #include "iox/expected.hpp"
@@ -102,6 +103,10 @@ class Listener
 {
   public:
     Listener() noexcept;
+
+    /// @brief Creates a Listener whose background thread waits with the provided wait strategy
+    /// @param[in] waitStrategy defines whether and how long the Listener polls for notifications before blocking
+    explicit Listener(const WaitStrategy& waitStrategy) noexcept;
     Listener(const Listener&) = delete;
     Listener(Listener&&) = delete;
     ~Listener() noexcept;
@@ -167,7 +172,7 @@ class Listener
     uint64_t size() const noexcept;
 
   protected:
-    Listener(ConditionVariableData& conditionVariableData) noexcept;
+    Listener(ConditionVariableData& conditionVariableData, const WaitStrategy& waitStrategy = WaitStrategy()) noexcept;
 
   private:
     class Event_t;
@@ -18,6 +18,7 @@
 #define IOX_POSH_POPO_PUBLISHER_OPTIONS_HPP
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iox/duration.hpp"
 #include "iox/expected.hpp"
 #include "port_queue_policies.hpp"
 
@@ -44,9 +45,21 @@ struct PublisherOptions
     /// @brief The option whether the publisher should block when the subscriber queue is full
     ConsumerTooSlowPolicy subscriberTooSlowPolicy{ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA};
 
+    /// @brief The number of chunks the publisher reserves in advance with a single mempool access, limited to
+    /// MAX_CHUNK_MAGAZINE_CAPACITY. This reduces the contention on the mempools for publishers with a high sample rate
+    /// and a constant sample size, but the reserved chunks are not available for other publishers. 0 disables it
+    uint32_t chunkMagazineCapacity{0U};
+
+    /// @brief The maximum time a publisher with ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER waits for space in the queue
+    /// of a subscriber with QueueFullPolicy::BLOCK_PRODUCER. When it expires, the sample is not delivered to the
+    /// subscribers whose queues are still full, like for a subscriber which does not block the producer.
+    /// units::Duration::max() waits indefinitely
+    units::Duration subscriberTooSlowTimeout{units::Duration::max()};
+
     /// @brief serialization of the PublisherOptions
     Serialization serialize() const noexcept;
-    /// @brief deserialization of the PublisherOptions
+    /// @brief deserialization of the PublisherOptions; a serialization without the subscriberTooSlowTimeout or the
+    /// chunkMagazineCapacity, e.g. from a runtime which is not aware of them, is accepted with the default values
     static expected<PublisherOptions, Serialization::Error> deserialize(const Serialization& serialized) noexcept;
 };
 
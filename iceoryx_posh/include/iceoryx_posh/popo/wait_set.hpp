@@ -26,6 +26,7 @@
 #include "iceoryx_posh/popo/notification_info.hpp"
 #include "iceoryx_posh/popo/trigger.hpp"
 #include "iceoryx_posh/popo/trigger_handle.hpp"
+#include "iceoryx_posh/popo/wait_strategy.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
 #include "iox/algorithm.hpp"
 #include "iox/function.hpp"
@@ -60,6 +61,10 @@ class WaitSet
     using NotificationInfoVector = vector<const NotificationInfo*, CAPACITY>;
 
     WaitSet() noexcept;
+
+    /// @brief Creates a WaitSet which waits with the provided wait strategy
+    /// @param[in] waitStrategy defines whether and how long the WaitSet polls for notifications before blocking
+    explicit WaitSet(const WaitStrategy& waitStrategy) noexcept;
     ~WaitSet() noexcept;
 
     /// @brief all the Trigger have a pointer pointing to this waitset for cleanup
@@ -207,7 +212,7 @@ class WaitSet
     static constexpr uint64_t capacity() noexcept;
 
   protected:
-    explicit WaitSet(ConditionVariableData& condVarData) noexcept;
+    explicit WaitSet(ConditionVariableData& condVarData, const WaitStrategy& waitStrategy = WaitStrategy()) noexcept;
 
   private:
     enum class NoStateEnumUsed : StateEnumIdentifier
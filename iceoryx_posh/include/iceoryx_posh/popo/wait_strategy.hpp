@@ -0,0 +1,67 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_POPO_WAIT_STRATEGY_HPP
+#define IOX_POSH_POPO_WAIT_STRATEGY_HPP
+
+#include "iox/duration.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace popo
+{
+/// @brief Hint which is given to the CPU in every iteration while busy polling for notifications
+enum class SpinHint : uint8_t
+{
+    /// @brief polls without any hint
+    NONE,
+    /// @brief executes a pause instruction (e.g. 'pause' on x86, 'yield' on aarch64) to reduce the power consumption
+    /// and the pressure on the sibling hyper-thread
+    PAUSE,
+    /// @brief gives the remaining time slice to another thread
+    YIELD
+};
+
+/// @brief This struct is used to configure how a WaitSet or a Listener waits for notifications. Before blocking on
+/// the semaphore the active notifications are busy polled until one of the limits is reached. This trades CPU time
+/// for a lower wake-up latency since the sleep/wake round-trip through the kernel is avoided when a notification
+/// arrives while spinning.
+/// @note The default configuration blocks immediately.
+struct WaitStrategy
+{
+    /// @brief The maximum number of polling iterations before blocking; 0 means no limit by iterations
+    uint64_t maxSpinIterations{0U};
+
+    /// @brief The maximum duration of polling before blocking; 0 means no limit by duration
+    /// @note If maxSpinIterations and maxSpinDuration are both 0, no polling is done at all
+    units::Duration maxSpinDuration{units::Duration::zero()};
+
+    /// @brief The hint which is given in every polling iteration
+    SpinHint spinHint{SpinHint::PAUSE};
+
+    /// @brief Returns true if the wait strategy polls before blocking
+    constexpr bool isSpinning() const noexcept
+    {
+        return maxSpinIterations != 0U || maxSpinDuration != units::Duration::zero();
+    }
+};
+
+} // namespace popo
+} // namespace iox
+
+#endif // IOX_POSH_POPO_WAIT_STRATEGY_HPP
@@ -31,6 +31,7 @@ struct CmdLineArgs_t
     bool run{true};
     iox::log::LogLevel logLevel{iox::log::LogLevel::INFO};
     roudi::MonitoringMode monitoringMode{roudi::MonitoringMode::OFF};
+    roudi::ProcessExitDetection processExitDetection{roudi::ProcessExitDetection::HEARTBEAT};
     version::CompatibilityCheckLevel compatibilityCheckLevel{version::CompatibilityCheckLevel::PATCH};
     optional<uint16_t> uniqueRouDiId{nullopt};
     units::Duration processTerminationDelay{roudi::PROCESS_DEFAULT_TERMINATION_DELAY};
@@ -42,6 +43,7 @@ inline iox::log::LogStream& operator<<(iox::log::LogStream& logstream, const Cmd
 {
     logstream << "Log level: " << cmdLineArgs.logLevel << "\n";
     logstream << "Monitoring mode: " << cmdLineArgs.monitoringMode << "\n";
+    logstream << "Process exit detection: " << cmdLineArgs.processExitDetection << "\n";
     logstream << "Compatibility check level: " << cmdLineArgs.compatibilityCheckLevel << "\n";
     cmdLineArgs.uniqueRouDiId.and_then([&logstream](auto& id) { logstream << "Unique RouDi ID: " << id << "\n"; })
         .or_else([&logstream] { logstream << "Unique RouDi ID: < unset >\n"; });
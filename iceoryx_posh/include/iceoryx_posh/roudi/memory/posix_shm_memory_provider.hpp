@@ -40,7 +40,11 @@ class PosixShmMemoryProvider : public MemoryProvider
     /// @param [in] shmName is the name of the posix share memory
     /// @param [in] accessMode defines the read and write access to the memory
     /// @param [in] openMode defines the creation/open mode of the shared memory.
-    PosixShmMemoryProvider(const ShmName_t& shmName, const AccessMode accessMode, const OpenMode openMode) noexcept;
+    /// @param [in] lockInMemory defines if the pages of the shared memory are locked in RAM
+    PosixShmMemoryProvider(const ShmName_t& shmName,
+                           const AccessMode accessMode,
+                           const OpenMode openMode,
+                           const bool lockInMemory = false) noexcept;
     ~PosixShmMemoryProvider() noexcept;
 
     PosixShmMemoryProvider(PosixShmMemoryProvider&&) = delete;
@@ -49,6 +53,9 @@ class PosixShmMemoryProvider : public MemoryProvider
     PosixShmMemoryProvider(const PosixShmMemoryProvider&) = delete;
     PosixShmMemoryProvider& operator=(const PosixShmMemoryProvider&) = delete;
 
+    /// @brief Returns true if the pages of the shared memory are locked in RAM
+    bool isLockedInMemory() const noexcept;
+
   protected:
     /// @copydoc MemoryProvider::createMemory
     /// @note This creates and maps a POSIX shared memory to the address space of the application
@@ -62,6 +69,7 @@ class PosixShmMemoryProvider : public MemoryProvider
     ShmName_t m_shmName;
     AccessMode m_accessMode{AccessMode::READ_ONLY};
     OpenMode m_openMode{OpenMode::OPEN_EXISTING};
+    bool m_lockInMemory{false};
     optional<PosixSharedMemoryObject> m_shmObject;
 
     static constexpr access_rights SHM_MEMORY_PERMISSIONS =
@@ -71,6 +71,10 @@ class PortPool
     PortPoolData::NodeContainer& getNodeDataList() noexcept;
     PortPoolData::CondVarContainer& getConditionVariableDataList() noexcept;
 
+    /// @brief Returns the condition variable which is notified by all ports when a state change is requested
+    /// @return reference to the discovery condition variable
+    popo::ConditionVariableData& getDiscoveryConditionVariable() noexcept;
+
     expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
     addPublisherPort(const capro::ServiceDescription& serviceDescription,
                      mepoo::MemoryManager* const memoryManager,
@@ -53,6 +53,7 @@ class RouDiApp
 
     iox::log::LogLevel m_logLevel{iox::log::LogLevel::WARN};
     roudi::MonitoringMode m_monitoringMode{roudi::MonitoringMode::ON};
+    roudi::ProcessExitDetection m_processExitDetection{roudi::ProcessExitDetection::HEARTBEAT};
     bool m_run{true};
     RouDiConfig_t m_config;
 
@@ -31,8 +31,14 @@ struct RouDiConfig
     // introspection samples
     uint32_t introspectionChunkCount{10};
 
+    // service registry snapshots and deltas which can be in use by the subscribers; a ServiceDiscovery copies a
+    // snapshot into its local view and releases it right away, the delta publisher additionally holds its history
     uint32_t discoveryChunkCount{10};
 
+    // locks the management segment in RAM in RouDi and in every application; the port queues and the heartbeats
+    // are located there, therefore a major page fault on them delays every publish and take
+    bool lockManagementSegmentInMemory{false};
+
     RouDiConfig& setDefaults() noexcept;
     RouDiConfig& optimize() noexcept;
 };
@@ -35,6 +35,12 @@ namespace roudi
 /// MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED - the max number of mempools per segment is exceeded
 /// MEMPOOL_WITHOUT_CHUNK_SIZE - chunk size not specified for the mempool
 /// MEMPOOL_WITHOUT_CHUNK_COUNT - chunk count not specified for the mempool
+/// INVALID_MEMPOOL_ALLOCATION_POLICY - the allocation policy of a segment is neither "best-fit" nor "fall-through"
+/// INVALID_SEGMENT_ZEROING_THREAD_COUNT - the number of zeroing threads of a segment is zero or exceeds the maximum
+/// INVALID_HUGE_PAGE_SIZE - the huge page size of a segment is neither "none", "2M" nor "1G"
+/// INVALID_HUGE_PAGE_MOUNT - the huge page mount of a segment is not a valid path to a directory
+/// INVALID_NUMA_POLICY - the NUMA policy of a segment is neither "default", "bind" nor "interleave"
+/// INVALID_NUMA_NODES - the NUMA nodes of a segment are missing for its NUMA policy or a node is out of range
 enum class RouDiConfigFileParseError
 {
     FILE_OPEN_FAILED,
@@ -46,6 +52,12 @@ enum class RouDiConfigFileParseError
     MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED,
     MEMPOOL_WITHOUT_CHUNK_SIZE,
     MEMPOOL_WITHOUT_CHUNK_COUNT,
+    INVALID_MEMPOOL_ALLOCATION_POLICY,
+    INVALID_SEGMENT_ZEROING_THREAD_COUNT,
+    INVALID_HUGE_PAGE_SIZE,
+    INVALID_HUGE_PAGE_MOUNT,
+    INVALID_NUMA_POLICY,
+    INVALID_NUMA_NODES,
     EXCEPTION_IN_PARSER
 };
 
@@ -58,6 +70,12 @@ constexpr const char* ROUDI_CONFIG_FILE_PARSE_ERROR_STRINGS[] = {"FILE_OPEN_FAIL
                                                                  "MAX_NUMBER_OF_MEMPOOLS_PER_SEGMENT_EXCEEDED",
                                                                  "MEMPOOL_WITHOUT_CHUNK_SIZE",
                                                                  "MEMPOOL_WITHOUT_CHUNK_COUNT",
+                                                                 "INVALID_MEMPOOL_ALLOCATION_POLICY",
+                                                                 "INVALID_SEGMENT_ZEROING_THREAD_COUNT",
+                                                                 "INVALID_HUGE_PAGE_SIZE",
+                                                                 "INVALID_HUGE_PAGE_MOUNT",
+                                                                 "INVALID_NUMA_POLICY",
+                                                                 "INVALID_NUMA_NODES",
                                                                  "EXCEPTION_IN_PARSER"};
 
 /// @brief Base class for a config file provider.
@@ -0,0 +1,120 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#ifndef IOX_POSH_RUNTIME_PORT_BATCH_HPP
+#define IOX_POSH_RUNTIME_PORT_BATCH_HPP
+
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/popo/ports/publisher_port_user.hpp"
+#include "iceoryx_posh/internal/popo/ports/subscriber_port_user.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/optional.hpp"
+#include "iox/vector.hpp"
+
+#include <cstdint>
+
+namespace iox
+{
+namespace runtime
+{
+/// @brief Collects the descriptions of several publisher and subscriber ports which are created together by
+///        PoshRuntime::getMiddlewarePorts. Instead of one request/response exchange with RouDi per port, the
+///        ports are requested with as few exchanges as the IPC channel message size allows.
+/// @note A request is bounded by ROUDI_MESSAGE_SIZE (512 bytes) and contains the serialized service description,
+///       options and port config info of every port. A port needs about 50 bytes plus 4 bytes per character of its
+///       service, instance, event and node name, i.e. a request carries about 8 ports with single character
+///       names, 3 ports with names of 20 characters and only a single port once the names exceed about 50
+///       characters. The batch saves round trips for many ports with short names, with long names it degrades to
+///       one exchange per port. The creation of the ports in RouDi is not batched and dominates an exchange,
+///       therefore the saved round trips only shorten the total time of creating many ports slightly.
+/// @code
+///     PortBatch batch;
+///     auto radarIndex = batch.addPublisher({"Radar", "FrontLeft", "Object"});
+///     auto lidarIndex = batch.addSubscriber({"Lidar", "Roof", "PointCloud"});
+///     PoshRuntime::getInstance().getMiddlewarePorts(batch);
+///     auto* radarPort = batch[radarIndex.value()].publisherPort;
+/// @endcode
+class PortBatch
+{
+  public:
+    static constexpr uint64_t CAPACITY{32U};
+
+    enum class PortKind : uint8_t
+    {
+        PUBLISHER,
+        SUBSCRIBER,
+    };
+
+    /// @brief The description of a single port of the batch and, after PoshRuntime::getMiddlewarePorts, the created
+    ///        port; the port of the respective kind stays a nullptr if it could not be created
+    struct Entry
+    {
+        PortKind kind{PortKind::PUBLISHER};
+        capro::ServiceDescription service;
+        popo::PublisherOptions publisherOptions;
+        popo::SubscriberOptions subscriberOptions;
+        PortConfigInfo portConfigInfo;
+        PublisherPortUserType::MemberType_t* publisherPort{nullptr};
+        SubscriberPortUserType::MemberType_t* subscriberPort{nullptr};
+    };
+
+    /// @brief adds the description of a publisher port to the batch
+    /// @param[in] service service description for the new publisher port
+    /// @param[in] publisherOptions like the history capacity of a publisher
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @return the index of the entry, nullopt if the batch is full
+    optional<uint64_t> addPublisher(const capro::ServiceDescription& service,
+                                    const popo::PublisherOptions& publisherOptions = {},
+                                    const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief adds the description of a subscriber port to the batch
+    /// @param[in] service service description for the new subscriber port
+    /// @param[in] subscriberOptions like the queue capacity and history requested by a subscriber
+    /// @param[in] portConfigInfo configuration information for the port
+    /// @return the index of the entry, nullopt if the batch is full
+    optional<uint64_t> addSubscriber(const capro::ServiceDescription& service,
+                                     const popo::SubscriberOptions& subscriberOptions = {},
+                                     const PortConfigInfo& portConfigInfo = {}) noexcept;
+
+    /// @brief returns the number of entries in the batch
+    uint64_t size() const noexcept;
+
+    /// @brief returns true if the batch contains no entries
+    bool empty() const noexcept;
+
+    /// @brief removes all entries from the batch
+    void clear() noexcept;
+
+    /// @brief access to the entry at the given index; terminates if the index is out of bounds
+    /// @param[in] index of the entry
+    Entry& operator[](const uint64_t index) noexcept;
+
+    /// @copydoc PortBatch::operator[](const uint64_t)
+    const Entry& operator[](const uint64_t index) const noexcept;
+
+  private:
+    optional<uint64_t> add(Entry&& entry) noexcept;
+
+    vector<Entry, CAPACITY> m_entries;
+};
+
+} // namespace runtime
+} // namespace iox
+
+#endif // IOX_POSH_RUNTIME_PORT_BATCH_HPP
@@ -30,6 +30,7 @@
 #include "iceoryx_posh/popo/client_options.hpp"
 #include "iceoryx_posh/popo/server_options.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/runtime/port_batch.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
 #include "iox/optional.hpp"
 #include "iox/scope_guard.hpp"
@@ -135,6 +136,13 @@ class PoshRuntime
                         const popo::ServerOptions& serverOptions = {},
                         const PortConfigInfo& portConfigInfo = PortConfigInfo()) noexcept = 0;
 
+    /// @brief request the RouDi daemon to create all publisher and subscriber ports of a batch
+    /// @details The default implementation requests one port after another; runtimes which are connected to RouDi
+    /// via IPC override it to create several ports with a single request/response exchange; the number of ports
+    /// per exchange is bounded by the IPC message size, see PortBatch
+    /// @param[in,out] batch descriptions of the ports to create; the created ports are stored in the batch entries
+    virtual void getMiddlewarePorts(PortBatch& batch) noexcept;
+
     /// @brief request the RouDi daemon to create an interface port
     /// @param[in] interface interface to create
     /// @param[in] nodeName name of the node where the interface should belong to
@@ -19,8 +19,11 @@
 
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry_delta.hpp"
 #include "iceoryx_posh/popo/subscriber.hpp"
 #include "iceoryx_posh/runtime/posh_runtime.hpp"
+#include "iox/function.hpp"
+#include "iox/optional.hpp"
 
 #include <memory>
 #include <mutex>
@@ -44,6 +47,10 @@ enum class ServiceDiscoveryEvent : popo::EventEnumIdentifier
 class ServiceDiscovery
 {
   public:
+    /// @brief Callback which is called with the new state of a changed service; the counters of a removed service
+    /// are zero
+    using ServiceChangeCallback = function<void(const roudi::ServiceRegistry::ServiceDescriptionEntry&)>;
+
     ServiceDiscovery() noexcept;
 
     ServiceDiscovery(const ServiceDiscovery&) = delete;
@@ -59,12 +66,24 @@ class ServiceDiscovery
     /// @param[in] event event string to search for, a nullopt corresponds to a wildcard
     /// @param[in] callableForEach callable to apply to all matching services
     /// @param[in] pattern messaging pattern of the service to search
+    /// @note The search is done on a local view of the service registry which is initialized with a snapshot and kept
+    /// up to date with the published changes; the callable is called while the view is locked and must therefore not
+    /// call findService
     void findService(const optional<capro::IdString_t>& service,
                      const optional<capro::IdString_t>& instance,
                      const optional<capro::IdString_t>& event,
                      const function_ref<void(const capro::ServiceDescription&)> callableForEach,
                      const popo::MessagingPattern pattern) noexcept;
 
+    /// @brief Sets a callback which is called for every change of the local view of the service registry. The local
+    /// view is updated with every call to findService.
+    /// @param[in] callback the callback which is called for each changed service
+    /// @note The callback is called while the local view is locked and must therefore not call findService
+    void setServiceChangeCallback(const ServiceChangeCallback& callback) noexcept;
+
+    /// @brief Removes the callback which was set with setServiceChangeCallback
+    void resetServiceChangeCallback() noexcept;
+
     friend iox::popo::NotificationAttorney;
 
   private:
@@ -74,16 +93,38 @@ class ServiceDiscovery
     iox::popo::WaitSetIsConditionSatisfiedCallback
     getCallbackForIsStateConditionSatisfied(const popo::SubscriberState state);
 
-    // use dynamic memory to reduce stack usage
+    using ServiceRegistrySubscriber_t =
+        popo::Subscriber<roudi::ServiceRegistry::Entries, roudi::ServiceRegistrySnapshotHeader>;
+    using ServiceRegistrySample_t =
+        popo::Sample<const roudi::ServiceRegistry::Entries, const roudi::ServiceRegistrySnapshotHeader>;
+
+    // use dynamic memory to reduce stack usage; it is allocated with the first snapshot
     /// @todo iox-#1155 improve solution to avoid stack usage without using dynamic memory
-    std::unique_ptr<roudi::ServiceRegistry> m_serviceRegistry{new iox::roudi::ServiceRegistry};
+    std::unique_ptr<roudi::ServiceRegistry> m_serviceRegistry;
+    // a newer snapshot is built aside to report the differences to the current view; it is only allocated when the
+    // view has to be resynchronized
+    std::unique_ptr<roudi::ServiceRegistry> m_spareServiceRegistry;
     std::mutex m_serviceRegistryMutex;
+    uint64_t m_serviceRegistrySequenceNumber{0U};
+    optional<ServiceChangeCallback> m_serviceChangeCallback;
 
-    popo::Subscriber<roudi::ServiceRegistry> m_serviceRegistrySubscriber{
+    // the snapshot is only used to initialize the view and to resynchronize it after a missed delta
+    ServiceRegistrySubscriber_t m_serviceRegistrySubscriber{
         {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_EVENT_NAME},
         {1U, 1U, iox::NodeName_t("Service Registry"), true}};
 
-    void update();
+    popo::Subscriber<roudi::ServiceRegistryDelta> m_serviceRegistryDeltaSubscriber{
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_DELTA_EVENT_NAME},
+        {roudi::ServiceRegistryDelta::HISTORY_CAPACITY,
+         roudi::ServiceRegistryDelta::HISTORY_CAPACITY,
+         iox::NodeName_t("Service Registry"),
+         true}};
+
+    /// @note must be called with the locked m_serviceRegistryMutex
+    void update() noexcept;
+    void takeServiceRegistrySnapshot() noexcept;
+    void applyServiceRegistryDelta(const roudi::ServiceRegistryDelta& delta) noexcept;
+    void notifyServiceChanges(const roudi::ServiceRegistry& newServiceRegistry) noexcept;
 };
 
 } // namespace runtime
@@ -40,7 +40,8 @@ class RouDiEnv
   public:
     RouDiEnv(const RouDiConfig_t& roudiConfig = RouDiConfig_t().setDefaults(),
              roudi::MonitoringMode monitoringMode = roudi::MonitoringMode::OFF,
-             const uint16_t uniqueRouDiId = 0u) noexcept;
+             const uint16_t uniqueRouDiId = 0u,
+             const uint32_t runtimeMessagesThreadCount = roudi::RUNTIME_MESSAGES_DEFAULT_THREAD_COUNT) noexcept;
     virtual ~RouDiEnv() noexcept;
 
     RouDiEnv(RouDiEnv&& rhs) noexcept = default;
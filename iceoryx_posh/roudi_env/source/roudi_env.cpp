@@ -33,14 +33,21 @@ RouDiEnv::RouDiEnv(MainCTor, const uint16_t uniqueRouDiId) noexcept
 
 RouDiEnv::RouDiEnv(const RouDiConfig_t& roudiConfig,
                    const roudi::MonitoringMode monitoringMode,
-                   const uint16_t uniqueRouDiId) noexcept
+                   const uint16_t uniqueRouDiId,
+                   const uint32_t runtimeMessagesThreadCount) noexcept
     : RouDiEnv(MainCTor{}, uniqueRouDiId)
 {
     m_roudiComponents = std::unique_ptr<roudi::IceOryxRouDiComponents>(new roudi::IceOryxRouDiComponents(roudiConfig));
-    m_roudiApp =
-        std::unique_ptr<roudi::RouDi>(new roudi::RouDi(m_roudiComponents->rouDiMemoryManager,
-                                                       m_roudiComponents->portManager,
-                                                       roudi::RouDi::RoudiStartupParameters{monitoringMode, false}));
+    m_roudiApp = std::unique_ptr<roudi::RouDi>(
+        new roudi::RouDi(m_roudiComponents->rouDiMemoryManager,
+                         m_roudiComponents->portManager,
+                         roudi::RouDi::RoudiStartupParameters{monitoringMode,
+                                                              false,
+                                                              roudi::RouDi::RuntimeMessagesThreadStart::IMMEDIATE,
+                                                              version::CompatibilityCheckLevel::PATCH,
+                                                              roudi::PROCESS_DEFAULT_KILL_DELAY,
+                                                              roudi::PROCESS_DEFAULT_TERMINATION_DELAY,
+                                                              runtimeMessagesThreadCount}));
 }
 
 RouDiEnv::~RouDiEnv() noexcept
@@ -34,6 +34,12 @@ ChunkManagement::ChunkManagement(const not_null<base_t*> chunkHeader,
                   "'MemPool::CHUNK_MEMORY_ALIGNMENT'!");
 }
 
+ChunkManagement::ChunkManagement(const not_null<base_t*> chunkHeader, const not_null<MemPool*> mempool) noexcept
+    : m_chunkHeader(chunkHeader)
+    , m_mempool(mempool)
+{
+}
+
 
 } // namespace mepoo
 } // namespace iox
@@ -38,6 +38,7 @@ MemPoolInfo::MemPoolInfo(const uint32_t usedChunks,
 }
 
 constexpr uint64_t MemPool::CHUNK_MEMORY_ALIGNMENT;
+constexpr uint32_t MemPool::MAX_NUMBER_OF_CHUNKS_PER_BATCH;
 
 MemPool::MemPool(const greater_or_equal<uint32_t, CHUNK_MEMORY_ALIGNMENT> chunkSize,
                  const greater_or_equal<uint32_t, 1> numberOfChunks,
@@ -101,6 +102,41 @@ void* MemPool::getChunk() noexcept
     return indexToPointer(index, m_chunkSize, m_rawMemory.get());
 }
 
+uint32_t MemPool::getChunks(not_null<void**> chunks, const uint32_t numberOfChunks) noexcept
+{
+    void** const obtainedChunks = chunks;
+    uint32_t numberOfObtainedChunks{0U};
+    while (numberOfObtainedChunks < numberOfChunks)
+    {
+        freeList_t::Index_t indices[MAX_NUMBER_OF_CHUNKS_PER_BATCH];
+        const auto numberOfIndices = m_freeIndices.popBatch(
+            &indices[0], std::min(numberOfChunks - numberOfObtainedChunks, MAX_NUMBER_OF_CHUNKS_PER_BATCH));
+        if (numberOfIndices == 0U)
+        {
+            break;
+        }
+
+        for (uint32_t i = 0U; i < numberOfIndices; ++i)
+        {
+            obtainedChunks[numberOfObtainedChunks + i] = indexToPointer(indices[i], m_chunkSize, m_rawMemory.get());
+        }
+        numberOfObtainedChunks += numberOfIndices;
+    }
+
+    if (numberOfObtainedChunks > 0U)
+    {
+        m_usedChunks.fetch_add(numberOfObtainedChunks, std::memory_order_relaxed);
+        adjustMinFree();
+    }
+
+    return numberOfObtainedChunks;
+}
+
+uint32_t MemPool::getChunkIndex(const void* const chunk) const noexcept
+{
+    return pointerToIndex(chunk, m_chunkSize, m_rawMemory.get());
+}
+
 void* MemPool::indexToPointer(uint32_t index, uint32_t chunkSize, void* const rawMemoryBase) noexcept
 {
     const auto offset = static_cast<uint64_t>(index) * chunkSize;
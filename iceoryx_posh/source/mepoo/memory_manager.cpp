@@ -22,6 +22,7 @@
 #include "iceoryx_posh/mepoo/mepoo_config.hpp"
 #include "iox/logging.hpp"
 
+#include <algorithm>
 #include <cstdint>
 
 namespace iox
@@ -46,7 +47,7 @@ void MemoryManager::addMemPool(BumpAllocator& managementAllocator,
     uint32_t adjustedChunkSize = sizeWithChunkHeaderStruct(static_cast<uint32_t>(chunkPayloadSize));
     if (m_denyAddMemPool)
     {
-        IOX_LOG(FATAL, "After the generation of the chunk management pool you are not allowed to create new mempools.");
+        IOX_LOG(FATAL, "After the configuration of the MemoryManager you are not allowed to create new mempools.");
         errorHandler(iox::PoshError::MEPOO__MEMPOOL_ADDMEMPOOL_AFTER_GENERATECHUNKMANAGEMENTPOOL);
     }
     else if (m_memPoolVector.size() > 0 && adjustedChunkSize <= m_memPoolVector.back().getChunkSize())
@@ -64,14 +65,17 @@ void MemoryManager::addMemPool(BumpAllocator& managementAllocator,
     }
 
     m_memPoolVector.emplace_back(adjustedChunkSize, numberOfChunks, managementAllocator, chunkMemoryAllocator);
-    m_totalNumberOfChunks += numberOfChunks;
+
+    auto allocationResult = managementAllocator.allocate(
+        static_cast<uint64_t>(numberOfChunks) * sizeof(ChunkManagement), MemPool::CHUNK_MEMORY_ALIGNMENT);
+    IOX_EXPECTS(allocationResult.has_value());
+    m_chunkManagementSlots.emplace_back(static_cast<ChunkManagement*>(allocationResult.value()));
 }
 
-void MemoryManager::generateChunkManagementPool(BumpAllocator& managementAllocator) noexcept
+ChunkManagement* MemoryManager::getChunkManagementSlot(const uint32_t memPoolIndex, const void* const chunk) noexcept
 {
-    m_denyAddMemPool = true;
-    uint32_t chunkSize = sizeof(ChunkManagement);
-    m_chunkManagementPool.emplace_back(chunkSize, m_totalNumberOfChunks, managementAllocator, managementAllocator);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic) there is a slot for every chunk of the mempool
+    return m_chunkManagementSlots[memPoolIndex].get() + m_memPoolVector[memPoolIndex].getChunkIndex(chunk);
 }
 
 uint32_t MemoryManager::getNumberOfMemPools() const noexcept
@@ -112,17 +116,14 @@ uint64_t MemoryManager::requiredChunkMemorySize(const MePooConfig& mePooConfig)
 uint64_t MemoryManager::requiredManagementMemorySize(const MePooConfig& mePooConfig) noexcept
 {
     uint64_t memorySize{0U};
-    uint64_t sumOfAllChunks{0U};
     for (const auto& mempool : mePooConfig.m_mempoolConfig)
     {
-        sumOfAllChunks += mempool.m_chunkCount;
         memorySize +=
             align(MemPool::freeList_t::requiredIndexMemorySize(mempool.m_chunkCount), MemPool::CHUNK_MEMORY_ALIGNMENT);
+        memorySize += align(static_cast<uint64_t>(mempool.m_chunkCount) * sizeof(ChunkManagement),
+                            MemPool::CHUNK_MEMORY_ALIGNMENT);
     }
 
-    memorySize += align(sumOfAllChunks * sizeof(ChunkManagement), MemPool::CHUNK_MEMORY_ALIGNMENT);
-    memorySize += align(MemPool::freeList_t::requiredIndexMemorySize(sumOfAllChunks), MemPool::CHUNK_MEMORY_ALIGNMENT);
-
     return memorySize;
 }
 
@@ -140,26 +141,99 @@ void MemoryManager::configureMemoryManager(const MePooConfig& mePooConfig,
         addMemPool(managementAllocator, chunkMemoryAllocator, entry.m_size, entry.m_chunkCount);
     }
 
-    generateChunkManagementPool(managementAllocator);
+    m_denyAddMemPool = true;
+    generateSizeClassTable();
+    m_allocationPolicy = mePooConfig.m_allocationPolicy;
+}
+
+uint32_t MemoryManager::sizeClass(const uint32_t chunkSize) noexcept
+{
+    constexpr uint32_t BIT_WIDTH{std::numeric_limits<uint32_t>::digits};
+    return (chunkSize == 0U) ? 0U : BIT_WIDTH - countLeadingZeros(chunkSize);
+}
+
+uint32_t MemoryManager::countLeadingZeros(const uint32_t value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint32_t>(__builtin_clz(value));
+#else
+    constexpr uint32_t MOST_SIGNIFICANT_BIT{1U << (std::numeric_limits<uint32_t>::digits - 1)};
+    uint32_t numberOfZeros{0U};
+    for (auto remainingValue = value; (remainingValue & MOST_SIGNIFICANT_BIT) == 0U; remainingValue <<= 1U)
+    {
+        ++numberOfZeros;
+    }
+    return numberOfZeros;
+#endif
+}
+
+void MemoryManager::generateSizeClassTable() noexcept
+{
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    uint32_t memPoolIndex{0U};
+    for (uint32_t sizeClassIndex = 0U; sizeClassIndex < NUMBER_OF_SIZE_CLASSES; ++sizeClassIndex)
+    {
+        const uint64_t smallestSizeOfClass = (sizeClassIndex == 0U) ? 0U : (1ULL << (sizeClassIndex - 1U));
+        while (memPoolIndex < numberOfMemPools && m_memPoolVector[memPoolIndex].getChunkSize() < smallestSizeOfClass)
+        {
+            ++memPoolIndex;
+        }
+        m_firstMemPoolOfSizeClass[sizeClassIndex] = memPoolIndex;
+    }
+}
+
+uint32_t MemoryManager::getBestFittingMemPoolIndex(const uint32_t requiredChunkSize) const noexcept
+{
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    auto memPoolIndex = (numberOfMemPools == 0U) ? 0U : m_firstMemPoolOfSizeClass[sizeClass(requiredChunkSize)];
+    while (memPoolIndex < numberOfMemPools && m_memPoolVector[memPoolIndex].getChunkSize() < requiredChunkSize)
+    {
+        ++memPoolIndex;
+    }
+    return memPoolIndex;
+}
+
+optional<uint32_t> MemoryManager::getBestFittingChunkSize(const uint32_t requiredChunkSize) const noexcept
+{
+    const auto memPoolIndex = getBestFittingMemPoolIndex(requiredChunkSize);
+    if (memPoolIndex >= m_memPoolVector.size())
+    {
+        return nullopt;
+    }
+    return m_memPoolVector[memPoolIndex].getChunkSize();
 }
 
 expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkSettings& chunkSettings) noexcept
 {
     void* chunk{nullptr};
     MemPool* memPoolPointer{nullptr};
+    uint32_t acquiredMemPoolIndex{0U};
     const auto requiredChunkSize = chunkSettings.requiredChunkSize();
 
     uint32_t aquiredChunkSize = 0U;
 
-    for (auto& memPool : m_memPoolVector)
+    const auto numberOfMemPools = static_cast<uint32_t>(m_memPoolVector.size());
+    const auto memPoolIndex = getBestFittingMemPoolIndex(requiredChunkSize);
+
+    if (memPoolIndex < numberOfMemPools)
     {
-        uint32_t chunkSizeOfMemPool = memPool.getChunkSize();
-        if (chunkSizeOfMemPool >= requiredChunkSize)
+        memPoolPointer = &m_memPoolVector[memPoolIndex];
+        chunk = memPoolPointer->getChunk();
+        aquiredChunkSize = memPoolPointer->getChunkSize();
+        acquiredMemPoolIndex = memPoolIndex;
+
+        if (chunk == nullptr && m_allocationPolicy == MemPoolAllocationPolicy::FALL_THROUGH_TO_LARGER_MEMPOOL)
         {
-            chunk = memPool.getChunk();
-            memPoolPointer = &memPool;
-            aquiredChunkSize = chunkSizeOfMemPool;
-            break;
+            for (auto i = memPoolIndex + 1U; chunk == nullptr && i < numberOfMemPools; ++i)
+            {
+                chunk = m_memPoolVector[i].getChunk();
+                if (chunk != nullptr)
+                {
+                    memPoolPointer = &m_memPoolVector[i];
+                    aquiredChunkSize = memPoolPointer->getChunkSize();
+                    acquiredMemPoolIndex = i;
+                }
+            }
         }
     }
 
@@ -200,12 +274,52 @@ expected<SharedChunk, MemoryManager::Error> MemoryManager::getChunk(const ChunkS
     else
     {
         auto chunkHeader = new (chunk) ChunkHeader(aquiredChunkSize, chunkSettings);
-        auto chunkManagement = new (m_chunkManagementPool.front().getChunk())
-            ChunkManagement(chunkHeader, memPoolPointer, &m_chunkManagementPool.front());
+        auto chunkManagement =
+            new (getChunkManagementSlot(acquiredMemPoolIndex, chunk)) ChunkManagement(chunkHeader, memPoolPointer);
         return ok(SharedChunk(chunkManagement));
     }
 }
 
+uint32_t MemoryManager::getChunks(const ChunkSettings& chunkSettings,
+                                  not_null<SharedChunk*> chunks,
+                                  const uint32_t numberOfChunks) noexcept
+{
+    const auto memPoolIndex = getBestFittingMemPoolIndex(chunkSettings.requiredChunkSize());
+    if (memPoolIndex >= m_memPoolVector.size())
+    {
+        return 0U;
+    }
+
+    SharedChunk* const obtainedChunks = chunks;
+    auto& memPool = m_memPoolVector[memPoolIndex];
+    const auto chunkSize = memPool.getChunkSize();
+
+    uint32_t numberOfObtainedChunks{0U};
+    while (numberOfObtainedChunks < numberOfChunks)
+    {
+        void* rawChunks[MemPool::MAX_NUMBER_OF_CHUNKS_PER_BATCH];
+        const auto batchSize =
+            std::min(numberOfChunks - numberOfObtainedChunks, MemPool::MAX_NUMBER_OF_CHUNKS_PER_BATCH);
+
+        const auto numberOfRawChunks = memPool.getChunks(&rawChunks[0], batchSize);
+        for (uint32_t i = 0U; i < numberOfRawChunks; ++i)
+        {
+            auto chunkHeader = new (rawChunks[i]) ChunkHeader(chunkSize, chunkSettings);
+            auto chunkManagement =
+                new (getChunkManagementSlot(memPoolIndex, rawChunks[i])) ChunkManagement(chunkHeader, &memPool);
+            obtainedChunks[numberOfObtainedChunks + i] = SharedChunk(chunkManagement);
+        }
+        numberOfObtainedChunks += numberOfRawChunks;
+
+        if (numberOfRawChunks < batchSize)
+        {
+            break;
+        }
+    }
+
+    return numberOfObtainedChunks;
+}
+
 std::ostream& operator<<(std::ostream& stream, const MemoryManager::Error value) noexcept
 {
     stream << asStringLiteral(value);
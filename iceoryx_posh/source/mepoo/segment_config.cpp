@@ -15,12 +15,58 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/mepoo/segment_config.hpp"
+#include "iceoryx_platform/errno.hpp"
+#include "iceoryx_platform/stat.hpp"
+#include "iox/posix_call.hpp"
 #include "iox/posix_group.hpp"
 
 namespace iox
 {
 namespace mepoo
 {
+uint64_t hugePageSizeInBytes(const HugePageSize hugePageSize) noexcept
+{
+    switch (hugePageSize)
+    {
+    case HugePageSize::SIZE_2MB:
+        return 2ULL << 20U;
+    case HugePageSize::SIZE_1GB:
+        return 1ULL << 30U;
+    case HugePageSize::NONE:
+        break;
+    }
+    return 0U;
+}
+
+optional<HugePageMount_t> defaultHugePageMount(const HugePageSize hugePageSize) noexcept
+{
+    switch (hugePageSize)
+    {
+    case HugePageSize::SIZE_2MB:
+        return HugePageMount_t{"/dev/hugepages"};
+    case HugePageSize::SIZE_1GB:
+        return HugePageMount_t{"/dev/hugepages1G"};
+    case HugePageSize::NONE:
+        break;
+    }
+    return nullopt;
+}
+
+bool isHugePageMount(const HugePageMount_t& directory, const HugePageSize hugePageSize) noexcept
+{
+    if (hugePageSize == HugePageSize::NONE)
+    {
+        return false;
+    }
+
+    unsigned long long pageSize{0U};
+    const auto result = IOX_POSIX_CALL(iox_hugetlbfs_page_size)(directory.c_str(), &pageSize)
+                            .failureReturnValue(-1)
+                            .suppressErrorMessagesForErrnos(ENOENT, ENOSYS)
+                            .evaluate();
+    return !result.has_error() && pageSize == hugePageSizeInBytes(hugePageSize);
+}
+
 SegmentConfig& SegmentConfig::setDefaults() noexcept
 {
     auto groupName = PosixGroup::getGroupOfCurrentProcess().getName();
@@ -60,8 +60,14 @@ void SharedChunk::decrementReferenceCounter() noexcept
 
 void SharedChunk::freeChunk() noexcept
 {
+    // a ChunkManagement in the fixed slot of the chunk might be reused as soon as the chunk is freed, therefore it
+    // must not be accessed afterwards
+    auto chunkManagementPool = m_chunkManagement->m_chunkManagementPool.get();
     m_chunkManagement->m_mempool->freeChunk(static_cast<void*>(m_chunkManagement->m_chunkHeader.get()));
-    m_chunkManagement->m_chunkManagementPool->freeChunk(m_chunkManagement);
+    if (chunkManagementPool != nullptr)
+    {
+        chunkManagementPool->freeChunk(m_chunkManagement);
+    }
     m_chunkManagement = nullptr;
 }
 
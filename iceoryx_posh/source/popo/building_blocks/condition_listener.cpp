@@ -17,13 +17,17 @@
 
 #include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
+#include "iox/deadline_timer.hpp"
+
+#include <thread>
 
 namespace iox
 {
 namespace popo
 {
-ConditionListener::ConditionListener(ConditionVariableData& condVarData) noexcept
+ConditionListener::ConditionListener(ConditionVariableData& condVarData, const WaitStrategy& waitStrategy) noexcept
     : m_condVarDataPtr(&condVarData)
+    , m_waitStrategy(waitStrategy)
 {
 }
 
@@ -58,59 +62,186 @@ bool ConditionListener::wasNotified() const noexcept
 
 ConditionListener::NotificationVector_t ConditionListener::wait() noexcept
 {
-    return waitImpl([this]() -> bool {
-        if (this->getMembers()->m_semaphore->wait().has_error())
-        {
-            errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT, ErrorLevel::FATAL);
-            return false;
-        }
-        return true;
-    });
+    return waitImpl(
+        [this]() -> bool {
+            if (this->getMembers()->m_semaphore->wait().has_error())
+            {
+                errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_WAIT, ErrorLevel::FATAL);
+                return false;
+            }
+            return true;
+        },
+        units::Duration::max());
 }
 
 ConditionListener::NotificationVector_t ConditionListener::timedWait(const units::Duration& timeToWait) noexcept
 {
-    return waitImpl([this, timeToWait]() -> bool {
-        if (this->getMembers()->m_semaphore->timedWait(timeToWait).has_error())
-        {
-            errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT, ErrorLevel::FATAL);
-        }
-        return false;
-    });
+    // the time spent polling is deducted from the time which is waited on the semaphore
+    deadline_timer timeout(timeToWait);
+    return waitImpl(
+        [this, &timeout]() -> bool {
+            if (this->getMembers()->m_semaphore->timedWait(timeout.remainingTime()).has_error())
+            {
+                errorHandler(PoshError::POPO__CONDITION_LISTENER_SEMAPHORE_CORRUPTED_IN_TIMED_WAIT, ErrorLevel::FATAL);
+            }
+            return false;
+        },
+        timeToWait);
 }
 
-ConditionListener::NotificationVector_t ConditionListener::waitImpl(const function_ref<bool()> waitCall) noexcept
+ConditionListener::NotificationVector_t ConditionListener::waitImpl(const function_ref<bool()> waitCall,
+                                                                    const units::Duration maxSpinDuration) noexcept
 {
-    using Type_t = iox::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
     NotificationVector_t activeNotifications;
 
     resetSemaphore();
     bool doReturnAfterNotificationCollection = false;
+    bool hasSpun = !m_waitStrategy.isSpinning();
     while (!m_toBeDestroyed.load(std::memory_order_relaxed))
     {
-        for (Type_t i = 0U; i < MAX_NUMBER_OF_NOTIFIERS; i++)
+        collectActiveNotifications(activeNotifications);
+        if (!activeNotifications.empty() || doReturnAfterNotificationCollection)
         {
-            if (getMembers()->m_activeNotifications[i].load(std::memory_order_relaxed))
+            return activeNotifications;
+        }
+
+        if (!hasSpun)
+        {
+            hasSpun = true;
+            spinUntilNotified(maxSpinDuration);
+            continue;
+        }
+
+        doReturnAfterNotificationCollection = !waitUnlessNotified(waitCall);
+    }
+
+    return activeNotifications;
+}
+
+void ConditionListener::collectActiveNotifications(NotificationVector_t& activeNotifications) noexcept
+{
+    using Type_t = iox::BestFittingType_t<iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER>;
+    using NotificationWord_t = ConditionVariableData::NotificationWord_t;
+
+    bool hasActiveNotifications{false};
+    for (uint64_t wordIndex = 0U; wordIndex < ConditionVariableData::NUMBER_OF_NOTIFICATION_WORDS; ++wordIndex)
+    {
+        auto& word = getMembers()->m_activeNotifications[wordIndex];
+        // the exchange requires exclusive access to the cache line, therefore it is only done for words with active
+        // notifications
+        if (word.load(std::memory_order_relaxed) == 0U)
+        {
+            continue;
+        }
+
+        NotificationWord_t activeBits = word.exchange(0U, std::memory_order_acquire);
+        hasActiveNotifications = hasActiveNotifications || (activeBits != 0U);
+        while (activeBits != 0U)
+        {
+            const auto index = wordIndex * ConditionVariableData::NOTIFICATIONS_PER_WORD
+                               + countTrailingZeros(activeBits);
+            activeNotifications.emplace_back(static_cast<Type_t>(index));
+            // clear the lowest set bit
+            activeBits &= activeBits - 1U;
+        }
+    }
+
+    if (hasActiveNotifications)
+    {
+        getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+    }
+}
+
+bool ConditionListener::waitUnlessNotified(const function_ref<bool()> waitCall) noexcept
+{
+    auto& numberOfSleepingListeners = getMembers()->m_numberOfSleepingListeners;
+    numberOfSleepingListeners.fetch_add(1U, std::memory_order_seq_cst);
+
+    // a notifier which activated its notification before the registration might not have posted the semaphore,
+    // therefore the notifications are checked again after the registration
+    bool continueWaiting{true};
+    if (!hasActiveNotifications() && !m_toBeDestroyed.load(std::memory_order_relaxed))
+    {
+        continueWaiting = waitCall();
+    }
+
+    numberOfSleepingListeners.fetch_sub(1U, std::memory_order_relaxed);
+    return continueWaiting;
+}
+
+bool ConditionListener::hasActiveNotifications() const noexcept
+{
+    for (const auto& word : getMembers()->m_activeNotifications)
+    {
+        if (word.load(std::memory_order_seq_cst) != 0U)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ConditionListener::spinUntilNotified(const units::Duration maxSpinDuration) noexcept
+{
+    const bool isLimitedByIterations = m_waitStrategy.maxSpinIterations != 0U;
+    const auto spinDuration = (m_waitStrategy.maxSpinDuration == units::Duration::zero())
+                                  ? maxSpinDuration
+                                  : algorithm::minVal(m_waitStrategy.maxSpinDuration, maxSpinDuration);
+    const bool isLimitedByDuration = spinDuration != units::Duration::max();
+    deadline_timer spinTimeout(isLimitedByDuration ? spinDuration : units::Duration::zero());
+
+    for (uint64_t i = 0U; !isLimitedByIterations || i < m_waitStrategy.maxSpinIterations; ++i)
+    {
+        // the relaxed load avoids that the cache line is permanently requested by the polling thread; the notifications
+        // are collected with acquire semantics afterwards
+        for (const auto& word : getMembers()->m_activeNotifications)
+        {
+            if (word.load(std::memory_order_relaxed) != 0U)
             {
-                resetUnchecked(i);
-                activeNotifications.emplace_back(i);
+                return;
             }
         }
-        if (!activeNotifications.empty() || doReturnAfterNotificationCollection)
+
+        if (m_toBeDestroyed.load(std::memory_order_relaxed) || (isLimitedByDuration && spinTimeout.hasExpired()))
         {
-            return activeNotifications;
+            return;
         }
 
-        doReturnAfterNotificationCollection = !waitCall();
+        relax();
     }
+}
 
-    return activeNotifications;
+void ConditionListener::relax() const noexcept
+{
+    switch (m_waitStrategy.spinHint)
+    {
+    case SpinHint::NONE:
+        break;
+    case SpinHint::PAUSE:
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+        asm volatile("yield" ::: "memory");
+#endif
+        break;
+    case SpinHint::YIELD:
+        std::this_thread::yield();
+        break;
+    }
 }
 
-void ConditionListener::resetUnchecked(const uint64_t index) noexcept
+uint64_t ConditionListener::countTrailingZeros(const uint64_t value) noexcept
 {
-    getMembers()->m_activeNotifications[index].store(false, std::memory_order_relaxed);
-    getMembers()->m_wasNotified.store(false, std::memory_order_relaxed);
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint64_t>(__builtin_ctzll(value));
+#else
+    uint64_t numberOfZeros{0U};
+    for (auto remainingValue = value; (remainingValue & 1U) == 0U; remainingValue >>= 1U)
+    {
+        ++numberOfZeros;
+    }
+    return numberOfZeros;
+#endif
 }
 
 const ConditionVariableData* ConditionListener::getMembers() volatile const noexcept
@@ -37,8 +37,17 @@ ConditionNotifier::ConditionNotifier(ConditionVariableData& condVarDataRef, cons
 
 void ConditionNotifier::notify() noexcept
 {
-    getMembers()->m_activeNotifications[m_notificationIndex].store(true, std::memory_order_release);
+    getMembers()
+        ->m_activeNotifications[ConditionVariableData::notificationWordIndex(m_notificationIndex)]
+        .fetch_or(ConditionVariableData::notificationMask(m_notificationIndex), std::memory_order_seq_cst);
     getMembers()->m_wasNotified.store(true, std::memory_order_relaxed);
+
+    // a listener registers as sleeping before it checks the notifications a last time, therefore either the listener
+    // sees the notification or the notifier sees the sleeping listener
+    if (getMembers()->m_numberOfSleepingListeners.load(std::memory_order_seq_cst) == 0U)
+    {
+        return;
+    }
     getMembers()->m_semaphore->post().or_else(
         [](auto) { errorHandler(PoshError::POPO__CONDITION_NOTIFIER_SEMAPHORE_CORRUPT_IN_NOTIFY, ErrorLevel::FATAL); });
 }
@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/popo/ports/base_port.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 
 namespace iox
 {
@@ -69,6 +70,7 @@ BasePort::operator bool() const noexcept
 void BasePort::destroy() noexcept
 {
     getMembers()->m_toBeDestroyed.store(true, std::memory_order_relaxed);
+    notifyDiscovery();
 }
 
 bool BasePort::toBeDestroyed() const noexcept
@@ -76,5 +78,16 @@ bool BasePort::toBeDestroyed() const noexcept
     return getMembers()->m_toBeDestroyed.load(std::memory_order_relaxed);
 }
 
+void BasePort::notifyDiscovery() noexcept
+{
+    auto& discoveryConditionVariableDataPtr = getMembers()->m_discoveryConditionVariableDataPtr;
+    if (discoveryConditionVariableDataPtr)
+    {
+        ConditionNotifier(*discoveryConditionVariableDataPtr.get(),
+                          roudi::DISCOVERY_PORT_STATE_CHANGE_NOTIFICATION_INDEX)
+            .notify();
+    }
+}
+
 } // namespace popo
 } // namespace iox
@@ -252,5 +252,13 @@ void ClientPortRouDi::releaseAllChunks() noexcept
     m_chunkReceiver.releaseAll();
 }
 
+bool ClientPortRouDi::releaseChunkQueue(not_null<ServerChunkQueueData_t* const> queueToRelease) noexcept
+{
+    // a queue which is not stored anymore is also not accessed anymore when the removal does not report that a
+    // delivery still uses it
+    const auto result = m_chunkSender.tryRemoveQueue(queueToRelease);
+    return !result.has_error() || result.error() != ChunkDistributorError::QUEUE_SNAPSHOT_IN_USE;
+}
+
 } // namespace popo
 } // namespace iox
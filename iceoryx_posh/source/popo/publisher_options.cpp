@@ -17,6 +17,8 @@
 #include "iceoryx_posh/popo/publisher_options.hpp"
 #include "iox/logging.hpp"
 
+#include <limits>
+
 namespace iox
 {
 namespace popo
@@ -26,7 +28,9 @@ Serialization PublisherOptions::serialize() const noexcept
     return Serialization::create(historyCapacity,
                                  nodeName,
                                  offerOnCreate,
-                                 static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy));
+                                 static_cast<std::underlying_type_t<ConsumerTooSlowPolicy>>(subscriberTooSlowPolicy),
+                                 chunkMagazineCapacity,
+                                 subscriberTooSlowTimeout.toNanoseconds());
 }
 
 expected<PublisherOptions, Serialization::Error> PublisherOptions::deserialize(const Serialization& serialized) noexcept
@@ -35,11 +39,39 @@ expected<PublisherOptions, Serialization::Error> PublisherOptions::deserialize(c
 
     PublisherOptions publisherOptions;
     ConsumerTooSlowPolicyUT subscriberTooSlowPolicy;
+    uint64_t subscriberTooSlowTimeoutNs{0U};
 
     auto deserializationSuccessful = serialized.extract(publisherOptions.historyCapacity,
                                                         publisherOptions.nodeName,
                                                         publisherOptions.offerOnCreate,
-                                                        subscriberTooSlowPolicy);
+                                                        subscriberTooSlowPolicy,
+                                                        publisherOptions.chunkMagazineCapacity,
+                                                        subscriberTooSlowTimeoutNs);
+    if (deserializationSuccessful)
+    {
+        // units::Duration::max() exceeds the range of the nanoseconds and is serialized saturated
+        publisherOptions.subscriberTooSlowTimeout = (subscriberTooSlowTimeoutNs == std::numeric_limits<uint64_t>::max())
+                                                        ? units::Duration::max()
+                                                        : units::Duration::fromNanoseconds(subscriberTooSlowTimeoutNs);
+    }
+    // the options of a runtime which is not aware of the timeout lack it; the default is used
+    if (!deserializationSuccessful)
+    {
+        deserializationSuccessful = serialized.extract(publisherOptions.historyCapacity,
+                                                       publisherOptions.nodeName,
+                                                       publisherOptions.offerOnCreate,
+                                                       subscriberTooSlowPolicy,
+                                                       publisherOptions.chunkMagazineCapacity);
+    }
+    // the options of a runtime which is not aware of the chunk magazine lack the capacity; the default is used
+    if (!deserializationSuccessful)
+    {
+        publisherOptions.chunkMagazineCapacity = PublisherOptions().chunkMagazineCapacity;
+        deserializationSuccessful = serialized.extract(publisherOptions.historyCapacity,
+                                                       publisherOptions.nodeName,
+                                                       publisherOptions.offerOnCreate,
+                                                       subscriberTooSlowPolicy);
+    }
 
     if (!deserializationSuccessful
         || subscriberTooSlowPolicy > static_cast<ConsumerTooSlowPolicyUT>(ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA))
@@ -49,7 +49,9 @@ uint8_t IceOryxRouDiApp::run() noexcept
                                                            RouDi::RuntimeMessagesThreadStart::IMMEDIATE,
                                                            m_compatibilityCheckLevel,
                                                            m_processKillDelay,
-                                                           m_processTeminationDelay});
+                                                           m_processTeminationDelay,
+                                                           roudi::RUNTIME_MESSAGES_DEFAULT_THREAD_COUNT,
+                                                           m_processExitDetection});
         iox::waitForTerminationRequest();
     }
     return EXIT_SUCCESS;
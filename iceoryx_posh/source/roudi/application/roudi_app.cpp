@@ -34,6 +34,7 @@ namespace roudi
 RouDiApp::RouDiApp(const config::CmdLineArgs_t& cmdLineArgs, const RouDiConfig_t& config) noexcept
     : m_logLevel(cmdLineArgs.logLevel)
     , m_monitoringMode(cmdLineArgs.monitoringMode)
+    , m_processExitDetection(cmdLineArgs.processExitDetection)
     , m_run(checkAndOptimizeConfig(config))
     , m_config(config)
     , m_compatibilityCheckLevel(cmdLineArgs.compatibilityCheckLevel)
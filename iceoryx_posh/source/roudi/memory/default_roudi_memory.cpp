@@ -18,6 +18,8 @@
 #include "iceoryx_posh/roudi/memory/default_roudi_memory.hpp"
 #include "iceoryx_posh/internal/mepoo/mem_pool.hpp"
 #include "iceoryx_posh/internal/roudi/service_registry.hpp"
+#include "iceoryx_posh/internal/roudi/service_registry_delta.hpp"
+#include "iceoryx_posh/mepoo/chunk_settings.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iox/memory.hpp"
 
@@ -29,7 +31,8 @@ DefaultRouDiMemory::DefaultRouDiMemory(const RouDiConfig_t& roudiConfig) noexcep
     : m_introspectionMemPoolBlock(introspectionMemPoolConfig(roudiConfig.introspectionChunkCount))
     , m_discoveryMemPoolBlock(discoveryMemPoolConfig(roudiConfig.discoveryChunkCount))
     , m_segmentManagerBlock(roudiConfig)
-    , m_managementShm(SHM_NAME, AccessMode::READ_WRITE, OpenMode::PURGE_AND_CREATE)
+    , m_managementShm(
+          SHM_NAME, AccessMode::READ_WRITE, OpenMode::PURGE_AND_CREATE, roudiConfig.lockManagementSegmentInMemory)
 {
     m_managementShm.addMemoryBlock(&m_introspectionMemPoolBlock).or_else([](auto) {
         errorHandler(PoshError::ROUDI__DEFAULT_ROUDI_MEMORY_FAILED_TO_ADD_INTROSPECTION_MEMORY_BLOCK,
@@ -70,9 +73,23 @@ mepoo::MePooConfig DefaultRouDiMemory::introspectionMemPoolConfig(const uint32_t
 mepoo::MePooConfig DefaultRouDiMemory::discoveryMemPoolConfig(const uint32_t chunkCount) const noexcept
 {
     constexpr uint32_t ALIGNMENT{mepoo::MemPool::CHUNK_MEMORY_ALIGNMENT};
+    // the snapshot of the service registry is published with a user-header
+    const auto snapshotChunkSize =
+        mepoo::ChunkSettings::create(static_cast<uint32_t>(sizeof(ServiceRegistry::Entries)),
+                                     static_cast<uint32_t>(alignof(ServiceRegistry::Entries)),
+                                     static_cast<uint32_t>(sizeof(ServiceRegistrySnapshotHeader)),
+                                     static_cast<uint32_t>(alignof(ServiceRegistrySnapshotHeader)))
+            .expect("Valid chunk settings for the service registry snapshot")
+            .requiredChunkSize();
+    const auto snapshotPayloadSize = snapshotChunkSize - static_cast<uint32_t>(sizeof(mepoo::ChunkHeader));
+
+    // the delta publisher holds its history in addition to the chunks of the subscribers
+    const auto deltaChunkCount = chunkCount + 2U * static_cast<uint32_t>(roudi::ServiceRegistryDelta::HISTORY_CAPACITY);
+
     mepoo::MePooConfig mempoolConfig;
+    mempoolConfig.m_mempoolConfig.push_back({align(snapshotPayloadSize, ALIGNMENT), chunkCount});
     mempoolConfig.m_mempoolConfig.push_back(
-        {align(static_cast<uint32_t>(sizeof(roudi::ServiceRegistry)), ALIGNMENT), chunkCount});
+        {align(static_cast<uint32_t>(sizeof(roudi::ServiceRegistryDelta)), ALIGNMENT), deltaChunkCount});
 
     mempoolConfig.optimize();
     return mempoolConfig;
@@ -31,10 +31,12 @@ constexpr access_rights PosixShmMemoryProvider::SHM_MEMORY_PERMISSIONS;
 
 PosixShmMemoryProvider::PosixShmMemoryProvider(const ShmName_t& shmName,
                                                const AccessMode accessMode,
-                                               const OpenMode openMode) noexcept
+                                               const OpenMode openMode,
+                                               const bool lockInMemory) noexcept
     : m_shmName(shmName)
     , m_accessMode(accessMode)
     , m_openMode(openMode)
+    , m_lockInMemory(lockInMemory)
 {
 }
 
@@ -60,6 +62,7 @@ expected<void*, MemoryProviderError> PosixShmMemoryProvider::createMemory(const
              .accessMode(m_accessMode)
              .openMode(m_openMode)
              .permissions(SHM_MEMORY_PERMISSIONS)
+             .lockInMemory(m_lockInMemory)
              .create()
              .and_then([this](auto& sharedMemoryObject) { m_shmObject.emplace(std::move(sharedMemoryObject)); }))
     {
@@ -75,6 +78,11 @@ expected<void*, MemoryProviderError> PosixShmMemoryProvider::createMemory(const
     return ok(baseAddress);
 }
 
+bool PosixShmMemoryProvider::isLockedInMemory() const noexcept
+{
+    return m_lockInMemory;
+}
+
 expected<void, MemoryProviderError> PosixShmMemoryProvider::destroyMemory() noexcept
 {
     m_shmObject.reset();
@@ -79,9 +79,20 @@ PortManager::PortManager(RouDiMemoryInterface* roudiMemoryInterface) noexcept
         registryPortOptions,
         discoveryMemoryManager);
 
-    // if we arrive here, the port for service discovery exists and we perform the discovery
+    // the history must contain all deltas since the last snapshot for late joiners
+    popo::PublisherOptions registryDeltaPortOptions{registryPortOptions};
+    registryDeltaPortOptions.historyCapacity = ServiceRegistryDelta::HISTORY_CAPACITY;
+
+    m_serviceRegistryDeltaPublisherPortData = acquireInternalPublisherPortDataWithoutDiscovery(
+        {SERVICE_DISCOVERY_SERVICE_NAME, SERVICE_DISCOVERY_INSTANCE_NAME, SERVICE_DISCOVERY_DELTA_EVENT_NAME},
+        registryDeltaPortOptions,
+        discoveryMemoryManager);
+
+    // if we arrive here, the ports for service discovery exist and we perform the discovery
     PublisherPortRouDiType serviceRegistryPort(*m_serviceRegistryPublisherPortData);
     doDiscoveryForPublisherPort(serviceRegistryPort);
+    PublisherPortRouDiType serviceRegistryDeltaPort(*m_serviceRegistryDeltaPublisherPortData);
+    doDiscoveryForPublisherPort(serviceRegistryDeltaPort);
 
     auto maybeIntrospectionMemoryManager = m_roudiMemoryInterface->introspectionMemoryManager();
     if (!maybeIntrospectionMemoryManager.has_value())
@@ -115,6 +126,11 @@ void PortManager::stopPortIntrospection() noexcept
     m_portIntrospection.stop();
 }
 
+popo::ConditionVariableData& PortManager::getDiscoveryConditionVariable() noexcept
+{
+    return m_portPool->getDiscoveryConditionVariable();
+}
+
 void PortManager::doDiscovery() noexcept
 {
     handlePublisherPorts();
@@ -246,6 +262,9 @@ void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData)
     popo::ClientPortRouDi clientPortRoudi(*clientPortData);
     popo::ClientPortUser clientPortUser(*clientPortData);
 
+    // the client does not deliver requests anymore, therefore the snapshot of its request queues can be reclaimed
+    clientPortData->m_chunkSenderData.m_isQueueSnapshotReaderRemoved.store(true);
+
     clientPortUser.disconnect();
 
     // process DISCONNECT for this client in RouDi and distribute it
@@ -256,6 +275,18 @@ void PortManager::destroyClientPort(popo::ClientPortData* const clientPortData)
         this->sendToAllMatchingServerPorts(caproMessage, clientPortRoudi);
     });
 
+    if (!releaseResponseQueueOfClient(clientPortData))
+    {
+        IOX_LOG(WARN,
+                "The response queue of the client port from runtime '"
+                    << clientPortData->m_runtimeName << "' and with service description '"
+                    << clientPortData->m_serviceDescription
+                    << "' is still used by a server! The destruction is retried later.");
+        clientPortUser.unsetConditionVariable();
+        clientPortUser.destroy();
+        return;
+    }
+
     clientPortRoudi.releaseAllChunks();
 
     /// @todo iox-#1128 remove from to port introspection
@@ -339,6 +370,9 @@ void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData)
     popo::ServerPortRouDi serverPortRoudi{*serverPortData};
     popo::ServerPortUser serverPortUser{*serverPortData};
 
+    // the server does not deliver responses anymore, therefore the snapshot of its response queues can be reclaimed
+    serverPortData->m_chunkSenderData.m_isQueueSnapshotReaderRemoved.store(true);
+
     serverPortUser.stopOffer();
 
     // process STOP_OFFER for this server in RouDi and distribute it
@@ -352,6 +386,18 @@ void PortManager::destroyServerPort(popo::ServerPortData* const serverPortData)
         this->sendToAllMatchingInterfacePorts(caproMessage);
     });
 
+    if (!releaseRequestQueueOfServer(serverPortData))
+    {
+        IOX_LOG(WARN,
+                "The request queue of the server port from runtime '"
+                    << serverPortData->m_runtimeName << "' and with service description '"
+                    << serverPortData->m_serviceDescription
+                    << "' is still used by a client! The destruction is retried later.");
+        serverPortUser.unsetConditionVariable();
+        serverPortUser.destroy();
+        return;
+    }
+
     serverPortRoudi.releaseAllChunks();
 
     /// @todo iox-#1128 remove from port introspection
@@ -733,25 +779,30 @@ void PortManager::sendToAllMatchingInterfacePorts(const capro::CaproMessage& mes
 
 void PortManager::unblockProcessShutdown(const RuntimeName_t& runtimeName) noexcept
 {
-    for (auto& port : m_portPool->getPublisherPortDataList())
-    {
-        PublisherPortRouDiType publisherPort(&port);
-        if (runtimeName == publisherPort.getRuntimeName())
-        {
-            port.m_offeringRequested.store(false, std::memory_order_relaxed);
-            doDiscoveryForPublisherPort(publisherPort);
-        }
-    }
+    unblockProcessShutdown(runtimeName, collectOwnedPortSlots(runtimeName));
+}
 
-    for (auto& port : m_portPool->getServerPortDataList())
-    {
-        popo::ServerPortRouDi serverPort(port);
+void PortManager::unblockProcessShutdown(const RuntimeName_t& runtimeName,
+                                         const OwnedPortSlots& ownedPortSlots) noexcept
+{
+    forEachElementInSlotSet(
+        m_portPool->getPublisherPortDataList(), ownedPortSlots.publishers, [&](auto* const portData) {
+            PublisherPortRouDiType publisherPort(portData);
+            if (runtimeName == publisherPort.getRuntimeName())
+            {
+                portData->m_offeringRequested.store(false, std::memory_order_relaxed);
+                doDiscoveryForPublisherPort(publisherPort);
+            }
+        });
+
+    forEachElementInSlotSet(m_portPool->getServerPortDataList(), ownedPortSlots.servers, [&](auto* const portData) {
+        popo::ServerPortRouDi serverPort(*portData);
         if (runtimeName == serverPort.getRuntimeName())
         {
-            port.m_offeringRequested.store(false, std::memory_order_relaxed);
+            portData->m_offeringRequested.store(false, std::memory_order_relaxed);
             doDiscoveryForServerPort(serverPort);
         }
-    }
+    });
 }
 
 void PortManager::unblockRouDiShutdown() noexcept
@@ -772,96 +823,134 @@ void PortManager::makeAllPublisherPortsToStopOffer() noexcept
 }
 
 void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName) noexcept
+{
+    deletePortsOfProcess(runtimeName, collectOwnedPortSlots(runtimeName));
+}
+
+void PortManager::deletePortsOfProcess(const RuntimeName_t& runtimeName, const OwnedPortSlots& ownedPortSlots) noexcept
 {
     // If we delete all ports from RouDi we need to reset the service registry publisher
     if (runtimeName == RuntimeName_t(iox::roudi::IPC_CHANNEL_ROUDI_NAME))
     {
         m_serviceRegistryPublisherPortData.reset();
-    }
-    auto& publisherPorts = m_portPool->getPublisherPortDataList();
-    auto publisherPort = publisherPorts.begin();
-    while (publisherPort != publisherPorts.end())
-    {
-        auto currentPort = publisherPort++;
-        PublisherPortRouDiType sender(currentPort.to_ptr());
-        if (runtimeName == sender.getRuntimeName())
-        {
-            destroyPublisherPort(currentPort.to_ptr());
-        }
+        m_serviceRegistryDeltaPublisherPortData.reset();
     }
 
-    auto& subscriberPorts = m_portPool->getSubscriberPortDataList();
-    auto subscriberPort = subscriberPorts.begin();
-    while (subscriberPort != subscriberPorts.end())
-    {
-        auto currentPort = subscriberPort++;
-        SubscriberPortUserType subscriber(currentPort.to_ptr());
-        if (runtimeName == subscriber.getRuntimeName())
-        {
-            destroySubscriberPort(currentPort.to_ptr());
-        }
-    }
+    forEachElementInSlotSet(
+        m_portPool->getPublisherPortDataList(), ownedPortSlots.publishers, [&](auto* const portData) {
+            PublisherPortRouDiType sender(portData);
+            if (runtimeName == sender.getRuntimeName())
+            {
+                destroyPublisherPort(portData);
+            }
+        });
 
-    auto& serverPorts = m_portPool->getServerPortDataList();
-    auto serverPort = serverPorts.begin();
-    while (serverPort != serverPorts.end())
-    {
-        auto currentPort = serverPort++;
-        popo::ServerPortRouDi server(*currentPort);
+    forEachElementInSlotSet(
+        m_portPool->getSubscriberPortDataList(), ownedPortSlots.subscribers, [&](auto* const portData) {
+            SubscriberPortUserType subscriber(portData);
+            if (runtimeName == subscriber.getRuntimeName())
+            {
+                destroySubscriberPort(portData);
+            }
+        });
+
+    forEachElementInSlotSet(m_portPool->getServerPortDataList(), ownedPortSlots.servers, [&](auto* const portData) {
+        popo::ServerPortRouDi server(*portData);
         if (runtimeName == server.getRuntimeName())
         {
-            destroyServerPort(currentPort.to_ptr());
+            destroyServerPort(portData);
         }
-    }
+    });
 
-    auto& clientPorts = m_portPool->getClientPortDataList();
-    auto clientPort = clientPorts.begin();
-    while (clientPort != clientPorts.end())
-    {
-        auto currentPort = clientPort++;
-        popo::ClientPortRouDi client(*currentPort);
+    forEachElementInSlotSet(m_portPool->getClientPortDataList(), ownedPortSlots.clients, [&](auto* const portData) {
+        popo::ClientPortRouDi client(*portData);
         if (runtimeName == client.getRuntimeName())
         {
-            destroyClientPort(currentPort.to_ptr());
+            destroyClientPort(portData);
         }
-    }
+    });
 
-    auto& interfacePorts = m_portPool->getInterfacePortDataList();
-    auto interfacePort = interfacePorts.begin();
-    while (interfacePort != interfacePorts.end())
-    {
-        auto currentPort = interfacePort++;
-        popo::InterfacePort interface(currentPort.to_ptr());
-        if (runtimeName == interface.getRuntimeName())
-        {
-            IOX_LOG(DEBUG, "Deleted Interface of application " << runtimeName);
-            m_portPool->removeInterfacePort(currentPort.to_ptr());
-        }
-    }
+    forEachElementInSlotSet(
+        m_portPool->getInterfacePortDataList(), ownedPortSlots.interfaces, [&](auto* const portData) {
+            popo::InterfacePort interface(portData);
+            if (runtimeName == interface.getRuntimeName())
+            {
+                IOX_LOG(DEBUG, "Deleted Interface of application " << runtimeName);
+                m_portPool->removeInterfacePort(portData);
+            }
+        });
 
-    auto& nodes = m_portPool->getNodeDataList();
-    auto node = nodes.begin();
-    while (node != nodes.end())
-    {
-        auto currentNode = node++;
-        if (runtimeName == currentNode->m_runtimeName)
+    forEachElementInSlotSet(m_portPool->getNodeDataList(), ownedPortSlots.nodes, [&](auto* const nodeData) {
+        if (runtimeName == nodeData->m_runtimeName)
         {
             IOX_LOG(DEBUG, "Deleted node of application " << runtimeName);
-            m_portPool->removeNodeData(currentNode.to_ptr());
+            m_portPool->removeNodeData(nodeData);
         }
-    }
+    });
 
-    auto& condVars = m_portPool->getConditionVariableDataList();
-    auto condVar = condVars.begin();
-    while (condVar != condVars.end())
-    {
-        auto currentCondVar = condVar++;
-        if (runtimeName == currentCondVar->m_runtimeName)
-        {
-            IOX_LOG(DEBUG, "Deleted condition variable of application" << runtimeName);
-            m_portPool->removeConditionVariableData(currentCondVar.to_ptr());
-        }
-    }
+    forEachElementInSlotSet(m_portPool->getConditionVariableDataList(),
+                            ownedPortSlots.conditionVariables,
+                            [&](auto* const conditionVariableData) {
+                                if (runtimeName == conditionVariableData->m_runtimeName)
+                                {
+                                    IOX_LOG(DEBUG, "Deleted condition variable of application" << runtimeName);
+                                    m_portPool->removeConditionVariableData(conditionVariableData);
+                                }
+                            });
+}
+
+OwnedPortSlots PortManager::collectOwnedPortSlots(const RuntimeName_t& runtimeName) noexcept
+{
+    OwnedPortSlots ownedPortSlots;
+    addSlotsOfRuntimeName(m_portPool->getPublisherPortDataList(), runtimeName, ownedPortSlots.publishers);
+    addSlotsOfRuntimeName(m_portPool->getSubscriberPortDataList(), runtimeName, ownedPortSlots.subscribers);
+    addSlotsOfRuntimeName(m_portPool->getClientPortDataList(), runtimeName, ownedPortSlots.clients);
+    addSlotsOfRuntimeName(m_portPool->getServerPortDataList(), runtimeName, ownedPortSlots.servers);
+    addSlotsOfRuntimeName(m_portPool->getInterfacePortDataList(), runtimeName, ownedPortSlots.interfaces);
+    addSlotsOfRuntimeName(m_portPool->getNodeDataList(), runtimeName, ownedPortSlots.nodes);
+    addSlotsOfRuntimeName(m_portPool->getConditionVariableDataList(), runtimeName, ownedPortSlots.conditionVariables);
+    return ownedPortSlots;
+}
+
+void PortManager::addToOwnedPortSlots(OwnedPortSlots& ownedPortSlots,
+                                      const PublisherPortRouDiType::MemberType_t* const portData) noexcept
+{
+    addToSlotSet(m_portPool->getPublisherPortDataList(), portData, ownedPortSlots.publishers);
+}
+
+void PortManager::addToOwnedPortSlots(OwnedPortSlots& ownedPortSlots,
+                                      const SubscriberPortType::MemberType_t* const portData) noexcept
+{
+    addToSlotSet(m_portPool->getSubscriberPortDataList(), portData, ownedPortSlots.subscribers);
+}
+
+void PortManager::addToOwnedPortSlots(OwnedPortSlots& ownedPortSlots,
+                                      const popo::ClientPortData* const portData) noexcept
+{
+    addToSlotSet(m_portPool->getClientPortDataList(), portData, ownedPortSlots.clients);
+}
+
+void PortManager::addToOwnedPortSlots(OwnedPortSlots& ownedPortSlots,
+                                      const popo::ServerPortData* const portData) noexcept
+{
+    addToSlotSet(m_portPool->getServerPortDataList(), portData, ownedPortSlots.servers);
+}
+
+void PortManager::addToOwnedPortSlots(OwnedPortSlots& ownedPortSlots,
+                                      const popo::InterfacePortData* const portData) noexcept
+{
+    addToSlotSet(m_portPool->getInterfacePortDataList(), portData, ownedPortSlots.interfaces);
+}
+
+void PortManager::addToOwnedPortSlots(OwnedPortSlots& ownedPortSlots, const runtime::NodeData* const nodeData) noexcept
+{
+    addToSlotSet(m_portPool->getNodeDataList(), nodeData, ownedPortSlots.nodes);
+}
+
+void PortManager::addToOwnedPortSlots(OwnedPortSlots& ownedPortSlots,
+                                      const popo::ConditionVariableData* const conditionVariableData) noexcept
+{
+    addToSlotSet(m_portPool->getConditionVariableDataList(), conditionVariableData, ownedPortSlots.conditionVariables);
 }
 
 void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* const publisherPortData) noexcept
@@ -870,6 +959,9 @@ void PortManager::destroyPublisherPort(PublisherPortRouDiType::MemberType_t* con
     PublisherPortRouDiType publisherPortRoudi{publisherPortData};
     PublisherPortUserType publisherPortUser{publisherPortData};
 
+    // the publisher does not deliver anymore, therefore the snapshot of its queues can be reclaimed
+    publisherPortData->m_chunkSenderData.m_isQueueSnapshotReaderRemoved.store(true);
+
     publisherPortUser.stopOffer();
 
     // process STOP_OFFER for this publisher in RouDi and distribute it
@@ -910,6 +1002,18 @@ void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const
         this->sendToAllMatchingPublisherPorts(caproMessage, subscriberPortRoudi);
     });
 
+    if (!releaseChunkQueueOfSubscriber(subscriberPortData))
+    {
+        IOX_LOG(WARN,
+                "The chunk queue of the subscriber port from runtime '"
+                    << subscriberPortData->m_runtimeName << "' and with service description '"
+                    << subscriberPortData->m_serviceDescription
+                    << "' is still used by a publisher! The destruction is retried later.");
+        subscriberPortUser.unsetConditionVariable();
+        subscriberPortUser.destroy();
+        return;
+    }
+
     subscriberPortRoudi.releaseAllChunks();
 
     m_portIntrospection.removeSubscriber(subscriberPortUser);
@@ -922,6 +1026,57 @@ void PortManager::destroySubscriberPort(SubscriberPortType::MemberType_t* const
     m_portPool->removeSubscriberPort(subscriberPortData);
 }
 
+bool PortManager::releaseChunkQueueOfSubscriber(SubscriberPortType::MemberType_t* const subscriberPortData) noexcept
+{
+    bool isQueueReleased{true};
+    for (auto& publisherPortData : m_portPool->getPublisherPortDataList())
+    {
+        if (publisherPortData.m_serviceDescription == subscriberPortData->m_serviceDescription)
+        {
+            PublisherPortRouDiType publisherPort(&publisherPortData);
+            if (!publisherPort.releaseChunkQueue(&subscriberPortData->m_chunkReceiverData))
+            {
+                isQueueReleased = false;
+            }
+        }
+    }
+    return isQueueReleased;
+}
+
+bool PortManager::releaseResponseQueueOfClient(popo::ClientPortData* const clientPortData) noexcept
+{
+    bool isQueueReleased{true};
+    for (auto& serverPortData : m_portPool->getServerPortDataList())
+    {
+        if (serverPortData.m_serviceDescription == clientPortData->m_serviceDescription)
+        {
+            popo::ServerPortRouDi serverPort(serverPortData);
+            if (!serverPort.releaseChunkQueue(&clientPortData->m_chunkReceiverData))
+            {
+                isQueueReleased = false;
+            }
+        }
+    }
+    return isQueueReleased;
+}
+
+bool PortManager::releaseRequestQueueOfServer(popo::ServerPortData* const serverPortData) noexcept
+{
+    bool isQueueReleased{true};
+    for (auto& clientPortData : m_portPool->getClientPortDataList())
+    {
+        if (clientPortData.m_serviceDescription == serverPortData->m_serviceDescription)
+        {
+            popo::ClientPortRouDi clientPort(clientPortData);
+            if (!clientPort.releaseChunkQueue(&serverPortData->m_chunkReceiverData))
+            {
+                isQueueReleased = false;
+            }
+        }
+    }
+    return isQueueReleased;
+}
+
 expected<PublisherPortRouDiType::MemberType_t*, PortPoolError>
 PortManager::acquirePublisherPortData(const capro::ServiceDescription& service,
                                       const popo::PublisherOptions& publisherOptions,
@@ -1123,11 +1278,25 @@ popo::InterfacePortData* PortManager::acquireInterfacePortData(capro::Interfaces
 
 void PortManager::publishServiceRegistry() noexcept
 {
-    if (!m_serviceRegistry.hasDataChangedSinceLastCall())
+    if (!m_pendingServiceRegistryChanges.empty())
     {
-        return;
+        publishServiceRegistryDelta();
+    }
+
+    // the snapshot must be published at the latest when the history of the delta publisher is exhausted, otherwise
+    // late joiners could not catch up
+    const bool isSnapshotRequired = !m_isServiceRegistrySnapshotPublished
+                                    || m_deltasSinceServiceRegistrySnapshot >= ServiceRegistryDelta::HISTORY_CAPACITY
+                                    || (m_deltasSinceServiceRegistrySnapshot > 0U
+                                        && m_serviceRegistrySnapshotTimer.hasExpired());
+    if (isSnapshotRequired)
+    {
+        publishServiceRegistrySnapshot();
     }
+}
 
+void PortManager::publishServiceRegistrySnapshot() noexcept
+{
     if (!m_serviceRegistryPublisherPortData.has_value())
     {
         // should not happen (except during RouDi shutdown)
@@ -1137,17 +1306,90 @@ void PortManager::publishServiceRegistry() noexcept
     }
     PublisherPortUserType publisher(m_serviceRegistryPublisherPortData.value());
     publisher
-        .tryAllocateChunk(sizeof(ServiceRegistry),
-                          alignof(ServiceRegistry),
+        .tryAllocateChunk(sizeof(ServiceRegistry::Entries),
+                          alignof(ServiceRegistry::Entries),
+                          sizeof(ServiceRegistrySnapshotHeader),
+                          alignof(ServiceRegistrySnapshotHeader))
+        .and_then([&](auto& chunk) {
+            new (chunk->userHeader()) ServiceRegistrySnapshotHeader{m_serviceRegistrySequenceNumber};
+            // It's ok to copy as the modifications happen in the same thread and not concurrently; the indices are
+            // not published, the subscribers rebuild them
+            new (chunk->userPayload()) ServiceRegistry::Entries(m_serviceRegistry.entries());
+
+            publisher.sendChunk(chunk);
+
+            m_isServiceRegistrySnapshotPublished = true;
+            m_deltasSinceServiceRegistrySnapshot = 0U;
+            m_serviceRegistrySnapshotTimer.reset();
+        })
+        .or_else([](auto&) { IOX_LOG(WARN, "Could not allocate a chunk for the service registry!"); });
+}
+
+void PortManager::publishServiceRegistryDelta() noexcept
+{
+    // the sequence number is also incremented when the delta cannot be published; the subscribers detect the gap
+    // and wait for the next snapshot which is enforced by exhausting the delta budget
+    ++m_serviceRegistrySequenceNumber;
+    ++m_deltasSinceServiceRegistrySnapshot;
+
+    if (!m_serviceRegistryDeltaPublisherPortData.has_value())
+    {
+        // should not happen (except during RouDi shutdown)
+        IOX_LOG(WARN, "Could not publish service registry delta!");
+        m_pendingServiceRegistryChanges.clear();
+        m_deltasSinceServiceRegistrySnapshot = ServiceRegistryDelta::HISTORY_CAPACITY;
+        return;
+    }
+    PublisherPortUserType publisher(m_serviceRegistryDeltaPublisherPortData.value());
+    publisher
+        .tryAllocateChunk(sizeof(ServiceRegistryDelta),
+                          alignof(ServiceRegistryDelta),
                           CHUNK_NO_USER_HEADER_SIZE,
                           CHUNK_NO_USER_HEADER_ALIGNMENT)
         .and_then([&](auto& chunk) {
-            // It's ok to copy as the modifications happen in the same thread and not concurrently
-            new (chunk->userPayload()) ServiceRegistry(m_serviceRegistry);
+            auto* delta = new (chunk->userPayload()) ServiceRegistryDelta();
+            delta->sequenceNumber = m_serviceRegistrySequenceNumber;
+            for (const auto& service : m_pendingServiceRegistryChanges)
+            {
+                // the change is the current state of the entry, a removed entry has zero counters
+                ServiceRegistry::ServiceDescriptionEntry change{service};
+                m_serviceRegistry.find(service.getServiceIDString(),
+                                       service.getInstanceIDString(),
+                                       service.getEventIDString(),
+                                       [&](const ServiceRegistry::ServiceDescriptionEntry& entry) {
+                                           if (entry.serviceDescription == service)
+                                           {
+                                               change = entry;
+                                           }
+                                       });
+                delta->changes.push_back(change);
+            }
 
             publisher.sendChunk(chunk);
         })
-        .or_else([](auto&) { IOX_LOG(WARN, "Could not allocate a chunk for the service registry!"); });
+        .or_else([&](auto&) {
+            IOX_LOG(WARN, "Could not allocate a chunk for the service registry delta!");
+            m_deltasSinceServiceRegistrySnapshot = ServiceRegistryDelta::HISTORY_CAPACITY;
+        });
+
+    m_pendingServiceRegistryChanges.clear();
+}
+
+void PortManager::recordServiceRegistryChange(const capro::ServiceDescription& service) noexcept
+{
+    for (const auto& pendingChange : m_pendingServiceRegistryChanges)
+    {
+        if (pendingChange == service)
+        {
+            return;
+        }
+    }
+
+    if (m_pendingServiceRegistryChanges.size() == m_pendingServiceRegistryChanges.capacity())
+    {
+        publishServiceRegistryDelta();
+    }
+    m_pendingServiceRegistryChanges.push_back(service);
 }
 
 const ServiceRegistry& PortManager::serviceRegistry() const noexcept
@@ -1157,28 +1399,35 @@ const ServiceRegistry& PortManager::serviceRegistry() const noexcept
 
 void PortManager::addPublisherToServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
-    m_serviceRegistry.addPublisher(service).or_else([&](auto&) {
-        IOX_LOG(WARN, "Could not add publisher with service description '" << service << "' to service registry!");
-        errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
-    });
+    m_serviceRegistry.addPublisher(service)
+        .and_then([&]() { recordServiceRegistryChange(service); })
+        .or_else([&](auto&) {
+            IOX_LOG(WARN,
+                    "Could not add publisher with service description '" << service << "' to service registry!");
+            errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
+        });
 }
 
 void PortManager::removePublisherFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
     m_serviceRegistry.removePublisher(service);
+    recordServiceRegistryChange(service);
 }
 
 void PortManager::addServerToServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
-    m_serviceRegistry.addServer(service).or_else([&](auto&) {
-        IOX_LOG(WARN, "Could not add server with service description '" << service << "' to service registry!");
-        errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
-    });
+    m_serviceRegistry.addServer(service)
+        .and_then([&]() { recordServiceRegistryChange(service); })
+        .or_else([&](auto&) {
+            IOX_LOG(WARN, "Could not add server with service description '" << service << "' to service registry!");
+            errorHandler(PoshError::POSH__PORT_MANAGER_COULD_NOT_ADD_SERVICE_TO_REGISTRY, ErrorLevel::MODERATE);
+        });
 }
 
 void PortManager::removeServerFromServiceRegistry(const capro::ServiceDescription& service) noexcept
 {
     m_serviceRegistry.removeServer(service);
+    recordServiceRegistryChange(service);
 }
 
 expected<runtime::NodeData*, PortPoolError> PortManager::acquireNodeData(const RuntimeName_t& runtimeName,
@@ -98,6 +98,11 @@ void PortPool::removeConditionVariableData(const popo::ConditionVariableData* co
     m_portPoolData->m_conditionVariableMembers.erase(conditionVariableData);
 }
 
+popo::ConditionVariableData& PortPool::getDiscoveryConditionVariable() noexcept
+{
+    return m_portPoolData->m_discoveryConditionVariable;
+}
+
 PortPoolData::PublisherContainer& PortPool::getPublisherPortDataList() noexcept
 {
     return m_portPoolData->m_publisherPortMembers;
@@ -125,6 +130,7 @@ PortPool::addPublisherPort(const capro::ServiceDescription& serviceDescription,
         errorHandler(PoshError::PORT_POOL__PUBLISHERLIST_OVERFLOW, ErrorLevel::MODERATE);
         return err(PortPoolError::PUBLISHER_PORT_LIST_FULL);
     }
+    publisherPortData->m_discoveryConditionVariableDataPtr = &getDiscoveryConditionVariable();
     return ok(publisherPortData.to_ptr());
 }
 
@@ -144,6 +150,7 @@ PortPool::addSubscriberPort(const capro::ServiceDescription& serviceDescription,
         errorHandler(PoshError::PORT_POOL__SUBSCRIBERLIST_OVERFLOW, ErrorLevel::MODERATE);
         return err(PortPoolError::SUBSCRIBER_PORT_LIST_FULL);
     }
+    subscriberPortData->m_discoveryConditionVariableDataPtr = &getDiscoveryConditionVariable();
     return ok(subscriberPortData);
 }
 
@@ -174,6 +181,7 @@ PortPool::addClientPort(const capro::ServiceDescription& serviceDescription,
         errorHandler(PoshError::PORT_POOL__CLIENTLIST_OVERFLOW, ErrorLevel::MODERATE);
         return err(PortPoolError::CLIENT_PORT_LIST_FULL);
     }
+    clientPortData->m_discoveryConditionVariableDataPtr = &getDiscoveryConditionVariable();
     return ok(clientPortData.to_ptr());
 }
 
@@ -194,6 +202,7 @@ PortPool::addServerPort(const capro::ServiceDescription& serviceDescription,
         errorHandler(PoshError::PORT_POOL__SERVERLIST_OVERFLOW, ErrorLevel::MODERATE);
         return err(PortPoolError::SERVER_PORT_LIST_FULL);
     }
+    serverPortData->m_discoveryConditionVariableDataPtr = &getDiscoveryConditionVariable();
     return ok(serverPortData.to_ptr());
 }
 
@@ -16,7 +16,10 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/roudi/process.hpp"
+#include "iceoryx_platform/errno.hpp"
 #include "iceoryx_platform/types.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iceoryx_platform/wait.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iox/logging.hpp"
 
@@ -30,14 +33,31 @@ Process::Process(const RuntimeName_t& name,
                  const PosixUser& user,
                  const HeartbeatPoolIndexType heartbeatPoolIndex,
                  const uint64_t sessionId) noexcept
+    : Process(runtime::IpcInterfaceUser(name), pid, user, heartbeatPoolIndex, sessionId)
+{
+}
+
+Process::Process(runtime::IpcInterfaceUser&& ipcChannel,
+                 const uint32_t pid,
+                 const PosixUser& user,
+                 const HeartbeatPoolIndexType heartbeatPoolIndex,
+                 const uint64_t sessionId) noexcept
     : m_pid(pid)
-    , m_ipcChannel(name)
+    , m_ipcChannel(std::move(ipcChannel))
     , m_heartbeatPoolIndex(heartbeatPoolIndex)
     , m_user(user)
     , m_sessionId(sessionId)
 {
 }
 
+Process::~Process() noexcept
+{
+    if (m_pidfd != INVALID_PIDFD)
+    {
+        iox_close(m_pidfd);
+    }
+}
+
 uint32_t Process::getPid() const noexcept
 {
     return m_pid;
@@ -48,7 +68,7 @@ const RuntimeName_t Process::getName() const noexcept
     return m_ipcChannel.getRuntimeName();
 }
 
-void Process::sendViaIpcChannel(const runtime::IpcMessage& data) noexcept
+void Process::sendViaIpcChannel(const runtime::IpcMessage& data) const noexcept
 {
     bool sendSuccess = m_ipcChannel.send(data);
     if (!sendSuccess)
@@ -78,5 +98,60 @@ bool Process::isMonitored() const noexcept
     return m_heartbeatPoolIndex != HeartbeatPool::Index::INVALID;
 }
 
+bool Process::watchTermination(const int pidfdWatcher) noexcept
+{
+    if (m_pidfd != INVALID_PIDFD)
+    {
+        return true;
+    }
+
+    const int pidfd = iox_pidfd_open(static_cast<pid_t>(m_pid));
+    if (pidfd == INVALID_PIDFD)
+    {
+        const auto error = errno;
+        if (error == ENOSYS)
+        {
+            // only warn once since the missing support affects all processes
+            static std::atomic_bool isWarned{false};
+            if (!isWarned.exchange(true))
+            {
+                IOX_LOG(WARN, "Watching processes with a pidfd is not supported! Falling back to the heartbeat.");
+            }
+        }
+        else
+        {
+            IOX_LOG(WARN,
+                    "Could not watch application " << getName() << " with a pidfd! Falling back to the heartbeat. "
+                                                   << "Error: " << error);
+        }
+        return false;
+    }
+
+    m_pidfd = pidfd;
+
+    // without the watcher the termination is still detected, but only with the next cyclic run of the discovery loop
+    if (iox_pidfd_watcher_add(pidfdWatcher, m_pidfd) != 0)
+    {
+        IOX_LOG(WARN,
+                "Could not add the pidfd of application " << getName() << " to the watcher! Error: " << errno);
+    }
+    return true;
+}
+
+bool Process::hasTerminated() const noexcept
+{
+    return m_pidfd != INVALID_PIDFD && iox_pidfd_is_terminated(m_pidfd) == 1;
+}
+
+OwnedPortSlots& Process::getOwnedPortSlots() noexcept
+{
+    return m_ownedPortSlots;
+}
+
+const OwnedPortSlots& Process::getOwnedPortSlots() const noexcept
+{
+    return m_ownedPortSlots;
+}
+
 } // namespace roudi
 } // namespace iox
@@ -18,7 +18,9 @@
 
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
 #include "iceoryx_platform/signal.hpp"
+#include "iceoryx_platform/errno.hpp"
 #include "iceoryx_platform/types.hpp"
+#include "iceoryx_platform/unistd.hpp"
 #include "iceoryx_platform/wait.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iox/detail/convert.hpp"
@@ -39,10 +41,12 @@ namespace roudi
 {
 ProcessManager::ProcessManager(RouDiMemoryInterface& roudiMemoryInterface,
                                PortManager& portManager,
-                               const version::CompatibilityCheckLevel compatibilityCheckLevel) noexcept
+                               const version::CompatibilityCheckLevel compatibilityCheckLevel,
+                               const ProcessExitDetection processExitDetection) noexcept
     : m_roudiMemoryInterface(roudiMemoryInterface)
     , m_portManager(portManager)
     , m_compatibilityCheckLevel(compatibilityCheckLevel)
+    , m_processExitDetection(processExitDetection)
 {
     bool fatalError{false};
 
@@ -95,13 +99,34 @@ ProcessManager::ProcessManager(RouDiMemoryInterface& roudiMemoryInterface,
         /// @todo iox-#539 Use separate error enums once RouDi is more modular
         errorHandler(PoshError::ROUDI__PRECONDITIONS_FOR_PROCESS_MANAGER_NOT_FULFILLED, ErrorLevel::FATAL);
     }
+
+    if (m_processExitDetection == ProcessExitDetection::PIDFD)
+    {
+        m_pidNamespaceId = iox_pid_namespace_id();
+        m_pidfdWatcher = iox_pidfd_watcher_create();
+        if (m_pidfdWatcher == INVALID_PIDFD_WATCHER)
+        {
+            IOX_LOG(WARN,
+                    "Could not create the pidfd watcher! Terminations are only detected with the cyclic run of the "
+                    "discovery loop. Error: "
+                        << errno);
+        }
+    }
+}
+
+ProcessManager::~ProcessManager() noexcept
+{
+    if (m_pidfdWatcher != INVALID_PIDFD_WATCHER)
+    {
+        iox_close(m_pidfdWatcher);
+    }
 }
 
 void ProcessManager::handleProcessShutdownPreparationRequest(const RuntimeName_t& name) noexcept
 {
     findProcess(name)
         .and_then([&](auto& process) {
-            m_portManager.unblockProcessShutdown(name);
+            m_portManager.unblockProcessShutdown(name, process->getOwnedPortSlots());
             // Reply with PREPARE_APP_TERMINATION_ACK and let process shutdown
             runtime::IpcMessage sendBuffer;
             sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::PREPARE_APP_TERMINATION_ACK);
@@ -222,9 +247,30 @@ bool ProcessManager::registerProcess(const RuntimeName_t& name,
                                      const bool isMonitored,
                                      const int64_t transmissionTimestamp,
                                      const uint64_t sessionId,
-                                     const version::VersionInfo& versionInfo) noexcept
+                                     const version::VersionInfo& versionInfo,
+                                     const uint64_t pidNamespaceId) noexcept
+{
+    return registerProcess(runtime::IpcInterfaceUser(name),
+                           pid,
+                           user,
+                           isMonitored,
+                           transmissionTimestamp,
+                           sessionId,
+                           versionInfo,
+                           pidNamespaceId);
+}
+
+bool ProcessManager::registerProcess(runtime::IpcInterfaceUser&& ipcChannel,
+                                     const uint32_t pid,
+                                     const PosixUser user,
+                                     const bool isMonitored,
+                                     const int64_t transmissionTimestamp,
+                                     const uint64_t sessionId,
+                                     const version::VersionInfo& versionInfo,
+                                     const uint64_t pidNamespaceId) noexcept
 {
     bool returnValue{false};
+    const auto name = ipcChannel.getRuntimeName();
 
     findProcess(name)
         .and_then([&](auto& process) {
@@ -251,26 +297,41 @@ bool ProcessManager::registerProcess(const RuntimeName_t& name,
             else
             {
                 // try registration again, should succeed since removal was successful
-                returnValue =
-                    this->addProcess(name, pid, user, isMonitored, transmissionTimestamp, sessionId, versionInfo);
+                returnValue = this->addProcess(std::move(ipcChannel),
+                                               pid,
+                                               user,
+                                               isMonitored,
+                                               transmissionTimestamp,
+                                               sessionId,
+                                               versionInfo,
+                                               pidNamespaceId);
             }
         })
         .or_else([&]() {
             // process does not exist in list and can be added
-            returnValue = this->addProcess(name, pid, user, isMonitored, transmissionTimestamp, sessionId, versionInfo);
+            returnValue = this->addProcess(std::move(ipcChannel),
+                                           pid,
+                                           user,
+                                           isMonitored,
+                                           transmissionTimestamp,
+                                           sessionId,
+                                           versionInfo,
+                                           pidNamespaceId);
         });
 
     return returnValue;
 }
 
-bool ProcessManager::addProcess(const RuntimeName_t& name,
+bool ProcessManager::addProcess(runtime::IpcInterfaceUser&& ipcChannel,
                                 const uint32_t pid,
                                 const PosixUser& user,
                                 const bool isMonitored,
                                 const int64_t transmissionTimestamp,
                                 const uint64_t sessionId,
-                                const version::VersionInfo& versionInfo) noexcept
+                                const version::VersionInfo& versionInfo,
+                                const uint64_t pidNamespaceId) noexcept
 {
+    const auto name = ipcChannel.getRuntimeName();
     if (!version::VersionInfo::getCurrentVersion().checkCompatibility(versionInfo, m_compatibilityCheckLevel))
     {
         IOX_LOG(
@@ -298,7 +359,23 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
         heartbeatPoolIndex = heartbeat.to_index();
         heartbeatOffset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, heartbeat.to_ptr());
     }
-    m_processList.emplace_back(name, pid, user, heartbeatPoolIndex, sessionId);
+    m_processList.emplace_back(std::move(ipcChannel), pid, user, heartbeatPoolIndex, sessionId);
+
+    if (isMonitored && m_processExitDetection == ProcessExitDetection::PIDFD)
+    {
+        // a pid from another PID namespace could refer to an unrelated process of the namespace of RouDi
+        if (pidNamespaceId != 0U && pidNamespaceId == m_pidNamespaceId)
+        {
+            m_processList.back().watchTermination(m_pidfdWatcher);
+        }
+        else
+        {
+            IOX_LOG(WARN,
+                    "Application " << name
+                                   << " is not in the PID namespace of RouDi! Its termination is only detected by "
+                                      "the heartbeat.");
+        }
+    }
 
     // send REG_ACK and BaseAddrString
     runtime::IpcMessage sendBuffer;
@@ -306,7 +383,8 @@ bool ProcessManager::addProcess(const RuntimeName_t& name,
     auto segmentManagerOffset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, m_segmentManager);
     sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::REG_ACK)
                << m_roudiMemoryInterface.mgmtMemoryProvider()->size() << segmentManagerOffset << transmissionTimestamp
-               << m_mgmtSegmentId << heartbeatOffset;
+               << m_mgmtSegmentId << heartbeatOffset
+               << m_roudiMemoryInterface.mgmtMemoryProvider()->isLockedInMemory();
 
     m_processList.back().sendViaIpcChannel(sendBuffer);
 
@@ -352,7 +430,7 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
 {
     if (processIter != m_processList.end())
     {
-        m_portManager.deletePortsOfProcess(processIter->getName());
+        m_portManager.deletePortsOfProcess(processIter->getName(), processIter->getOwnedPortSlots());
         m_processIntrospection->removeProcess(static_cast<int32_t>(processIter->getPid()));
 
         if (feedback == TerminationFeedback::SEND_ACK_TO_PROCESS)
@@ -374,6 +452,12 @@ bool ProcessManager::removeProcessAndDeleteRespectiveSharedMemoryObjects(Process
     return false;
 }
 
+runtime::Heartbeat* ProcessManager::heartbeatOfProcess(const Process& process) noexcept
+{
+    auto heartbeatIterator = m_heartbeatPool->iter_from_index(process.getHeartbeatPoolIndex());
+    return (heartbeatIterator != m_heartbeatPool->end()) ? heartbeatIterator.to_ptr() : nullptr;
+}
+
 void ProcessManager::addInterfaceForProcess(const RuntimeName_t& name,
                                             capro::Interfaces interface,
                                             const NodeName_t& node) noexcept
@@ -382,6 +466,7 @@ void ProcessManager::addInterfaceForProcess(const RuntimeName_t& name,
         .and_then([&](auto& process) {
             // create a ReceiverPort
             popo::InterfacePortData* port = m_portManager.acquireInterfacePortData(interface, name, node);
+            m_portManager.addToOwnedPortSlots(process->getOwnedPortSlots(), port);
 
             // send ReceiverPort to app as a serialized relative pointer
             auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, port);
@@ -402,6 +487,7 @@ void ProcessManager::addNodeForProcess(const RuntimeName_t& runtimeName, const N
         .and_then([&](auto& process) {
             m_portManager.acquireNodeData(runtimeName, nodeName)
                 .and_then([&](auto nodeData) {
+                    m_portManager.addToOwnedPortSlots(process->getOwnedPortSlots(), nodeData);
                     auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, nodeData);
 
                     runtime::IpcMessage sendBuffer;
@@ -429,7 +515,12 @@ void ProcessManager::addNodeForProcess(const RuntimeName_t& runtimeName, const N
         .or_else([&]() { IOX_LOG(WARN, "Unknown process " << runtimeName << " requested a node."); });
 }
 
-void ProcessManager::sendMessageNotSupportedToRuntime(const RuntimeName_t& name) noexcept
+int ProcessManager::pidfdWatcher() const noexcept
+{
+    return m_pidfdWatcher;
+}
+
+void ProcessManager::sendMessageNotSupportedToRuntime(const RuntimeName_t& name) const noexcept
 {
     findProcess(name).and_then([&](auto& process) {
         runtime::IpcMessage sendBuffer;
@@ -447,34 +538,9 @@ void ProcessManager::addSubscriberForProcess(const RuntimeName_t& name,
 {
     findProcess(name)
         .and_then([&](auto& process) {
-            // create a SubscriberPort
-            auto maybeSubscriber =
-                m_portManager.acquireSubscriberPortData(service, subscriberOptions, name, portConfigInfo);
-
-            if (maybeSubscriber.has_value())
-            {
-                // send SubscriberPort to app as a serialized relative pointer
-                auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybeSubscriber.value());
-
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK)
-                           << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
-                process->sendViaIpcChannel(sendBuffer);
-
-                IOX_LOG(DEBUG,
-                        "Created new SubscriberPort for application '" << name << "' with service description '"
-                                                                       << service << "'");
-            }
-            else
-            {
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
-                process->sendViaIpcChannel(sendBuffer);
-                IOX_LOG(ERROR,
-                        "Could not create SubscriberPort for application '" << name << "' with service description '"
-                                                                            << service << "'");
-            }
+            runtime::IpcMessage sendBuffer;
+            acquireSubscriberForProcess(*process, service, subscriberOptions, portConfigInfo, sendBuffer);
+            process->sendViaIpcChannel(sendBuffer);
         })
         .or_else([&]() {
             IOX_LOG(WARN,
@@ -483,80 +549,155 @@ void ProcessManager::addSubscriberForProcess(const RuntimeName_t& name,
         });
 }
 
+void ProcessManager::acquireSubscriberForProcess(Process& process,
+                                                 const capro::ServiceDescription& service,
+                                                 const popo::SubscriberOptions& subscriberOptions,
+                                                 const PortConfigInfo& portConfigInfo,
+                                                 runtime::IpcMessage& response) noexcept
+{
+    const auto name = process.getName();
+
+    // create a SubscriberPort
+    auto maybeSubscriber = m_portManager.acquireSubscriberPortData(service, subscriberOptions, name, portConfigInfo);
+
+    if (maybeSubscriber.has_value())
+    {
+        m_portManager.addToOwnedPortSlots(process.getOwnedPortSlots(), maybeSubscriber.value());
+
+        // send SubscriberPort to app as a serialized relative pointer
+        auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybeSubscriber.value());
+
+        response << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_SUBSCRIBER_ACK)
+                 << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
+
+        IOX_LOG(DEBUG,
+                "Created new SubscriberPort for application '" << name << "' with service description '" << service
+                                                               << "'");
+    }
+    else
+    {
+        response << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
+        response << runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::SUBSCRIBER_LIST_FULL);
+        IOX_LOG(ERROR,
+                "Could not create SubscriberPort for application '" << name << "' with service description '"
+                                                                    << service << "'");
+    }
+}
+
 void ProcessManager::addPublisherForProcess(const RuntimeName_t& name,
                                             const capro::ServiceDescription& service,
                                             const popo::PublisherOptions& publisherOptions,
                                             const PortConfigInfo& portConfigInfo) noexcept
 {
     findProcess(name)
-        .and_then([&](auto& process) { // create a PublisherPort
-            auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process->getUser());
+        .and_then([&](auto& process) {
+            runtime::IpcMessage sendBuffer;
+            acquirePublisherForProcess(*process, service, publisherOptions, portConfigInfo, sendBuffer);
+            process->sendViaIpcChannel(sendBuffer);
+        })
+        .or_else([&]() {
+            IOX_LOG(WARN,
+                    "Unknown application '" << name << "' requested a PublisherPort with service description '"
+                                            << service << "'");
+        });
+}
 
-            if (!segmentInfo.m_memoryManager.has_value())
-            {
-                // Tell the app no writable shared memory segment was found
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
-                sendBuffer << runtime::IpcMessageErrorTypeToString(
-                    runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
-                process->sendViaIpcChannel(sendBuffer);
-                return;
-            }
+void ProcessManager::acquirePublisherForProcess(Process& process,
+                                                const capro::ServiceDescription& service,
+                                                const popo::PublisherOptions& publisherOptions,
+                                                const PortConfigInfo& portConfigInfo,
+                                                runtime::IpcMessage& response) noexcept
+{
+    const auto name = process.getName();
 
-            auto maybePublisher = m_portManager.acquirePublisherPortData(
-                service, publisherOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
+    // create a PublisherPort
+    auto segmentInfo = m_segmentManager->getSegmentInformationWithWriteAccessForUser(process.getUser());
 
-            if (maybePublisher.has_value())
-            {
-                // send PublisherPort to app as a serialized relative pointer
-                auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybePublisher.value());
+    if (!segmentInfo.m_memoryManager.has_value())
+    {
+        // Tell the app no writable shared memory segment was found
+        response << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
+        response << runtime::IpcMessageErrorTypeToString(
+            runtime::IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT);
+        return;
+    }
 
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER_ACK)
-                           << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
-                process->sendViaIpcChannel(sendBuffer);
+    auto maybePublisher = m_portManager.acquirePublisherPortData(
+        service, publisherOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo);
 
-                IOX_LOG(DEBUG,
-                        "Created new PublisherPort for application '" << name << "' with service description '"
-                                                                      << service << "'");
-            }
-            else
-            {
-                runtime::IpcMessage sendBuffer;
-                sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
+    if (maybePublisher.has_value())
+    {
+        m_portManager.addToOwnedPortSlots(process.getOwnedPortSlots(), maybePublisher.value());
+        maybePublisher.value()->m_chunkSenderData.m_queueSnapshotReaderHeartbeat = heartbeatOfProcess(process);
 
-                std::string error;
-                switch (maybePublisher.error())
-                {
-                case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::NO_UNIQUE_CREATED);
-                    break;
-                }
-                case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
+        // send PublisherPort to app as a serialized relative pointer
+        auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, maybePublisher.value());
+
+        response << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PUBLISHER_ACK)
+                 << convert::toString(offset) << convert::toString(m_mgmtSegmentId);
+
+        IOX_LOG(DEBUG,
+                "Created new PublisherPort for application '" << name << "' with service description '" << service
+                                                              << "'");
+    }
+    else
+    {
+        response << runtime::IpcMessageTypeToString(runtime::IpcMessageType::ERROR);
+
+        std::string error;
+        switch (maybePublisher.error())
+        {
+        case PortPoolError::UNIQUE_PUBLISHER_PORT_ALREADY_EXISTS:
+        {
+            error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::NO_UNIQUE_CREATED);
+            break;
+        }
+        case PortPoolError::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
+        {
+            error = runtime::IpcMessageErrorTypeToString(
+                runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
+            break;
+        }
+        default:
+        {
+            error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL);
+            break;
+        }
+        }
+        response << error;
+
+        IOX_LOG(ERROR,
+                "Could not create PublisherPort for application '" << name << "' with service description '"
+                                                                   << service << "'");
+    }
+}
+
+void ProcessManager::addPortsForProcess(const RuntimeName_t& name, const runtime::PortBatch& batch) noexcept
+{
+    findProcess(name)
+        .and_then([&](auto& process) {
+            // the responses for the ports are sent in the order of the batch with a single message
+            runtime::IpcMessage sendBuffer;
+            sendBuffer << runtime::IpcMessageTypeToString(runtime::IpcMessageType::CREATE_PORTS_ACK);
+            for (uint64_t i = 0U; i < batch.size(); ++i)
+            {
+                const auto& entry = batch[i];
+                switch (entry.kind)
                 {
-                    error = runtime::IpcMessageErrorTypeToString(
-                        runtime::IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN);
+                case runtime::PortBatch::PortKind::PUBLISHER:
+                    acquirePublisherForProcess(
+                        *process, entry.service, entry.publisherOptions, entry.portConfigInfo, sendBuffer);
                     break;
-                }
-                default:
-                {
-                    error = runtime::IpcMessageErrorTypeToString(runtime::IpcMessageErrorType::PUBLISHER_LIST_FULL);
+                case runtime::PortBatch::PortKind::SUBSCRIBER:
+                    acquireSubscriberForProcess(
+                        *process, entry.service, entry.subscriberOptions, entry.portConfigInfo, sendBuffer);
                     break;
                 }
-                }
-                sendBuffer << error;
-
-                process->sendViaIpcChannel(sendBuffer);
-                IOX_LOG(ERROR,
-                        "Could not create PublisherPort for application '" << name << "' with service description '"
-                                                                           << service << "'");
             }
+            process->sendViaIpcChannel(sendBuffer);
         })
         .or_else([&]() {
-            IOX_LOG(WARN,
-                    "Unknown application '" << name << "' requested a PublisherPort with service description '"
-                                            << service << "'");
+            IOX_LOG(WARN, "Unknown application '" << name << "' requested a batch of " << batch.size() << " ports");
         });
 }
 
@@ -584,6 +725,8 @@ void ProcessManager::addClientForProcess(const RuntimeName_t& name,
                 .acquireClientPortData(
                     service, clientOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo)
                 .and_then([&](auto& clientPort) {
+                    m_portManager.addToOwnedPortSlots(process->getOwnedPortSlots(), clientPort);
+                    clientPort->m_chunkSenderData.m_queueSnapshotReaderHeartbeat = heartbeatOfProcess(*process);
                     auto relativePtrToClientPort =
                         UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, clientPort);
 
@@ -638,6 +781,8 @@ void ProcessManager::addServerForProcess(const RuntimeName_t& name,
                 .acquireServerPortData(
                     service, serverOptions, name, &segmentInfo.m_memoryManager.value().get(), portConfigInfo)
                 .and_then([&](auto& serverPort) {
+                    m_portManager.addToOwnedPortSlots(process->getOwnedPortSlots(), serverPort);
+                    serverPort->m_chunkSenderData.m_queueSnapshotReaderHeartbeat = heartbeatOfProcess(*process);
                     auto relativePtrToServerPort =
                         UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, serverPort);
 
@@ -674,6 +819,7 @@ void ProcessManager::addConditionVariableForProcess(const RuntimeName_t& runtime
         .and_then([&](auto& process) { // Try to create a condition variable
             m_portManager.acquireConditionVariableData(runtimeName)
                 .and_then([&](auto condVar) {
+                    m_portManager.addToOwnedPortSlots(process->getOwnedPortSlots(), condVar);
                     auto offset = UntypedRelativePointer::getOffset(segment_id_t{m_mgmtSegmentId}, condVar);
 
                     runtime::IpcMessage sendBuffer;
@@ -733,10 +879,39 @@ optional<Process*> ProcessManager::findProcess(const RuntimeName_t& name) noexce
     return nullopt;
 }
 
+optional<const Process*> ProcessManager::findProcess(const RuntimeName_t& name) const noexcept
+{
+    for (const auto& process : m_processList)
+    {
+        if (process.getName() == name)
+        {
+            return make_optional<const Process*>(&process);
+        }
+    }
+
+    return nullopt;
+}
+
 void ProcessManager::monitorProcesses() noexcept
 {
     static_assert(runtime::PROCESS_KEEP_ALIVE_TIMEOUT > runtime::PROCESS_KEEP_ALIVE_INTERVAL,
                   "keep alive timeout too small");
+
+    // terminated processes which are watched with a pidfd are removed right away instead of waiting for the timeout
+    // of the heartbeat, which stays the fallback for hung processes
+    auto watchedProcessIterator = m_processList.begin();
+    while (watchedProcessIterator != m_processList.end())
+    {
+        if (watchedProcessIterator->hasTerminated())
+        {
+            IOX_LOG(WARN, "Application " << watchedProcessIterator->getName() << " terminated --> removing it");
+            removeProcessAndDeleteRespectiveSharedMemoryObjects(watchedProcessIterator,
+                                                                TerminationFeedback::DO_NOT_SEND_ACK_TO_PROCESS);
+            continue;
+        }
+        ++watchedProcessIterator;
+    }
+
     auto timeout = runtime::PROCESS_KEEP_ALIVE_TIMEOUT.toMilliseconds();
     auto heartbeatIterator = m_heartbeatPool->begin();
     while (heartbeatIterator != m_heartbeatPool->end())
@@ -17,11 +17,15 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/roudi/roudi.hpp"
+#include "iceoryx_platform/errno.hpp"
+#include "iceoryx_platform/wait.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_notifier.hpp"
 #include "iceoryx_posh/internal/runtime/node_property.hpp"
 #include "iceoryx_posh/popo/subscriber_options.hpp"
-#include "iceoryx_posh/popo/wait_set.hpp"
 #include "iceoryx_posh/roudi/introspection_types.hpp"
 #include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/algorithm.hpp"
 #include "iox/detail/convert.hpp"
 #include "iox/detail/system_configuration.hpp"
 #include "iox/logging.hpp"
@@ -29,6 +33,9 @@
 #include "iox/std_string_support.hpp"
 #include "iox/thread.hpp"
 
+#include <atomic>
+#include <vector>
+
 namespace iox
 {
 namespace roudi
@@ -44,7 +51,8 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
     , m_prcMgr(concurrent::ForwardArgsToCTor,
                *m_roudiMemoryInterface,
                portManager,
-               roudiStartupParameters.m_compatibilityCheckLevel)
+               roudiStartupParameters.m_compatibilityCheckLevel,
+               roudiStartupParameters.m_processExitDetection)
     , m_mempoolIntrospection(
           *m_roudiMemoryInterface->introspectionMemoryManager().value(),
           *m_roudiMemoryInterface->segmentManager().value(),
@@ -52,11 +60,20 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
     , m_monitoringMode(roudiStartupParameters.m_monitoringMode)
     , m_processTerminationDelay(roudiStartupParameters.m_processTerminationDelay)
     , m_processKillDelay(roudiStartupParameters.m_processKillDelay)
+    , m_runtimeMessagesThreadCount(roudiStartupParameters.m_runtimeMessagesThreadCount)
 {
     if (detail::isCompiledOn32BitSystem())
     {
         IOX_LOG(WARN, "Runnning RouDi on 32-bit architectures is not supported! Use at your own risk!");
     }
+    if (m_runtimeMessagesThreadCount == 0U || m_runtimeMessagesThreadCount > MAX_RUNTIME_MESSAGES_THREAD_COUNT)
+    {
+        m_runtimeMessagesThreadCount =
+            algorithm::maxVal(1U, algorithm::minVal(m_runtimeMessagesThreadCount, MAX_RUNTIME_MESSAGES_THREAD_COUNT));
+        IOX_LOG(WARN,
+                "The number of threads processing runtime messages must be in the range of [1, "
+                    << MAX_RUNTIME_MESSAGES_THREAD_COUNT << "]! Using " << m_runtimeMessagesThreadCount << " threads.");
+    }
     m_processIntrospection.registerPublisherPort(
         PublisherPortUserType(m_prcMgr->addIntrospectionPublisherPort(IntrospectionProcessService)));
     m_prcMgr->initIntrospection(&m_processIntrospection);
@@ -75,6 +92,10 @@ RouDi::RouDi(RouDiMemoryInterface& roudiMemoryInterface,
 
     // run the threads
     m_monitoringAndDiscoveryThread = std::thread(&RouDi::monitorAndDiscoveryUpdate, this);
+    if (roudiStartupParameters.m_processExitDetection == ProcessExitDetection::PIDFD)
+    {
+        m_processTerminationWatcherThread = std::thread(&RouDi::watchProcessTermination, this);
+    }
 
     if (roudiStartupParameters.m_runtimesMessagesThreadStart == RuntimeMessagesThreadStart::IMMEDIATE)
     {
@@ -97,7 +118,7 @@ void RouDi::shutdown() noexcept
     // trigger the shutdown of the monitoring and discovery thread in order to prevent application to register while
     // shutting down
     m_runMonitoringAndDiscoveryThread = false;
-    m_discoveryLoopTrigger.trigger();
+    triggerDiscoveryLoop();
 
     // stop the introspection
     m_processIntrospection.stop();
@@ -112,6 +133,11 @@ void RouDi::shutdown() noexcept
         IOX_LOG(DEBUG, "...'Mon+Discover' thread joined.");
     }
 
+    if (m_processTerminationWatcherThread.joinable())
+    {
+        m_processTerminationWatcherThread.join();
+    }
+
     if (m_killProcessesInDestructor)
     {
         deadline_timer terminationDelayTimer(m_processTerminationDelay);
@@ -190,7 +216,7 @@ void RouDi::triggerDiscoveryLoopAndWaitToFinish(units::Duration timeout) noexcep
                             << static_cast<uint32_t>(error));
             });
     }
-    m_discoveryLoopTrigger.trigger();
+    triggerDiscoveryLoop();
     m_discoveryFinishedSemaphore->timedWait(timeout).or_else([](const auto& error) {
         IOX_LOG(ERROR,
                 "A timed wait on the semaphore which signals a finished run of the "
@@ -199,22 +225,19 @@ void RouDi::triggerDiscoveryLoopAndWaitToFinish(units::Duration timeout) noexcep
     });
 }
 
+void RouDi::triggerDiscoveryLoop() noexcept
+{
+    popo::ConditionNotifier(m_portManager->getDiscoveryConditionVariable(), DISCOVERY_LOOP_TRIGGER_NOTIFICATION_INDEX)
+        .notify();
+}
+
 void RouDi::monitorAndDiscoveryUpdate() noexcept
 {
     setThreadName("Mon+Discover");
 
-    class DiscoveryWaitSet : public popo::WaitSet<1>
-    {
-      public:
-        DiscoveryWaitSet(popo::ConditionVariableData& condVarData) noexcept
-            : WaitSet(condVarData)
-        {
-        }
-    };
-
-    popo::ConditionVariableData conditionVariableData;
-    DiscoveryWaitSet discoveryLoopWaitset{conditionVariableData};
-    discoveryLoopWaitset.attachEvent(m_discoveryLoopTrigger).expect("Failed to attach a single event");
+    // the ports notify the discovery condition variable when a state change is requested, therefore the
+    // DISCOVERY_INTERVAL is only a fallback
+    popo::ConditionListener discoveryLoopListener{m_portManager->getDiscoveryConditionVariable()};
     bool manuallyTriggered{false};
 
     while (m_runMonitoringAndDiscoveryThread)
@@ -233,9 +256,9 @@ void RouDi::monitorAndDiscoveryUpdate() noexcept
         }
 
         manuallyTriggered = false;
-        for (const auto& notification : discoveryLoopWaitset.timedWait(DISCOVERY_INTERVAL))
+        for (const auto notificationIndex : discoveryLoopListener.timedWait(DISCOVERY_INTERVAL))
         {
-            if (notification->doesOriginateFrom(&m_discoveryLoopTrigger))
+            if (notificationIndex == DISCOVERY_LOOP_TRIGGER_NOTIFICATION_INDEX)
             {
                 manuallyTriggered = true;
                 break;
@@ -250,17 +273,74 @@ void RouDi::processRuntimeMessages() noexcept
 
     runtime::IpcInterfaceCreator roudiIpcInterface{IPC_CHANNEL_ROUDI_NAME};
 
+    // the additional threads share the IPC channel with this thread; the receiving, the parsing and the preparation
+    // of the requests, like looking up the user of a registering process and opening the IPC channel to it, run
+    // concurrently; requests which only read the ProcessManager share its lock while the mutating requests are
+    // processed one after another
+    std::vector<std::thread> additionalThreads;
+    additionalThreads.reserve(m_runtimeMessagesThreadCount - 1U);
+    for (uint32_t i = 1U; i < m_runtimeMessagesThreadCount; ++i)
+    {
+        additionalThreads.emplace_back([this, &roudiIpcInterface] {
+            setThreadName("IPC-msg-process");
+            receiveAndProcessRuntimeMessages(roudiIpcInterface);
+        });
+    }
+
     IOX_LOG(INFO, "RouDi is ready for clients");
     fflush(stdout); // explicitly flush 'stdout' for 'launch_testing'
 
+    receiveAndProcessRuntimeMessages(roudiIpcInterface);
+
+    for (auto& thread : additionalThreads)
+    {
+        thread.join();
+    }
+}
+
+void RouDi::watchProcessTermination() noexcept
+{
+    setThreadName("ExitWatch");
+
+    // the watcher outlives this thread and is waited on without locking the ProcessManager
+    const int pidfdWatcher = m_prcMgr->pidfdWatcher();
+    if (pidfdWatcher == ProcessManager::INVALID_PIDFD_WATCHER)
+    {
+        return;
+    }
+
+    popo::ConditionNotifier discoveryLoopNotifier(m_portManager->getDiscoveryConditionVariable(),
+                                                  DISCOVERY_PROCESS_TERMINATION_NOTIFICATION_INDEX);
+    const auto timeoutInMs = static_cast<int>(DISCOVERY_INTERVAL.toMilliseconds());
+    while (m_runMonitoringAndDiscoveryThread)
+    {
+        const int terminatedProcesses = iox_pidfd_watcher_wait(pidfdWatcher, timeoutInMs);
+        if (terminatedProcesses < 0)
+        {
+            IOX_LOG(WARN,
+                    "Waiting for the termination of processes failed! Terminations are only detected with the "
+                    "cyclic run of the discovery loop. Error: "
+                        << errno);
+            return;
+        }
+        if (terminatedProcesses > 0)
+        {
+            discoveryLoopNotifier.notify();
+        }
+    }
+}
+
+void RouDi::receiveAndProcessRuntimeMessages(const runtime::IpcInterfaceCreator& roudiIpcInterface) noexcept
+{
     while (m_runHandleRuntimeMessageThread)
     {
         // read RouDi's IPC channel
         runtime::IpcMessage message;
         if (roudiIpcInterface.timedReceive(m_runtimeMessagesThreadTimeout, message))
         {
-            auto cmd = runtime::stringToIpcMessageType(message.getElementAtIndex(0).c_str());
-            RuntimeName_t runtimeName{into<lossy<RuntimeName_t>>(message.getElementAtIndex(1))};
+            runtime::IpcMessage::Cursor cursor(message);
+            auto cmd = runtime::stringToIpcMessageType(cursor.next().c_str());
+            RuntimeName_t runtimeName{into<lossy<RuntimeName_t>>(cursor.next())};
 
             processMessage(message, cmd, runtimeName);
         }
@@ -270,21 +350,70 @@ void RouDi::processRuntimeMessages() noexcept
 version::VersionInfo RouDi::parseRegisterMessage(const runtime::IpcMessage& message,
                                                  uint32_t& pid,
                                                  uid_t& userId,
-                                                 int64_t& transmissionTimestamp) noexcept
+                                                 int64_t& transmissionTimestamp,
+                                                 uint64_t& pidNamespaceId) noexcept
 {
-    convert::from_string<uint32_t>(message.getElementAtIndex(2).c_str()).and_then([&pid](const auto value) {
-        pid = value;
+    // the message type and the runtime name were already read
+    runtime::IpcMessage::Cursor cursor(message, 2U);
+    convert::from_string<uint32_t>(cursor.next().c_str()).and_then([&pid](const auto value) { pid = value; });
+    convert::from_string<uint32_t>(cursor.next().c_str()).and_then([&userId](const auto value) { userId = value; });
+    convert::from_string<int64_t>(cursor.next().c_str()).and_then([&transmissionTimestamp](const auto value) {
+        transmissionTimestamp = value;
     });
-    convert::from_string<uint32_t>(message.getElementAtIndex(3).c_str()).and_then([&userId](const auto value) {
-        userId = value;
+    Serialization serializationVersionInfo(cursor.next());
+    // the PID namespace is optional; without it, the pid is not trusted for the pidfd exit detection
+    convert::from_string<uint64_t>(cursor.next().c_str()).and_then([&pidNamespaceId](const auto value) {
+        pidNamespaceId = value;
     });
-    convert::from_string<int64_t>(message.getElementAtIndex(4).c_str())
-        .and_then([&transmissionTimestamp](const auto value) { transmissionTimestamp = value; });
 
-    Serialization serializationVersionInfo(message.getElementAtIndex(5));
     return serializationVersionInfo;
 }
 
+bool RouDi::addPortToBatch(runtime::IpcMessage::Cursor& cursor, runtime::PortBatch& batch) noexcept
+{
+    // the entries are read in the order in which they were serialized by the runtime
+    const auto portType = runtime::stringToIpcMessageType(cursor.next().c_str());
+    const auto serializedService = cursor.next();
+    const Serialization options(cursor.next());
+    const runtime::PortConfigInfo portConfigInfo{Serialization(cursor.next())};
+
+    auto service = capro::ServiceDescription::deserialize(Serialization(serializedService));
+    if (service.has_error())
+    {
+        IOX_LOG(ERROR, "Deserialization failed when '" << serializedService.c_str() << "' was provided");
+        return false;
+    }
+
+    switch (portType)
+    {
+    case runtime::IpcMessageType::CREATE_PUBLISHER:
+        return popo::PublisherOptions::deserialize(options)
+            .and_then([&](auto& publisherOptions) {
+                batch.addPublisher(service.value(), publisherOptions, portConfigInfo);
+            })
+            .or_else([&](auto&) {
+                IOX_LOG(ERROR,
+                        "Deserialization of 'PublisherOptions' failed when '" << options.toString().c_str()
+                                                                              << "' was provided");
+            })
+            .has_value();
+    case runtime::IpcMessageType::CREATE_SUBSCRIBER:
+        return popo::SubscriberOptions::deserialize(options)
+            .and_then([&](auto& subscriberOptions) {
+                batch.addSubscriber(service.value(), subscriberOptions, portConfigInfo);
+            })
+            .or_else([&](auto&) {
+                IOX_LOG(ERROR,
+                        "Deserialization of 'SubscriberOptions' failed when '" << options.toString().c_str()
+                                                                               << "' was provided");
+            })
+            .has_value();
+    default:
+        IOX_LOG(ERROR, "Only publishers and subscribers can be requested with a batch");
+        return false;
+    }
+}
+
 void RouDi::processMessage(const runtime::IpcMessage& message,
                            const iox::runtime::IpcMessageType& cmd,
                            const RuntimeName_t& runtimeName) noexcept
@@ -293,7 +422,7 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
     {
     case runtime::IpcMessageType::REG:
     {
-        if (message.getNumberOfElements() != 6)
+        if (message.getNumberOfElements() != 6 && message.getNumberOfElements() != 7)
         {
             IOX_LOG(ERROR,
                     "Wrong number of parameters for \"IpcMessageType::REG\" from \"" << runtimeName << "\"received!");
@@ -303,14 +432,17 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
             uint32_t pid{0U};
             uid_t userId{0};
             int64_t transmissionTimestamp{0};
-            version::VersionInfo versionInfo = parseRegisterMessage(message, pid, userId, transmissionTimestamp);
+            uint64_t pidNamespaceId{0U};
+            version::VersionInfo versionInfo =
+                parseRegisterMessage(message, pid, userId, transmissionTimestamp, pidNamespaceId);
 
             registerProcess(runtimeName,
                             pid,
                             PosixUser{userId},
                             transmissionTimestamp,
                             getUniqueSessionIdForProcess(),
-                            versionInfo);
+                            versionInfo,
+                            pidNamespaceId);
         }
         break;
     }
@@ -391,6 +523,38 @@ void RouDi::processMessage(const runtime::IpcMessage& message,
         }
         break;
     }
+    case runtime::IpcMessageType::CREATE_PORTS:
+    {
+        // each port is described by its message type, the service description, the options and the port config info
+        constexpr uint32_t HEADER_ELEMENTS{2U};
+        constexpr uint32_t ELEMENTS_PER_PORT{4U};
+        const auto numberOfPortElements = message.getNumberOfElements() - HEADER_ELEMENTS;
+        if (message.getNumberOfElements() <= HEADER_ELEMENTS || numberOfPortElements % ELEMENTS_PER_PORT != 0U
+            || numberOfPortElements / ELEMENTS_PER_PORT > runtime::PortBatch::CAPACITY)
+        {
+            IOX_LOG(ERROR,
+                    "Wrong number of parameters for \"IpcMessageType::CREATE_PORTS\" from \"" << runtimeName
+                                                                                              << "\"received!");
+            break;
+        }
+
+        runtime::PortBatch batch;
+        bool isBatchValid{true};
+        runtime::IpcMessage::Cursor cursor(message, HEADER_ELEMENTS);
+        while (isBatchValid && cursor.getNumberOfRemainingElements() > 0U)
+        {
+            isBatchValid = addPortToBatch(cursor, batch);
+        }
+
+        if (!isBatchValid)
+        {
+            IOX_LOG(ERROR, "Deserialization of \"IpcMessageType::CREATE_PORTS\" from \"" << runtimeName << "\" failed");
+            break;
+        }
+
+        m_prcMgr->addPortsForProcess(runtimeName, batch);
+        break;
+    }
     case runtime::IpcMessageType::CREATE_CLIENT:
     {
         if (message.getNumberOfElements() != 5)
@@ -558,16 +722,26 @@ void RouDi::registerProcess(const RuntimeName_t& name,
                             const PosixUser user,
                             const int64_t transmissionTimestamp,
                             const uint64_t sessionId,
-                            const version::VersionInfo& versionInfo) noexcept
+                            const version::VersionInfo& versionInfo,
+                            const uint64_t pidNamespaceId) noexcept
 {
     bool monitorProcess = (m_monitoringMode == roudi::MonitoringMode::ON);
-    IOX_DISCARD_RESULT(
-        m_prcMgr->registerProcess(name, pid, user, monitorProcess, transmissionTimestamp, sessionId, versionInfo));
+    // the IPC channel to the process is opened before the ProcessManager is locked, therefore concurrently
+    // registering processes do not wait for each other's channel to be opened
+    runtime::IpcInterfaceUser ipcChannel{name};
+    IOX_DISCARD_RESULT(m_prcMgr->registerProcess(std::move(ipcChannel),
+                                                 pid,
+                                                 user,
+                                                 monitorProcess,
+                                                 transmissionTimestamp,
+                                                 sessionId,
+                                                 versionInfo,
+                                                 pidNamespaceId));
 }
 
 uint64_t RouDi::getUniqueSessionIdForProcess() noexcept
 {
-    static uint64_t sessionId = 0;
+    static std::atomic<uint64_t> sessionId{0U};
     return ++sessionId;
 }
 
@@ -33,6 +33,7 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
     constexpr option LONG_OPTIONS[] = {{"help", no_argument, nullptr, 'h'},
                                        {"version", no_argument, nullptr, 'v'},
                                        {"monitoring-mode", required_argument, nullptr, 'm'},
+                                       {"exit-detection", required_argument, nullptr, 'e'},
                                        {"log-level", required_argument, nullptr, 'l'},
                                        {"unique-roudi-id", required_argument, nullptr, 'u'},
                                        {"compatibility", required_argument, nullptr, 'x'},
@@ -41,7 +42,7 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
                                        {nullptr, 0, nullptr, 0}};
 
     // colon after shortOption means it requires an argument, two colons mean optional argument
-    constexpr const char* SHORT_OPTIONS = "hvm:l:u:x:t:k:";
+    constexpr const char* SHORT_OPTIONS = "hvm:e:l:u:x:t:k:";
     int index;
     int32_t opt{-1};
     while ((opt = getopt_long(argc, argv, SHORT_OPTIONS, LONG_OPTIONS, &index), opt != -1))
@@ -59,6 +60,13 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             std::cout << "                                  default = 'off'" << std::endl;
             std::cout << "                                  on: enables monitoring for all processes" << std::endl;
             std::cout << "                                  off: disables monitoring for all processes" << std::endl;
+            std::cout << "-e, --exit-detection <MODE>       Set how the exit of a monitored process is" << std::endl;
+            std::cout << "                                  detected." << std::endl;
+            std::cout << "                                  <MODE> {heartbeat, pidfd}" << std::endl;
+            std::cout << "                                  default = 'heartbeat'" << std::endl;
+            std::cout << "                                  heartbeat: heartbeat timeout only" << std::endl;
+            std::cout << "                                  pidfd: additionally watch processes with a" << std::endl;
+            std::cout << "                                  Linux pidfd; requires the same PID namespace" << std::endl;
             std::cout << "-l, --log-level <LEVEL>           Set log level." << std::endl;
             std::cout << "                                  <LEVEL> {off, fatal, error, warning, info," << std::endl;
             std::cout << "                                  debug, trace}" << std::endl;
@@ -124,6 +132,23 @@ CmdLineParser::parse(int argc, char* argv[], const CmdLineArgumentParsingMode cm
             }
             break;
         }
+        case 'e':
+        {
+            if (strcmp(optarg, "heartbeat") == 0)
+            {
+                m_cmdLineArgs.processExitDetection = roudi::ProcessExitDetection::HEARTBEAT;
+            }
+            else if (strcmp(optarg, "pidfd") == 0)
+            {
+                m_cmdLineArgs.processExitDetection = roudi::ProcessExitDetection::PIDFD;
+            }
+            else
+            {
+                m_cmdLineArgs.run = false;
+                IOX_LOG(ERROR, "Options for exit-detection are 'heartbeat' and 'pidfd'!");
+            }
+            break;
+        }
         case 'l':
         {
             if (strcmp(optarg, "off") == 0)
@@ -19,9 +19,11 @@
 #include "iceoryx_posh/roudi/roudi_config_toml_file_provider.hpp"
 #include "iceoryx_platform/getopt.hpp"
 #include "iox/file_reader.hpp"
+#include "iox/filesystem.hpp"
 #include "iox/into.hpp"
 #include "iox/logging.hpp"
 #include "iox/posix_group.hpp"
+#include "iox/posix_shared_memory_object.hpp"
 #include "iox/std_string_support.hpp"
 #include "iox/string.hpp"
 #include "iox/vector.hpp"
@@ -35,6 +37,10 @@ namespace iox
 {
 namespace config
 {
+// the segments are created with the zeroing thread count of the config file
+static_assert(SHM_SEGMENT_MAX_ZEROING_THREAD_COUNT <= MAX_SHM_SEGMENT_ZEROING_THREAD_COUNT,
+              "A valid zeroing thread count of a segment must not be reduced by the shared memory object");
+
 TomlRouDiConfigFileProvider::TomlRouDiConfigFileProvider(config::CmdLineArgs_t& cmdLineArgs) noexcept
 {
     /// don't print additional output if not running
@@ -126,11 +132,95 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
 
     auto groupOfCurrentProcess = PosixGroup::getGroupOfCurrentProcess().getName();
     iox::RouDiConfig_t parsedConfig;
+    auto managementSegment = parsedFile->get_table("management-segment");
+    if (managementSegment)
+    {
+        parsedConfig.lockManagementSegmentInMemory = managementSegment->get_as<bool>("lock-in-memory").value_or(false);
+    }
+
     for (auto segment : *segments)
     {
         auto writer = segment->get_as<std::string>("writer").value_or(into<std::string>(groupOfCurrentProcess));
         auto reader = segment->get_as<std::string>("reader").value_or(into<std::string>(groupOfCurrentProcess));
         iox::mepoo::MePooConfig mempoolConfig;
+
+        auto allocationPolicy = segment->get_as<std::string>("allocation-policy").value_or("best-fit");
+        if (allocationPolicy == "fall-through")
+        {
+            mempoolConfig.m_allocationPolicy = iox::mepoo::MemPoolAllocationPolicy::FALL_THROUGH_TO_LARGER_MEMPOOL;
+        }
+        else if (allocationPolicy != "best-fit")
+        {
+            return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_MEMPOOL_ALLOCATION_POLICY);
+        }
+
+        auto zeroingThreadCount =
+            segment->get_as<uint32_t>("zeroing-threads").value_or(iox::SHM_SEGMENT_DEFAULT_ZEROING_THREAD_COUNT);
+        if (zeroingThreadCount == 0U || zeroingThreadCount > iox::SHM_SEGMENT_MAX_ZEROING_THREAD_COUNT)
+        {
+            return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_SEGMENT_ZEROING_THREAD_COUNT);
+        }
+
+        auto hugePages = segment->get_as<std::string>("huge-pages").value_or("none");
+        auto hugePageSize = iox::mepoo::HugePageSize::NONE;
+        if (hugePages == "2M")
+        {
+            hugePageSize = iox::mepoo::HugePageSize::SIZE_2MB;
+        }
+        else if (hugePages == "1G")
+        {
+            hugePageSize = iox::mepoo::HugePageSize::SIZE_1GB;
+        }
+        else if (hugePages != "none")
+        {
+            return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_HUGE_PAGE_SIZE);
+        }
+
+        auto hugePageMount = segment->get_as<std::string>("huge-page-mount").value_or("");
+        if (!hugePageMount.empty()
+            && (hugePageMount.size() > iox::mepoo::HugePageMount_t::capacity()
+                || !isValidPathToDirectory(
+                    iox::mepoo::HugePageMount_t(iox::TruncateToCapacity, hugePageMount.c_str(), hugePageMount.size()))))
+        {
+            return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_HUGE_PAGE_MOUNT);
+        }
+
+        auto numaPolicyName = segment->get_as<std::string>("numa-policy").value_or("default");
+        auto numaPolicy = iox::NumaMemoryPolicy::DEFAULT;
+        if (numaPolicyName == "bind")
+        {
+            numaPolicy = iox::NumaMemoryPolicy::BIND;
+        }
+        else if (numaPolicyName == "interleave")
+        {
+            numaPolicy = iox::NumaMemoryPolicy::INTERLEAVE;
+        }
+        else if (numaPolicyName != "default")
+        {
+            return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_POLICY);
+        }
+
+        uint64_t numaNodeMask{0U};
+        if (numaPolicy != iox::NumaMemoryPolicy::DEFAULT)
+        {
+            constexpr int64_t MAX_NUMA_NODES{64};
+            auto numaNodes = segment->get_array_of<int64_t>("numa-nodes");
+            if (!numaNodes || numaNodes->empty())
+            {
+                return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_NODES);
+            }
+            for (const auto numaNode : *numaNodes)
+            {
+                if (numaNode < 0 || numaNode >= MAX_NUMA_NODES)
+                {
+                    return iox::err(iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_NODES);
+                }
+                numaNodeMask |= 1ULL << static_cast<uint64_t>(numaNode);
+            }
+        }
+
+        auto lockInMemory = segment->get_as<bool>("lock-in-memory").value_or(false);
+
         auto mempools = segment->get_table_array("mempool");
         if (!mempools)
         {
@@ -160,6 +250,14 @@ TomlRouDiConfigFileProvider::parse(std::istream& stream) noexcept
             {PosixGroup::groupName_t(iox::TruncateToCapacity, reader.c_str(), reader.size()),
              PosixGroup::groupName_t(iox::TruncateToCapacity, writer.c_str(), writer.size()),
              mempoolConfig});
+        auto& segmentEntry = parsedConfig.m_sharedMemorySegments.back();
+        segmentEntry.m_zeroingThreadCount = zeroingThreadCount;
+        segmentEntry.m_hugePageSize = hugePageSize;
+        segmentEntry.m_hugePageMount =
+            iox::mepoo::HugePageMount_t(iox::TruncateToCapacity, hugePageMount.c_str(), hugePageMount.size());
+        segmentEntry.m_numaPolicy = numaPolicy;
+        segmentEntry.m_numaNodeMask = numaNodeMask;
+        segmentEntry.m_lockInMemory = lockInMemory;
     }
 
     return iox::ok(parsedConfig);
@@ -21,11 +21,269 @@ namespace iox
 {
 namespace roudi
 {
+namespace
+{
+// FNV-1a
+constexpr uint64_t HASH_OFFSET_BASIS{14695981039346656037ULL};
+constexpr uint64_t HASH_PRIME{1099511628211ULL};
+// mixed in after each string to distinguish e.g. ("ab", "c") from ("a", "bc")
+constexpr uint64_t HASH_STRING_SEPARATOR{0xFFU};
+
+uint64_t hashOf(const capro::IdString_t& value, uint64_t hash = HASH_OFFSET_BASIS) noexcept
+{
+    const auto* data = value.c_str();
+    for (uint64_t i = 0U; i < value.size(); ++i)
+    {
+        hash ^= static_cast<uint8_t>(data[i]);
+        hash *= HASH_PRIME;
+    }
+    hash ^= HASH_STRING_SEPARATOR;
+    hash *= HASH_PRIME;
+    return hash;
+}
+
+uint64_t hashOf(const capro::IdString_t& service,
+                const capro::IdString_t& instance,
+                const capro::IdString_t& event) noexcept
+{
+    return hashOf(event, hashOf(instance, hashOf(service)));
+}
+} // namespace
+
+ServiceRegistry::Index::HashIndex::HashIndex() noexcept
+{
+    clear();
+}
+
+void ServiceRegistry::Index::HashIndex::clear() noexcept
+{
+    for (uint32_t i = 0U; i < BUCKET_COUNT; ++i)
+    {
+        m_buckets[i] = NO_INDEX;
+        m_bucketTails[i] = NO_INDEX;
+    }
+    for (uint32_t i = 0U; i < CAPACITY; ++i)
+    {
+        m_next[i] = NO_INDEX;
+        m_previous[i] = NO_INDEX;
+    }
+}
+
+void ServiceRegistry::Index::HashIndex::insert(const uint64_t hash, const uint32_t index) noexcept
+{
+    const auto bucket = hash % BUCKET_COUNT;
+    const auto tail = m_bucketTails[bucket];
+    m_next[index] = NO_INDEX;
+    m_previous[index] = tail;
+    if (tail == NO_INDEX)
+    {
+        m_buckets[bucket] = index;
+    }
+    else
+    {
+        m_next[tail] = index;
+    }
+    m_bucketTails[bucket] = index;
+}
+
+void ServiceRegistry::Index::HashIndex::remove(const uint64_t hash, const uint32_t index) noexcept
+{
+    const auto bucket = hash % BUCKET_COUNT;
+    const auto next = m_next[index];
+    const auto previous = m_previous[index];
+    if (previous == NO_INDEX)
+    {
+        m_buckets[bucket] = next;
+    }
+    else
+    {
+        m_next[previous] = next;
+    }
+    if (next == NO_INDEX)
+    {
+        m_bucketTails[bucket] = previous;
+    }
+    else
+    {
+        m_previous[next] = previous;
+    }
+    m_next[index] = NO_INDEX;
+    m_previous[index] = NO_INDEX;
+}
+
+uint32_t ServiceRegistry::Index::HashIndex::first(const uint64_t hash) const noexcept
+{
+    return m_buckets[hash % BUCKET_COUNT];
+}
+
+uint32_t ServiceRegistry::Index::HashIndex::next(const uint32_t index) const noexcept
+{
+    return m_next[index];
+}
+
 ServiceRegistry::ServiceDescriptionEntry::ServiceDescriptionEntry(const capro::ServiceDescription& serviceDescription)
     : serviceDescription(serviceDescription)
 {
 }
 
+void ServiceRegistry::Entries::forEach(function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
+{
+    for (auto& entry : m_slots)
+    {
+        if (entry)
+        {
+            callable(*entry);
+        }
+    }
+}
+
+void ServiceRegistry::Index::build(const Entries& entries) noexcept
+{
+    m_serviceDescriptionIndex.clear();
+    m_serviceIndex.clear();
+    m_instanceIndex.clear();
+    m_eventIndex.clear();
+
+    for (uint32_t index = 0U; index < entries.m_slots.size(); ++index)
+    {
+        if (entries.m_slots[index])
+        {
+            link(entries, index);
+        }
+    }
+}
+
+void ServiceRegistry::Index::find(const Entries& entries,
+                                  const optional<capro::IdString_t>& service,
+                                  const optional<capro::IdString_t>& instance,
+                                  const optional<capro::IdString_t>& event,
+                                  function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
+{
+    if (service && instance && event)
+    {
+        auto index = findIndex(entries, *service, *instance, *event);
+        if (index != NO_INDEX)
+        {
+            callable(*entries.m_slots[index]);
+        }
+        return;
+    }
+
+    auto matches = [&](const ServiceDescriptionEntry& entry) {
+        bool match = (service) ? (entry.serviceDescription.getServiceIDString() == *service) : true;
+        match &= (instance) ? (entry.serviceDescription.getInstanceIDString() == *instance) : true;
+        match &= (event) ? (entry.serviceDescription.getEventIDString() == *event) : true;
+        return match;
+    };
+
+    // with at least one string the candidates are given by the index of this string
+    const HashIndex* hashIndex{nullptr};
+    uint64_t hash{0U};
+    if (service)
+    {
+        hashIndex = &m_serviceIndex;
+        hash = hashOf(*service);
+    }
+    else if (instance)
+    {
+        hashIndex = &m_instanceIndex;
+        hash = hashOf(*instance);
+    }
+    else if (event)
+    {
+        hashIndex = &m_eventIndex;
+        hash = hashOf(*event);
+    }
+
+    if (hashIndex != nullptr)
+    {
+        for (auto index = hashIndex->first(hash); index != NO_INDEX; index = hashIndex->next(index))
+        {
+            const auto& entry = *entries.m_slots[index];
+            if (matches(entry))
+            {
+                callable(entry);
+            }
+        }
+        return;
+    }
+
+    entries.forEach([&](const ServiceDescriptionEntry& entry) {
+        if (matches(entry))
+        {
+            callable(entry);
+        }
+    });
+}
+
+uint32_t ServiceRegistry::Index::findIndex(const Entries& entries,
+                                           const capro::IdString_t& service,
+                                           const capro::IdString_t& instance,
+                                           const capro::IdString_t& event) const noexcept
+{
+    const auto hash = hashOf(service, instance, event);
+    for (auto index = m_serviceDescriptionIndex.first(hash); index != NO_INDEX;
+         index = m_serviceDescriptionIndex.next(index))
+    {
+        const auto& serviceDescription = entries.m_slots[index]->serviceDescription;
+        if (serviceDescription.getServiceIDString() == service && serviceDescription.getInstanceIDString() == instance
+            && serviceDescription.getEventIDString() == event)
+        {
+            return index;
+        }
+    }
+    return NO_INDEX;
+}
+
+void ServiceRegistry::Index::link(const Entries& entries, const uint32_t index) noexcept
+{
+    const auto& serviceDescription = entries.m_slots[index]->serviceDescription;
+    const auto& service = serviceDescription.getServiceIDString();
+    const auto& instance = serviceDescription.getInstanceIDString();
+    const auto& event = serviceDescription.getEventIDString();
+
+    m_serviceDescriptionIndex.insert(hashOf(service, instance, event), index);
+    m_serviceIndex.insert(hashOf(service), index);
+    m_instanceIndex.insert(hashOf(instance), index);
+    m_eventIndex.insert(hashOf(event), index);
+}
+
+void ServiceRegistry::Index::unlink(const Entries& entries, const uint32_t index) noexcept
+{
+    const auto& serviceDescription = entries.m_slots[index]->serviceDescription;
+    const auto& service = serviceDescription.getServiceIDString();
+    const auto& instance = serviceDescription.getInstanceIDString();
+    const auto& event = serviceDescription.getEventIDString();
+
+    m_serviceDescriptionIndex.remove(hashOf(service, instance, event), index);
+    m_serviceIndex.remove(hashOf(service), index);
+    m_instanceIndex.remove(hashOf(instance), index);
+    m_eventIndex.remove(hashOf(event), index);
+}
+
+ServiceRegistry::ServiceRegistry(const Entries& entries) noexcept
+    : m_entries(entries)
+{
+    m_index.build(m_entries);
+}
+
+void ServiceRegistry::assign(const Entries& entries) noexcept
+{
+    m_entries = entries;
+    m_index.build(m_entries);
+    m_freeIndex = NO_INDEX;
+}
+
+const ServiceRegistry::Entries& ServiceRegistry::entries() const noexcept
+{
+    return m_entries;
+}
+
+const ServiceRegistry::Index& ServiceRegistry::index() const noexcept
+{
+    return m_index;
+}
+
 expected<void, ServiceRegistry::Error> ServiceRegistry::add(const capro::ServiceDescription& serviceDescription,
                                                             ReferenceCounter_t ServiceDescriptionEntry::*count)
 {
@@ -35,51 +293,89 @@ expected<void, ServiceRegistry::Error> ServiceRegistry::add(const capro::Service
         // multiple entries with the same service descripion are possible
         // and we just increase the count in this case (multi-set semantics)
         // entry exists, increment counter
-        auto& entry = m_serviceDescriptions[index];
+        auto& entry = m_entries.m_slots[index];
         ((*entry).*count)++;
-        m_dataChanged = true;
         return ok();
     }
 
     // entry does not exist, find a free slot if it exists
+    auto maybeIndex = insert(serviceDescription);
+    if (maybeIndex.has_error())
+    {
+        return err(maybeIndex.error());
+    }
+
+    auto& entry = m_entries.m_slots[maybeIndex.value()];
+    (*entry).*count = 1U;
+    return ok();
+}
 
+expected<uint32_t, ServiceRegistry::Error>
+ServiceRegistry::insert(const capro::ServiceDescription& serviceDescription) noexcept
+{
     // fast path to a free slot (which was occupied by previously removed entry),
     // prefer to fill entries close to the front
     if (m_freeIndex != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[m_freeIndex];
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        m_dataChanged = true;
+        const auto index = m_freeIndex;
+        m_entries.m_slots[index].emplace(serviceDescription);
+        m_index.link(m_entries, index);
         m_freeIndex = NO_INDEX;
-        return ok();
+        return ok(index);
     }
 
     // search from start
-    for (auto& entry : m_serviceDescriptions)
+    for (uint32_t index = 0U; index < m_entries.m_slots.size(); ++index)
     {
+        auto& entry = m_entries.m_slots[index];
         if (!entry)
         {
             entry.emplace(serviceDescription);
-            (*entry).*count = 1U;
-            m_dataChanged = true;
-            return ok();
+            m_index.link(m_entries, index);
+            return ok(index);
         }
     }
 
     // append new entry at the end (the size only grows up to capacity)
-    if (m_serviceDescriptions.emplace_back())
+    if (m_entries.m_slots.emplace_back())
     {
-        auto& entry = m_serviceDescriptions.back();
-        entry.emplace(serviceDescription);
-        (*entry).*count = 1U;
-        m_dataChanged = true;
-        return ok();
+        const auto index = static_cast<uint32_t>(m_entries.m_slots.size() - 1U);
+        m_entries.m_slots[index].emplace(serviceDescription);
+        m_index.link(m_entries, index);
+        return ok(index);
     }
 
     return err(Error::SERVICE_REGISTRY_FULL);
 }
 
+expected<void, ServiceRegistry::Error> ServiceRegistry::applyChange(const ServiceDescriptionEntry& change) noexcept
+{
+    auto index = findIndex(change.serviceDescription);
+    if (change.publisherCount == 0U && change.serverCount == 0U)
+    {
+        if (index != NO_INDEX)
+        {
+            erase(index);
+        }
+        return ok();
+    }
+
+    if (index == NO_INDEX)
+    {
+        auto maybeIndex = insert(change.serviceDescription);
+        if (maybeIndex.has_error())
+        {
+            return err(maybeIndex.error());
+        }
+        index = maybeIndex.value();
+    }
+
+    auto& entry = m_entries.m_slots[index];
+    entry->publisherCount = change.publisherCount;
+    entry->serverCount = change.serverCount;
+    return ok();
+}
+
 expected<void, ServiceRegistry::Error>
 ServiceRegistry::addPublisher(const capro::ServiceDescription& serviceDescription) noexcept
 {
@@ -97,16 +393,13 @@ void ServiceRegistry::removePublisher(const capro::ServiceDescription& serviceDe
     auto index = findIndex(serviceDescription);
     if (index != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[index];
+        auto& entry = m_entries.m_slots[index];
 
         if (entry && entry->publisherCount >= 1U)
         {
             if (--entry->publisherCount == 0U && entry->serverCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
-                m_dataChanged = true;
+                erase(index);
             }
         }
     }
@@ -117,16 +410,13 @@ void ServiceRegistry::removeServer(const capro::ServiceDescription& serviceDescr
     auto index = findIndex(serviceDescription);
     if (index != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[index];
+        auto& entry = m_entries.m_slots[index];
 
         if (entry && entry->serverCount >= 1U)
         {
             if (--entry->serverCount == 0U && entry->publisherCount == 0)
             {
-                entry.reset();
-                // reuse the slot in the next insertion
-                m_freeIndex = index;
-                m_dataChanged = true;
+                erase(index);
             }
         }
     }
@@ -137,11 +427,7 @@ void ServiceRegistry::purge(const capro::ServiceDescription& serviceDescription)
     auto index = findIndex(serviceDescription);
     if (index != NO_INDEX)
     {
-        auto& entry = m_serviceDescriptions[index];
-        entry.reset();
-        // reuse the slot in the next insertion
-        m_freeIndex = index;
-        m_dataChanged = true;
+        erase(index);
     }
 }
 
@@ -150,51 +436,28 @@ void ServiceRegistry::find(const optional<capro::IdString_t>& service,
                            const optional<capro::IdString_t>& event,
                            function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
 {
-    for (auto& entry : m_serviceDescriptions)
-    {
-        if (entry)
-        {
-            bool match = (service) ? (entry->serviceDescription.getServiceIDString() == *service) : true;
-            match &= (instance) ? (entry->serviceDescription.getInstanceIDString() == *instance) : true;
-            match &= (event) ? (entry->serviceDescription.getEventIDString() == *event) : true;
-
-            if (match)
-            {
-                callable(*entry);
-            }
-        }
-    }
+    m_index.find(m_entries, service, instance, event, callable);
 }
 
 uint32_t ServiceRegistry::findIndex(const capro::ServiceDescription& serviceDescription) const noexcept
 {
-    for (uint32_t i = 0; i < m_serviceDescriptions.size(); ++i)
-    {
-        auto& entry = m_serviceDescriptions[i];
-        if (entry && entry->serviceDescription == serviceDescription)
-        {
-            return i;
-        }
-    }
-    return NO_INDEX;
+    return m_index.findIndex(m_entries,
+                             serviceDescription.getServiceIDString(),
+                             serviceDescription.getInstanceIDString(),
+                             serviceDescription.getEventIDString());
 }
 
-void ServiceRegistry::forEach(function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
+void ServiceRegistry::erase(const uint32_t index) noexcept
 {
-    for (auto& entry : m_serviceDescriptions)
-    {
-        if (entry)
-        {
-            callable(*entry);
-        }
-    }
+    m_index.unlink(m_entries, index);
+    m_entries.m_slots[index].reset();
+    // reuse the slot in the next insertion
+    m_freeIndex = index;
 }
 
-bool ServiceRegistry::hasDataChangedSinceLastCall() noexcept
+void ServiceRegistry::forEach(function_ref<void(const ServiceDescriptionEntry&)> callable) const noexcept
 {
-    auto dataChanged = m_dataChanged;
-    m_dataChanged = false;
-    return dataChanged;
+    m_entries.forEach(callable);
 }
 
 } // namespace roudi
@@ -109,7 +109,7 @@ bool IpcInterface<IpcChannelType>::receive(IpcMessage& answer) const noexcept
         return false;
     }
 
-    return IpcInterface<IpcChannelType>::setMessageFromString(message.value().c_str(), answer);
+    return IpcInterface<IpcChannelType>::setMessageFromString(std::move(message.value()), answer);
 }
 
 template <typename IpcChannelType>
@@ -123,7 +123,7 @@ bool IpcInterface<IpcChannelType>::timedReceive(const units::Duration timeout, I
 
     return !m_ipcChannel->timedReceive(timeout)
                 .and_then([&answer](auto& message) {
-                    IpcInterface<IpcChannelType>::setMessageFromString(message.c_str(), answer);
+                    IpcInterface<IpcChannelType>::setMessageFromString(std::move(message), answer);
                 })
                 .has_error()
            && answer.isValid();
@@ -141,6 +141,18 @@ bool IpcInterface<IpcChannelType>::setMessageFromString(const char* buffer, IpcM
     return true;
 }
 
+template <typename IpcChannelType>
+bool IpcInterface<IpcChannelType>::setMessageFromString(std::string&& buffer, IpcMessage& answer) noexcept
+{
+    answer.setMessage(std::move(buffer));
+    if (!answer.isValid())
+    {
+        IOX_LOG(ERROR, "The received message " << answer.getMessage() << " is not valid");
+        return false;
+    }
+    return true;
+}
+
 template <typename IpcChannelType>
 bool IpcInterface<IpcChannelType>::send(const IpcMessage& msg) const noexcept
 {
@@ -18,6 +18,7 @@
 #include "iceoryx_posh/internal/runtime/ipc_message.hpp"
 
 #include <algorithm>
+#include <cstring>
 
 namespace iox
 {
@@ -45,22 +46,42 @@ uint32_t IpcMessage::getNumberOfElements() const noexcept
 
 std::string IpcMessage::getElementAtIndex(const uint32_t index) const noexcept
 {
-    std::string messageRemainder(m_msg);
-    size_t startPos = 0u;
-    size_t endPos = messageRemainder.find_first_of(m_separator, startPos);
+    return Cursor(*this, index).next();
+}
 
-    for (uint32_t counter = 0u; endPos != std::string::npos; ++counter)
+IpcMessage::Cursor::Cursor(const IpcMessage& message, const uint32_t index) noexcept
+    : m_message(message)
+{
+    skip(index);
+}
+
+std::string IpcMessage::Cursor::next() noexcept
+{
+    if (m_index >= m_message.m_numberOfElements)
     {
-        if (counter == index)
-        {
-            return messageRemainder.substr(startPos, endPos - startPos);
-        }
+        return std::string();
+    }
+
+    // every entry is terminated by a separator, therefore the search cannot fail; only the entry is copied
+    const uint64_t endPos = m_message.m_msg.find(m_separator, m_offset);
+    auto entry = m_message.m_msg.substr(m_offset, endPos - m_offset);
+    m_offset = endPos + 1U;
+    ++m_index;
+    return entry;
+}
 
-        startPos = endPos + 1u;
-        endPos = messageRemainder.find_first_of(m_separator, startPos);
+void IpcMessage::Cursor::skip(const uint32_t numberOfEntries) noexcept
+{
+    for (uint32_t i = 0U; i < numberOfEntries && m_index < m_message.m_numberOfElements; ++i)
+    {
+        m_offset = m_message.m_msg.find(m_separator, m_offset) + 1U;
+        ++m_index;
     }
+}
 
-    return std::string();
+uint32_t IpcMessage::Cursor::getNumberOfRemainingElements() const noexcept
+{
+    return m_message.m_numberOfElements - m_index;
 }
 
 bool IpcMessage::isValidEntry(const std::string& entry) const noexcept
@@ -82,26 +103,73 @@ std::string IpcMessage::getMessage() const noexcept
     return m_msg;
 }
 
+uint64_t IpcMessage::getMessageSize() const noexcept
+{
+    return m_msg.size();
+}
+
 void IpcMessage::setMessage(const std::string& msg) noexcept
 {
     clearMessage();
 
     m_msg = msg;
+    tokenize();
+}
+
+void IpcMessage::setMessage(std::string&& msg) noexcept
+{
+    clearMessage();
+
+    m_msg = std::move(msg);
+    tokenize();
+}
+
+void IpcMessage::tokenize() noexcept
+{
     if (!m_msg.empty() && m_msg.back() != m_separator)
     {
         m_isValid = false;
     }
     else
     {
-        m_numberOfElements =
-            static_cast<uint32_t>(std::count_if(m_msg.begin(), m_msg.end(), [&](char c) { return c == m_separator; }));
+        m_numberOfElements = static_cast<uint32_t>(std::count(m_msg.begin(), m_msg.end(), m_separator));
+    }
+}
+
+void IpcMessage::addEntry(const char* entry, const uint64_t size) noexcept
+{
+    if (std::memchr(entry, m_separator, size) != nullptr)
+    {
+        // the entry is not necessarily null-terminated
+        IOX_LOG(ERROR, "\'" << std::string(entry, size) << "\' is an invalid IPC channel entry");
+        m_isValid = false;
     }
+    else
+    {
+        ++m_numberOfElements;
+        m_msg.reserve(m_msg.size() + size + 1U);
+        m_msg.append(entry, size);
+        m_msg.push_back(m_separator);
+    }
+}
+
+void IpcMessage::addEntries(const IpcMessage& msg) noexcept
+{
+    if (!msg.isValid())
+    {
+        IOX_LOG(ERROR, "\'" << msg.getMessage() << "\' contains invalid IPC channel entries");
+        m_isValid = false;
+        return;
+    }
+
+    m_numberOfElements += msg.m_numberOfElements;
+    m_msg.append(msg.m_msg);
 }
 
 void IpcMessage::clearMessage() noexcept
 {
     m_msg.clear();
-    m_numberOfElements = 0u;
+    m_numberOfElements = 0U;
     m_isValid = true;
 }
 
@@ -16,6 +16,7 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_posh/internal/runtime/ipc_runtime_interface.hpp"
+#include "iceoryx_platform/wait.hpp"
 #include "iceoryx_posh/error_handling/error_handling.hpp"
 #include "iceoryx_posh/version/version_info.hpp"
 #include "iox/detail/convert.hpp"
@@ -93,7 +94,8 @@ IpcRuntimeInterface::IpcRuntimeInterface(const RuntimeName_t& roudiName,
             sendBuffer << IpcMessageTypeToString(IpcMessageType::REG) << m_runtimeName << convert::toString(pid)
                        << convert::toString(PosixUser::getUserOfCurrentProcess().getID())
                        << convert::toString(transmissionTimestamp)
-                       << static_cast<Serialization>(version::VersionInfo::getCurrentVersion()).toString();
+                       << static_cast<Serialization>(version::VersionInfo::getCurrentVersion()).toString()
+                       << convert::toString(static_cast<uint64_t>(iox_pid_namespace_id()));
 
             bool successfullySent = m_RoudiIpcInterface.timedSend(sendBuffer, 100_ms);
 
@@ -224,11 +226,12 @@ IpcRuntimeInterface::RegAckResult IpcRuntimeInterface::waitForRegAck(int64_t tra
         // wait for IpcMessageType::REG_ACK from RouDi for 1 seconds
         if (m_AppIpcInterface->timedReceive(1_s, receiveBuffer))
         {
-            std::string cmd = receiveBuffer.getElementAtIndex(0U);
+            IpcMessage::Cursor cursor(receiveBuffer);
+            std::string cmd = cursor.next();
 
             if (stringToIpcMessageType(cmd.c_str()) == IpcMessageType::REG_ACK)
             {
-                constexpr uint32_t REGISTER_ACK_PARAMETERS = 6U;
+                constexpr uint32_t REGISTER_ACK_PARAMETERS = 7U;
                 if (receiveBuffer.getNumberOfElements() != REGISTER_ACK_PARAMETERS)
                 {
                     errorHandler(PoshError::IPC_INTERFACE__REG_ACK_INVALIG_NUMBER_OF_PARAMS);
@@ -239,21 +242,18 @@ IpcRuntimeInterface::RegAckResult IpcRuntimeInterface::waitForRegAck(int64_t tra
                 UntypedRelativePointer::offset_t heartbeatOffset{UntypedRelativePointer::NULL_POINTER_OFFSET};
                 int64_t receivedTimestamp{0U};
 
-                auto topic_size_result =
-                    iox::convert::from_string<uint64_t>(receiveBuffer.getElementAtIndex(1U).c_str());
-                auto segment_manager_offset_result =
-                    iox::convert::from_string<uintptr_t>(receiveBuffer.getElementAtIndex(2U).c_str());
-                auto recv_timestamp_result =
-                    iox::convert::from_string<int64_t>(receiveBuffer.getElementAtIndex(3U).c_str());
-                auto segment_id_result =
-                    iox::convert::from_string<uint64_t>(receiveBuffer.getElementAtIndex(4U).c_str());
-                auto heartbeat_offset_result =
-                    iox::convert::from_string<uintptr_t>(receiveBuffer.getElementAtIndex(5U).c_str());
+                // the entries are read in the order of the message
+                auto topic_size_result = iox::convert::from_string<uint64_t>(cursor.next().c_str());
+                auto segment_manager_offset_result = iox::convert::from_string<uintptr_t>(cursor.next().c_str());
+                auto recv_timestamp_result = iox::convert::from_string<int64_t>(cursor.next().c_str());
+                auto segment_id_result = iox::convert::from_string<uint64_t>(cursor.next().c_str());
+                auto heartbeat_offset_result = iox::convert::from_string<uintptr_t>(cursor.next().c_str());
+                auto lock_in_memory_result = iox::convert::from_string<bool>(cursor.next().c_str());
 
                 // validate conversion results
                 if (!topic_size_result.has_value() || !segment_manager_offset_result.has_value()
                     || !recv_timestamp_result.has_value() || !segment_id_result.has_value()
-                    || !heartbeat_offset_result.has_value())
+                    || !heartbeat_offset_result.has_value() || !lock_in_memory_result.has_value())
                 {
                     return RegAckResult::MALFORMED_RESPONSE;
                 }
@@ -264,6 +264,7 @@ IpcRuntimeInterface::RegAckResult IpcRuntimeInterface::waitForRegAck(int64_t tra
                 segmentManagerOffset = segment_manager_offset_result.value();
                 receivedTimestamp = recv_timestamp_result.value();
                 heartbeatOffset = heartbeat_offset_result.value();
+                m_lockShmInMemory = lock_in_memory_result.value();
 
                 m_segmentManagerAddressOffset.emplace(segmentManagerOffset);
 
@@ -291,6 +292,11 @@ IpcRuntimeInterface::RegAckResult IpcRuntimeInterface::waitForRegAck(int64_t tra
     return RegAckResult::TIMEOUT;
 }
 
+bool IpcRuntimeInterface::isShmLockedInMemory() const noexcept
+{
+    return m_lockShmInMemory;
+}
+
 uint64_t IpcRuntimeInterface::getSegmentId() const noexcept
 {
     return m_segmentId;
@@ -0,0 +1,82 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/runtime/port_batch.hpp"
+
+namespace iox
+{
+namespace runtime
+{
+optional<uint64_t> PortBatch::addPublisher(const capro::ServiceDescription& service,
+                                           const popo::PublisherOptions& publisherOptions,
+                                           const PortConfigInfo& portConfigInfo) noexcept
+{
+    Entry entry;
+    entry.kind = PortKind::PUBLISHER;
+    entry.service = service;
+    entry.publisherOptions = publisherOptions;
+    entry.portConfigInfo = portConfigInfo;
+    return add(std::move(entry));
+}
+
+optional<uint64_t> PortBatch::addSubscriber(const capro::ServiceDescription& service,
+                                            const popo::SubscriberOptions& subscriberOptions,
+                                            const PortConfigInfo& portConfigInfo) noexcept
+{
+    Entry entry;
+    entry.kind = PortKind::SUBSCRIBER;
+    entry.service = service;
+    entry.subscriberOptions = subscriberOptions;
+    entry.portConfigInfo = portConfigInfo;
+    return add(std::move(entry));
+}
+
+optional<uint64_t> PortBatch::add(Entry&& entry) noexcept
+{
+    if (!m_entries.push_back(std::move(entry)))
+    {
+        return nullopt;
+    }
+    return m_entries.size() - 1U;
+}
+
+uint64_t PortBatch::size() const noexcept
+{
+    return m_entries.size();
+}
+
+bool PortBatch::empty() const noexcept
+{
+    return m_entries.empty();
+}
+
+void PortBatch::clear() noexcept
+{
+    m_entries.clear();
+}
+
+PortBatch::Entry& PortBatch::operator[](const uint64_t index) noexcept
+{
+    return m_entries.at(index);
+}
+
+const PortBatch::Entry& PortBatch::operator[](const uint64_t index) const noexcept
+{
+    return m_entries.at(index);
+}
+
+} // namespace runtime
+} // namespace iox
@@ -154,5 +154,23 @@ void PoshRuntime::shutdown() noexcept
     m_shutdownRequested.store(true, std::memory_order_relaxed);
 }
 
+void PoshRuntime::getMiddlewarePorts(PortBatch& batch) noexcept
+{
+    for (uint64_t i = 0U; i < batch.size(); ++i)
+    {
+        auto& entry = batch[i];
+        switch (entry.kind)
+        {
+        case PortBatch::PortKind::PUBLISHER:
+            entry.publisherPort = getMiddlewarePublisher(entry.service, entry.publisherOptions, entry.portConfigInfo);
+            break;
+        case PortBatch::PortKind::SUBSCRIBER:
+            entry.subscriberPort =
+                getMiddlewareSubscriber(entry.service, entry.subscriberOptions, entry.portConfigInfo);
+            break;
+        }
+    }
+}
+
 } // namespace runtime
 } // namespace iox
@@ -31,6 +31,21 @@ namespace iox
 {
 namespace runtime
 {
+namespace
+{
+// the response to a CREATE_PORTS request contains for each port either the ACK type, the offset and the segment id or
+// the ERROR type and the error; this is the size of the former case with both numbers having their maximum length
+constexpr uint64_t MAX_CREATE_PORTS_RESPONSE_SIZE_PER_PORT{3U + 20U + 20U + 3U};
+constexpr uint64_t CREATE_PORTS_RESPONSE_HEADER_SIZE{3U};
+constexpr uint64_t MAX_PORTS_PER_CREATE_PORTS_REQUEST{
+    (APP_MESSAGE_SIZE - platform::IoxIpcChannelType::NULL_TERMINATOR_SIZE - CREATE_PORTS_RESPONSE_HEADER_SIZE)
+    / MAX_CREATE_PORTS_RESPONSE_SIZE_PER_PORT};
+// the request carries the serialized service description and options of every port and is usually the tighter bound,
+// see PortBatch for the resulting number of ports per request
+constexpr uint64_t MAX_CREATE_PORTS_REQUEST_SIZE{ROUDI_MESSAGE_SIZE
+                                                 - platform::IoxIpcChannelType::NULL_TERMINATOR_SIZE};
+} // namespace
+
 PoshRuntimeImpl::PoshRuntimeImpl(optional<const RuntimeName_t*> name, const RuntimeLocation location) noexcept
     : PoshRuntime(name)
     , m_ipcChannelInterface(roudi::IPC_CHANNEL_ROUDI_NAME, *name.value(), runtime::PROCESS_WAITING_FOR_ROUDI_TIMEOUT)
@@ -42,7 +57,8 @@ PoshRuntimeImpl::PoshRuntimeImpl(optional<const RuntimeName_t*> name, const Runt
                    ? nullopt
                    : optional<SharedMemoryUser>({m_ipcChannelInterface.getShmTopicSize(),
                                                  m_ipcChannelInterface.getSegmentId(),
-                                                 m_ipcChannelInterface.getSegmentManagerAddressOffset()});
+                                                 m_ipcChannelInterface.getSegmentManagerAddressOffset(),
+                                                 m_ipcChannelInterface.isShmLockedInMemory()});
     }())
 {
     MutexBuilder()
@@ -95,10 +111,8 @@ PoshRuntimeImpl::~PoshRuntimeImpl() noexcept
     }
 }
 
-PublisherPortUserType::MemberType_t*
-PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service,
-                                        const popo::PublisherOptions& publisherOptions,
-                                        const PortConfigInfo& portConfigInfo) noexcept
+popo::PublisherOptions
+PoshRuntimeImpl::preparePublisherOptions(const popo::PublisherOptions& publisherOptions) const noexcept
 {
     constexpr uint64_t MAX_HISTORY_CAPACITY =
         PublisherPortUserType::MemberType_t::ChunkSenderData_t::ChunkDistributorDataProperties_t::MAX_HISTORY_CAPACITY;
@@ -118,54 +132,66 @@ PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service
         options.nodeName = m_appName;
     }
 
+    return options;
+}
+
+void PoshRuntimeImpl::handlePublisherRequestError(const capro::ServiceDescription& service,
+                                                  const IpcMessageErrorType error) const noexcept
+{
+    switch (error)
+    {
+    case IpcMessageErrorType::NO_UNIQUE_CREATED:
+        IOX_LOG(WARN, "Service '" << service << "' already in use by another process.");
+        errorHandler(PoshError::POSH__RUNTIME_PUBLISHER_PORT_NOT_UNIQUE, iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
+        IOX_LOG(WARN, "Usage of internal service '" << service << "' is forbidden.");
+        errorHandler(PoshError::POSH__RUNTIME_SERVICE_DESCRIPTION_FORBIDDEN, iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::PUBLISHER_LIST_FULL:
+        IOX_LOG(WARN, "Service '" << service << "' could not be created since we are out of memory for publishers.");
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_PUBLISHER_LIST_FULL, iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE:
+        IOX_LOG(WARN, "Service '" << service << "' could not be created. Request publisher got invalid response.");
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_INVALID_RESPONSE, iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE:
+        IOX_LOG(WARN,
+                "Service '" << service << "' could not be created. Request publisher got wrong IPC channel response.");
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE,
+                     iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT:
+        IOX_LOG(WARN,
+                "Service '" << service
+                            << "' could not be created. RouDi did not find a writable shared memory segment for the "
+                               "current user. Try using another user or adapt RouDi's config.");
+        errorHandler(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::ErrorLevel::SEVERE);
+        break;
+    default:
+        IOX_LOG(WARN, "Unknown error occurred while creating service '" << service << "'.");
+        errorHandler(PoshError::POSH__RUNTIME_PUBLISHER_PORT_CREATION_UNKNOWN_ERROR, iox::ErrorLevel::SEVERE);
+        break;
+    }
+}
+
+PublisherPortUserType::MemberType_t*
+PoshRuntimeImpl::getMiddlewarePublisher(const capro::ServiceDescription& service,
+                                        const popo::PublisherOptions& publisherOptions,
+                                        const PortConfigInfo& portConfigInfo) noexcept
+{
+    const auto options = preparePublisherOptions(publisherOptions);
+
     IpcMessage sendBuffer;
     sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PUBLISHER) << m_appName
-               << static_cast<Serialization>(service).toString() << publisherOptions.serialize().toString()
+               << static_cast<Serialization>(service).toString() << options.serialize().toString()
                << static_cast<Serialization>(portConfigInfo).toString();
 
     auto maybePublisher = requestPublisherFromRoudi(sendBuffer);
     if (maybePublisher.has_error())
     {
-        switch (maybePublisher.error())
-        {
-        case IpcMessageErrorType::NO_UNIQUE_CREATED:
-            IOX_LOG(WARN, "Service '" << service << "' already in use by another process.");
-            errorHandler(PoshError::POSH__RUNTIME_PUBLISHER_PORT_NOT_UNIQUE, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::INTERNAL_SERVICE_DESCRIPTION_IS_FORBIDDEN:
-            IOX_LOG(WARN, "Usage of internal service '" << service << "' is forbidden.");
-            errorHandler(PoshError::POSH__RUNTIME_SERVICE_DESCRIPTION_FORBIDDEN, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::PUBLISHER_LIST_FULL:
-            IOX_LOG(WARN,
-                    "Service '" << service << "' could not be created since we are out of memory for publishers.");
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_PUBLISHER_LIST_FULL, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE:
-            IOX_LOG(WARN, "Service '" << service << "' could not be created. Request publisher got invalid response.");
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_INVALID_RESPONSE, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE:
-            IOX_LOG(WARN,
-                    "Service '" << service
-                                << "' could not be created. Request publisher got wrong IPC channel response.");
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE,
-                         iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_PUBLISHER_NO_WRITABLE_SHM_SEGMENT:
-            IOX_LOG(
-                WARN,
-                "Service '"
-                    << service
-                    << "' could not be created. RouDi did not find a writable shared memory segment for the current "
-                       "user. Try using another user or adapt RouDi's config.");
-            errorHandler(PoshError::POSH__RUNTIME_NO_WRITABLE_SHM_SEGMENT, iox::ErrorLevel::SEVERE);
-            break;
-        default:
-            IOX_LOG(WARN, "Unknown error occurred while creating service '" << service << "'.");
-            errorHandler(PoshError::POSH__RUNTIME_PUBLISHER_PORT_CREATION_UNKNOWN_ERROR, iox::ErrorLevel::SEVERE);
-            break;
-        }
+        handlePublisherRequestError(service, maybePublisher.error());
         return nullptr;
     }
     return maybePublisher.value();
@@ -214,10 +240,9 @@ PoshRuntimeImpl::requestPublisherFromRoudi(const IpcMessage& sendBuffer) noexcep
     return err(IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE);
 }
 
-SubscriberPortUserType::MemberType_t*
-PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& service,
-                                         const popo::SubscriberOptions& subscriberOptions,
-                                         const PortConfigInfo& portConfigInfo) noexcept
+popo::SubscriberOptions
+PoshRuntimeImpl::prepareSubscriberOptions(const capro::ServiceDescription& service,
+                                          const popo::SubscriberOptions& subscriberOptions) const noexcept
 {
     constexpr uint64_t MAX_QUEUE_CAPACITY = SubscriberPortUserType::MemberType_t::ChunkQueueData_t::MAX_CAPACITY;
 
@@ -251,38 +276,51 @@ PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& servic
         options.nodeName = m_appName;
     }
 
+    return options;
+}
+
+void PoshRuntimeImpl::handleSubscriberRequestError(const capro::ServiceDescription& service,
+                                                   const IpcMessageErrorType error) const noexcept
+{
+    switch (error)
+    {
+    case IpcMessageErrorType::SUBSCRIBER_LIST_FULL:
+        IOX_LOG(WARN, "Service '" << service << "' could not be created since we are out of memory for subscribers.");
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_SUBSCRIBER_LIST_FULL, iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE:
+        IOX_LOG(WARN, "Service '" << service << "' could not be created. Request subscriber got invalid response.");
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_INVALID_RESPONSE, iox::ErrorLevel::SEVERE);
+        break;
+    case IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE:
+        IOX_LOG(WARN,
+                "Service '" << service << "' could not be created. Request subscriber got wrong IPC channel response.");
+        errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE,
+                     iox::ErrorLevel::SEVERE);
+        break;
+    default:
+        IOX_LOG(WARN, "Unknown error occurred while creating service '" << service << "'.");
+        errorHandler(PoshError::POSH__RUNTIME_SUBSCRIBER_PORT_CREATION_UNKNOWN_ERROR, iox::ErrorLevel::SEVERE);
+        break;
+    }
+}
+
+SubscriberPortUserType::MemberType_t*
+PoshRuntimeImpl::getMiddlewareSubscriber(const capro::ServiceDescription& service,
+                                         const popo::SubscriberOptions& subscriberOptions,
+                                         const PortConfigInfo& portConfigInfo) noexcept
+{
+    const auto options = prepareSubscriberOptions(service, subscriberOptions);
+
     IpcMessage sendBuffer;
     sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_SUBSCRIBER) << m_appName
                << static_cast<Serialization>(service).toString() << options.serialize().toString()
                << static_cast<Serialization>(portConfigInfo).toString();
 
     auto maybeSubscriber = requestSubscriberFromRoudi(sendBuffer);
-
     if (maybeSubscriber.has_error())
     {
-        switch (maybeSubscriber.error())
-        {
-        case IpcMessageErrorType::SUBSCRIBER_LIST_FULL:
-            IOX_LOG(WARN,
-                    "Service '" << service << "' could not be created since we are out of memory for subscribers.");
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_SUBSCRIBER_LIST_FULL, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE:
-            IOX_LOG(WARN, "Service '" << service << "' could not be created. Request subscriber got invalid response.");
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_INVALID_RESPONSE, iox::ErrorLevel::SEVERE);
-            break;
-        case IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE:
-            IOX_LOG(WARN,
-                    "Service '" << service
-                                << "' could not be created. Request subscriber got wrong IPC channel response.");
-            errorHandler(PoshError::POSH__RUNTIME_ROUDI_REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE,
-                         iox::ErrorLevel::SEVERE);
-            break;
-        default:
-            IOX_LOG(WARN, "Unknown error occurred while creating service '" << service << "'.");
-            errorHandler(PoshError::POSH__RUNTIME_SUBSCRIBER_PORT_CREATION_UNKNOWN_ERROR, iox::ErrorLevel::SEVERE);
-            break;
-        }
+        handleSubscriberRequestError(service, maybeSubscriber.error());
         return nullptr;
     }
     return maybeSubscriber.value();
@@ -332,6 +370,176 @@ PoshRuntimeImpl::requestSubscriberFromRoudi(const IpcMessage& sendBuffer) noexce
     return err(IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE);
 }
 
+void PoshRuntimeImpl::getMiddlewarePorts(PortBatch& batch) noexcept
+{
+    IpcMessage sendBuffer;
+    uint64_t begin{0U};
+    for (uint64_t i = 0U; i < batch.size(); ++i)
+    {
+        const auto& entry = batch[i];
+
+        IpcMessage portRequest;
+        switch (entry.kind)
+        {
+        case PortBatch::PortKind::PUBLISHER:
+            portRequest << IpcMessageTypeToString(IpcMessageType::CREATE_PUBLISHER)
+                        << static_cast<Serialization>(entry.service).toString()
+                        << preparePublisherOptions(entry.publisherOptions).serialize().toString()
+                        << static_cast<Serialization>(entry.portConfigInfo).toString();
+            break;
+        case PortBatch::PortKind::SUBSCRIBER:
+            portRequest << IpcMessageTypeToString(IpcMessageType::CREATE_SUBSCRIBER)
+                        << static_cast<Serialization>(entry.service).toString()
+                        << prepareSubscriberOptions(entry.service, entry.subscriberOptions).serialize().toString()
+                        << static_cast<Serialization>(entry.portConfigInfo).toString();
+            break;
+        }
+
+        // the request as well as the response must fit into a single message of the respective IPC channel; the
+        // first port is always added, a single port which exceeds the message size is reported like for the
+        // single port requests
+        const bool isRequestFull = (i - begin) == MAX_PORTS_PER_CREATE_PORTS_REQUEST
+                                   || sendBuffer.getMessageSize() + portRequest.getMessageSize()
+                                          > MAX_CREATE_PORTS_REQUEST_SIZE;
+        if (i != begin && isRequestFull)
+        {
+            requestPortsFromRoudi(sendBuffer, batch, begin, i);
+            begin = i;
+        }
+
+        if (i == begin)
+        {
+            sendBuffer.clearMessage();
+            sendBuffer << IpcMessageTypeToString(IpcMessageType::CREATE_PORTS) << m_appName;
+        }
+        sendBuffer.addEntries(portRequest);
+    }
+
+    if (begin < batch.size())
+    {
+        requestPortsFromRoudi(sendBuffer, batch, begin, batch.size());
+    }
+}
+
+void PoshRuntimeImpl::requestPortsFromRoudi(const IpcMessage& sendBuffer,
+                                            PortBatch& batch,
+                                            const uint64_t begin,
+                                            const uint64_t end) noexcept
+{
+    IpcMessage receiveBuffer;
+    const bool hasResponse = sendRequestToRouDi(sendBuffer, receiveBuffer);
+    const auto responseType = stringToIpcMessageType(receiveBuffer.getElementAtIndex(0U).c_str());
+
+    if (hasResponse && responseType == IpcMessageType::MESSAGE_NOT_SUPPORTED)
+    {
+        // RouDi does not know batch requests; fall back to one request per port
+        IOX_LOG(DEBUG, "RouDi does not support batched port requests, requesting one port after another");
+        for (uint64_t i = begin; i < end; ++i)
+        {
+            auto& entry = batch[i];
+            switch (entry.kind)
+            {
+            case PortBatch::PortKind::PUBLISHER:
+                entry.publisherPort =
+                    getMiddlewarePublisher(entry.service, entry.publisherOptions, entry.portConfigInfo);
+                break;
+            case PortBatch::PortKind::SUBSCRIBER:
+                entry.subscriberPort =
+                    getMiddlewareSubscriber(entry.service, entry.subscriberOptions, entry.portConfigInfo);
+                break;
+            }
+        }
+        return;
+    }
+
+    auto handleRequestError = [this](const PortBatch::Entry& entry, const IpcMessageErrorType error) {
+        if (entry.kind == PortBatch::PortKind::PUBLISHER)
+        {
+            handlePublisherRequestError(entry.service, error);
+        }
+        else
+        {
+            handleSubscriberRequestError(entry.service, error);
+        }
+    };
+
+    if (!hasResponse)
+    {
+        IOX_LOG(ERROR, "Request ports got invalid response!");
+        for (uint64_t i = begin; i < end; ++i)
+        {
+            handleRequestError(batch[i],
+                               batch[i].kind == PortBatch::PortKind::PUBLISHER
+                                   ? IpcMessageErrorType::REQUEST_PUBLISHER_INVALID_RESPONSE
+                                   : IpcMessageErrorType::REQUEST_SUBSCRIBER_INVALID_RESPONSE);
+        }
+        return;
+    }
+
+    if (responseType != IpcMessageType::CREATE_PORTS_ACK)
+    {
+        IOX_LOG(ERROR, "Request ports got wrong response from IPC channel :'" << receiveBuffer.getMessage() << "'");
+        for (uint64_t i = begin; i < end; ++i)
+        {
+            handleRequestError(batch[i],
+                               batch[i].kind == PortBatch::PortKind::PUBLISHER
+                                   ? IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE
+                                   : IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE);
+        }
+        return;
+    }
+
+    // the responses of the ports follow the message type in the order of the request
+    IpcMessage::Cursor cursor(receiveBuffer, 1U);
+    for (uint64_t i = begin; i < end; ++i)
+    {
+        auto& entry = batch[i];
+        convertPortResponse(cursor, entry.kind)
+            .and_then([&](auto port) {
+                if (entry.kind == PortBatch::PortKind::PUBLISHER)
+                {
+                    entry.publisherPort = reinterpret_cast<PublisherPortUserType::MemberType_t*>(port);
+                }
+                else
+                {
+                    entry.subscriberPort = reinterpret_cast<SubscriberPortUserType::MemberType_t*>(port);
+                }
+            })
+            .or_else([&](auto error) { handleRequestError(entry, error); });
+    }
+}
+
+expected<void*, IpcMessageErrorType> PoshRuntimeImpl::convertPortResponse(IpcMessage::Cursor& cursor,
+                                                                           const PortBatch::PortKind kind) noexcept
+{
+    const bool isPublisher = kind == PortBatch::PortKind::PUBLISHER;
+    const auto wrongResponse = isPublisher ? IpcMessageErrorType::REQUEST_PUBLISHER_WRONG_IPC_MESSAGE_RESPONSE
+                                           : IpcMessageErrorType::REQUEST_SUBSCRIBER_WRONG_IPC_MESSAGE_RESPONSE;
+
+    const auto responseType = stringToIpcMessageType(cursor.next().c_str());
+    if (responseType == IpcMessageType::ERROR && cursor.getNumberOfRemainingElements() >= 1U)
+    {
+        return err(stringToIpcMessageErrorType(cursor.next().c_str()));
+    }
+
+    const auto ackType = isPublisher ? IpcMessageType::CREATE_PUBLISHER_ACK : IpcMessageType::CREATE_SUBSCRIBER_ACK;
+    if (responseType != ackType || cursor.getNumberOfRemainingElements() < 2U)
+    {
+        // the remaining responses cannot be assigned to the ports anymore
+        cursor.skip(cursor.getNumberOfRemainingElements());
+        return err(wrongResponse);
+    }
+
+    auto result = convert_id_and_offset(cursor);
+    if (!result)
+    {
+        return err(result.error());
+    }
+
+    auto [segment_id, offset] = result.value();
+    return ok(UntypedRelativePointer::getPtr(segment_id_t{segment_id}, offset));
+}
+
 popo::ClientPortUser::MemberType_t* PoshRuntimeImpl::getMiddlewareClient(const capro::ServiceDescription& service,
                                                                          const popo::ClientOptions& clientOptions,
                                                                          const PortConfigInfo& portConfigInfo) noexcept
@@ -764,10 +972,18 @@ void PoshRuntimeImpl::sendKeepAliveAndHandleShutdownPreparation() noexcept
 }
 
 expected<std::tuple<segment_id_underlying_t, UntypedRelativePointer::offset_t>, IpcMessageErrorType>
-PoshRuntimeImpl::convert_id_and_offset(IpcMessage& msg)
+PoshRuntimeImpl::convert_id_and_offset(const IpcMessage& msg, const uint32_t offsetIndex)
+{
+    IpcMessage::Cursor cursor(msg, offsetIndex);
+    return convert_id_and_offset(cursor);
+}
+
+expected<std::tuple<segment_id_underlying_t, UntypedRelativePointer::offset_t>, IpcMessageErrorType>
+PoshRuntimeImpl::convert_id_and_offset(IpcMessage::Cursor& cursor)
 {
-    auto id = convert::from_string<segment_id_underlying_t>(msg.getElementAtIndex(2U).c_str());
-    auto offset = convert::from_string<UntypedRelativePointer::offset_t>(msg.getElementAtIndex(1U).c_str());
+    // the offset precedes the segment id in the message
+    auto offset = convert::from_string<UntypedRelativePointer::offset_t>(cursor.next().c_str());
+    auto id = convert::from_string<segment_id_underlying_t>(cursor.next().c_str());
 
     if (!id.has_value())
     {
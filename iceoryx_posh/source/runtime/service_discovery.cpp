@@ -25,13 +25,161 @@ ServiceDiscovery::ServiceDiscovery() noexcept
 {
 }
 
-void ServiceDiscovery::update()
+void ServiceDiscovery::update() noexcept
 {
-    // allows us to use update and hence findService concurrently
-    std::lock_guard<std::mutex> lock(m_serviceRegistryMutex);
-    m_serviceRegistrySubscriber.take().and_then([&](popo::Sample<const roudi::ServiceRegistry>& serviceRegistrySample) {
-        *m_serviceRegistry = *serviceRegistrySample;
+    if (!m_serviceRegistrySubscriber.hasData() && !m_serviceRegistryDeltaSubscriber.hasData())
+    {
+        return;
+    }
+
+    if (!m_serviceRegistry)
+    {
+        takeServiceRegistrySnapshot();
+        if (!m_serviceRegistry)
+        {
+            // the deltas stay in the queue until there is a snapshot they can be applied to
+            return;
+        }
+    }
+
+    bool hasDelta{true};
+    while (hasDelta)
+    {
+        m_serviceRegistryDeltaSubscriber.take()
+            .and_then([&](popo::Sample<const roudi::ServiceRegistryDelta>& deltaSample) {
+                applyServiceRegistryDelta(*deltaSample);
+            })
+            .or_else([&](auto&) { hasDelta = false; });
+    }
+
+    // releases the snapshot which was published in the meantime; it is usually already contained in the local view
+    // and only copied if it is newer
+    takeServiceRegistrySnapshot();
+}
+
+void ServiceDiscovery::takeServiceRegistrySnapshot() noexcept
+{
+    // the snapshot is copied into the local view and released right away, therefore the snapshot chunks are not
+    // pinned by idle ServiceDiscovery instances and RouDi can always publish the next snapshot
+    m_serviceRegistrySubscriber.take().and_then([&](ServiceRegistrySample_t& serviceRegistrySample) {
+        const auto sequenceNumber = serviceRegistrySample.getUserHeader().sequenceNumber;
+        if (m_serviceRegistry && sequenceNumber <= m_serviceRegistrySequenceNumber)
+        {
+            return;
+        }
+
+        if (!m_serviceRegistry)
+        {
+            m_serviceRegistry.reset(new roudi::ServiceRegistry(*serviceRegistrySample));
+            if (m_serviceChangeCallback)
+            {
+                m_serviceRegistry->forEach(*m_serviceChangeCallback);
+            }
+        }
+        else
+        {
+            // the new view is built aside since the changes are determined by comparing it with the current one
+            if (m_spareServiceRegistry)
+            {
+                m_spareServiceRegistry->assign(*serviceRegistrySample);
+            }
+            else
+            {
+                m_spareServiceRegistry.reset(new roudi::ServiceRegistry(*serviceRegistrySample));
+            }
+            notifyServiceChanges(*m_spareServiceRegistry);
+            std::swap(m_serviceRegistry, m_spareServiceRegistry);
+        }
+        m_serviceRegistrySequenceNumber = sequenceNumber;
+    });
+}
+
+void ServiceDiscovery::applyServiceRegistryDelta(const roudi::ServiceRegistryDelta& delta) noexcept
+{
+    if (delta.sequenceNumber <= m_serviceRegistrySequenceNumber)
+    {
+        // the changes are already contained in the local view
+        return;
+    }
+
+    if (delta.sequenceNumber != m_serviceRegistrySequenceNumber + 1U)
+    {
+        // a delta was missed; the local view can only be resynchronized with a snapshot which contains it
+        takeServiceRegistrySnapshot();
+        if (delta.sequenceNumber != m_serviceRegistrySequenceNumber + 1U)
+        {
+            return;
+        }
+    }
+
+    for (const auto& change : delta.changes)
+    {
+        m_serviceRegistry->applyChange(change).or_else([&](auto&) {
+            IOX_LOG(WARN,
+                    "Could not apply change of service description '" << change.serviceDescription
+                                                                      << "' to the local service registry!");
+        });
+        if (m_serviceChangeCallback)
+        {
+            (*m_serviceChangeCallback)(change);
+        }
+    }
+    m_serviceRegistrySequenceNumber = delta.sequenceNumber;
+}
+
+void ServiceDiscovery::notifyServiceChanges(const roudi::ServiceRegistry& newServiceRegistry) noexcept
+{
+    if (!m_serviceChangeCallback)
+    {
+        return;
+    }
+
+    auto& callback = *m_serviceChangeCallback;
+    const auto& oldServiceRegistry = *m_serviceRegistry;
+
+    // entries which were added or whose counters changed
+    newServiceRegistry.forEach([&](const roudi::ServiceRegistry::ServiceDescriptionEntry& newEntry) {
+        bool isChanged{true};
+        const auto& service = newEntry.serviceDescription;
+        oldServiceRegistry.find(service.getServiceIDString(),
+                                service.getInstanceIDString(),
+                                service.getEventIDString(),
+                                [&](const roudi::ServiceRegistry::ServiceDescriptionEntry& oldEntry) {
+                                    isChanged = !(oldEntry.serviceDescription == service
+                                                  && oldEntry.publisherCount == newEntry.publisherCount
+                                                  && oldEntry.serverCount == newEntry.serverCount);
+                                });
+        if (isChanged)
+        {
+            callback(newEntry);
+        }
     });
+
+    // entries which were removed are reported with zero counters
+    oldServiceRegistry.forEach([&](const roudi::ServiceRegistry::ServiceDescriptionEntry& oldEntry) {
+        bool isRemoved{true};
+        const auto& service = oldEntry.serviceDescription;
+        newServiceRegistry.find(service.getServiceIDString(),
+                                service.getInstanceIDString(),
+                                service.getEventIDString(),
+                                [&](const roudi::ServiceRegistry::ServiceDescriptionEntry&) { isRemoved = false; });
+        if (isRemoved)
+        {
+            callback(roudi::ServiceRegistry::ServiceDescriptionEntry{service});
+        }
+    });
+}
+
+void ServiceDiscovery::setServiceChangeCallback(const ServiceChangeCallback& callback) noexcept
+{
+    std::lock_guard<std::mutex> lock(m_serviceRegistryMutex);
+    m_serviceChangeCallback.emplace(callback);
+}
+
+void ServiceDiscovery::resetServiceChangeCallback() noexcept
+{
+    std::lock_guard<std::mutex> lock(m_serviceRegistryMutex);
+    m_serviceChangeCallback.reset();
 }
 
 void ServiceDiscovery::findService(const optional<capro::IdString_t>& service,
@@ -40,12 +188,19 @@ void ServiceDiscovery::findService(const optional<capro::IdString_t>& service,
                                    const function_ref<void(const capro::ServiceDescription&)> callableForEach,
                                    const popo::MessagingPattern pattern) noexcept
 {
+    // allows us to use findService concurrently
+    std::lock_guard<std::mutex> lock(m_serviceRegistryMutex);
     update();
 
+    // there is no view when no snapshot was received yet
     switch (pattern)
     {
     case popo::MessagingPattern::PUB_SUB:
     {
+        if (!m_serviceRegistry)
+        {
+            break;
+        }
         m_serviceRegistry->find(
             service, instance, event, [&](const roudi::ServiceRegistry::ServiceDescriptionEntry& serviceEntry) {
                 if (serviceEntry.publisherCount > 0)
@@ -57,6 +212,10 @@ void ServiceDiscovery::findService(const optional<capro::IdString_t>& service,
     }
     case popo::MessagingPattern::REQ_RES:
     {
+        if (!m_serviceRegistry)
+        {
+            break;
+        }
         m_serviceRegistry->find(
             service, instance, event, [&](const roudi::ServiceRegistry::ServiceDescriptionEntry& serviceEntry) {
                 if (serviceEntry.serverCount > 0)
@@ -80,7 +239,7 @@ void ServiceDiscovery::enableEvent(popo::TriggerHandle&& triggerHandle, const Se
     {
     case ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED:
     {
-        m_serviceRegistrySubscriber.enableEvent(std::move(triggerHandle), popo::SubscriberEvent::DATA_RECEIVED);
+        m_serviceRegistryDeltaSubscriber.enableEvent(std::move(triggerHandle), popo::SubscriberEvent::DATA_RECEIVED);
         break;
     }
     default:
@@ -97,7 +256,7 @@ void ServiceDiscovery::disableEvent(const ServiceDiscoveryEvent event) noexcept
     {
     case ServiceDiscoveryEvent::SERVICE_REGISTRY_CHANGED:
     {
-        m_serviceRegistrySubscriber.disableEvent(popo::SubscriberEvent::DATA_RECEIVED);
+        m_serviceRegistryDeltaSubscriber.disableEvent(popo::SubscriberEvent::DATA_RECEIVED);
         break;
     }
     default:
@@ -110,13 +269,13 @@ void ServiceDiscovery::disableEvent(const ServiceDiscoveryEvent event) noexcept
 
 void ServiceDiscovery::invalidateTrigger(const uint64_t uniqueTriggerId)
 {
-    m_serviceRegistrySubscriber.invalidateTrigger(uniqueTriggerId);
+    m_serviceRegistryDeltaSubscriber.invalidateTrigger(uniqueTriggerId);
 }
 
 popo::WaitSetIsConditionSatisfiedCallback
 ServiceDiscovery::getCallbackForIsStateConditionSatisfied(const popo::SubscriberState state)
 {
-    return m_serviceRegistrySubscriber.getCallbackForIsStateConditionSatisfied(state);
+    return m_serviceRegistryDeltaSubscriber.getCallbackForIsStateConditionSatisfied(state);
 }
 
 } // namespace runtime
@@ -29,7 +29,8 @@ constexpr access_rights SharedMemoryUser::SHM_SEGMENT_PERMISSIONS;
 
 SharedMemoryUser::SharedMemoryUser(const size_t topicSize,
                                    const uint64_t segmentId,
-                                   const UntypedRelativePointer::offset_t segmentManagerAddressOffset) noexcept
+                                   const UntypedRelativePointer::offset_t segmentManagerAddressOffset,
+                                   const bool lockInMemory) noexcept
 {
     PosixSharedMemoryObjectBuilder()
         .name(roudi::SHM_NAME)
@@ -37,6 +38,7 @@ SharedMemoryUser::SharedMemoryUser(const size_t topicSize,
         .accessMode(AccessMode::READ_WRITE)
         .openMode(OpenMode::OPEN_EXISTING)
         .permissions(SHM_SEGMENT_PERMISSIONS)
+        .lockInMemory(lockInMemory)
         .create()
         .and_then([this, segmentId, segmentManagerAddressOffset](auto& sharedMemoryObject) {
             auto registeredSuccessfully = UntypedRelativePointer::registerPtrWithId(
@@ -78,6 +80,8 @@ void SharedMemoryUser::openDataSegments(const uint64_t segmentId,
             .accessMode(accessMode)
             .openMode(OpenMode::OPEN_EXISTING)
             .permissions(SHM_SEGMENT_PERMISSIONS)
+            .directory(segment.m_sharedMemoryDirectory)
+            .lockInMemory(segment.m_lockInMemory)
             .create()
             .and_then([this, &segment](auto& sharedMemoryObject) {
                 if (static_cast<uint32_t>(m_dataShmObjects.size()) >= MAX_SHM_SEGMENTS)
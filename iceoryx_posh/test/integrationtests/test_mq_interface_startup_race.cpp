@@ -80,7 +80,7 @@ class CMqInterfaceStartupRace_test : public Test
 
     void checkRegRequest(const IpcMessage& msg) const
     {
-        ASSERT_THAT(msg.getNumberOfElements(), Eq(6u));
+        ASSERT_THAT(msg.getNumberOfElements(), Eq(7u));
 
         std::string cmd = msg.getElementAtIndex(0);
         ASSERT_THAT(cmd.c_str(), StrEq(IpcMessageTypeToString(IpcMessageType::REG)));
@@ -96,11 +96,13 @@ class CMqInterfaceStartupRace_test : public Test
         constexpr uint32_t DUMMY_SHM_SIZE{37};
         constexpr uint32_t DUMMY_SHM_OFFSET{73};
         constexpr uint32_t DUMMY_SEGMENT_ID{13};
+        constexpr bool LOCK_SHM_IN_MEMORY{false};
         constexpr uint32_t INDEX_OF_TIMESTAMP{4};
         constexpr iox::UntypedRelativePointer::offset_t OFFSET_ADDRESS_HEARTBEAT{
             iox::UntypedRelativePointer::NULL_POINTER_OFFSET};
         regAck << IpcMessageTypeToString(IpcMessageType::REG_ACK) << DUMMY_SHM_SIZE << DUMMY_SHM_OFFSET
-               << oldMsg.getElementAtIndex(INDEX_OF_TIMESTAMP) << DUMMY_SEGMENT_ID << OFFSET_ADDRESS_HEARTBEAT;
+               << oldMsg.getElementAtIndex(INDEX_OF_TIMESTAMP) << DUMMY_SEGMENT_ID << OFFSET_ADDRESS_HEARTBEAT
+               << LOCK_SHM_IN_MEMORY;
 
         if (!m_appQueue.has_value())
         {
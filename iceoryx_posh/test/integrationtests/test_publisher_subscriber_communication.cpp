@@ -32,6 +32,8 @@
 
 #include "test.hpp"
 
+#include <vector>
+
 namespace
 {
 using namespace ::testing;
@@ -713,4 +715,41 @@ TEST_F(PublisherSubscriberCommunication_test, PublisherUniqueIdMatchesReceivedSa
     }
 }
 
+TEST_F(PublisherSubscriberCommunication_test, PublishManyDeliversAllSamplesInOrderToEverySubscriber)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "adce1b41-bb5b-4ed4-bd6a-444ca1cd4706");
+    constexpr uint64_t NUMBER_OF_SAMPLES{5U};
+
+    auto publisher = createPublisher<uint64_t>();
+    auto subscriber = createSubscriber<uint64_t>();
+    auto otherSubscriber = createSubscriber<uint64_t>();
+
+    std::vector<Sample<uint64_t>> samples;
+    for (uint64_t i = 0U; i < NUMBER_OF_SAMPLES; ++i)
+    {
+        ASSERT_FALSE(publisher->loan()
+                         .and_then([&](auto& sample) {
+                             *sample = i * 73U;
+                             samples.emplace_back(std::move(sample));
+                         })
+                         .has_error());
+    }
+
+    publisher->publishMany(iox::span<Sample<uint64_t>>(samples.data(), samples.size()));
+
+    for (auto* sub : {subscriber.get(), otherSubscriber.get()})
+    {
+        for (uint64_t i = 0U; i < NUMBER_OF_SAMPLES; ++i)
+        {
+            EXPECT_FALSE(sub->take()
+                             .and_then([&](auto& sample) {
+                                 EXPECT_THAT(*sample, Eq(i * 73U));
+                                 EXPECT_THAT(sample.getChunkHeader()->originId(), Eq(publisher->getUid()));
+                             })
+                             .has_error());
+        }
+        EXPECT_THAT(sub->take().has_error(), Eq(true));
+    }
+}
+
 } // namespace
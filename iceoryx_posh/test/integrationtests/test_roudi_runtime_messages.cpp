@@ -0,0 +1,218 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_hoofs/testing/error_reporting/testing_support.hpp"
+#include "iceoryx_posh/capro/service_description.hpp"
+#include "iceoryx_posh/iceoryx_posh_types.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_message.hpp"
+#include "iceoryx_posh/internal/runtime/ipc_runtime_interface.hpp"
+#include "iceoryx_posh/popo/publisher_options.hpp"
+#include "iceoryx_posh/popo/subscriber_options.hpp"
+#include "iceoryx_posh/roudi_env/minimal_roudi_config.hpp"
+#include "iceoryx_posh/roudi_env/roudi_env.hpp"
+#include "iceoryx_posh/runtime/port_config_info.hpp"
+#include "iox/duration.hpp"
+
+#include "test.hpp"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox;
+using namespace iox::runtime;
+using namespace iox::roudi_env;
+using namespace iox::units::duration_literals;
+
+constexpr uint32_t NUMBER_OF_RUNTIMES{16U};
+constexpr uint32_t NUMBER_OF_RUNTIME_MESSAGES_THREADS{4U};
+constexpr units::Duration ROUDI_WAITING_TIMEOUT{10_s};
+
+class RouDiRuntimeMessages_test : public Test
+{
+  public:
+    struct Result
+    {
+        uint32_t numberOfRegisteredRuntimes{0U};
+        uint32_t numberOfCreatedPublishers{0U};
+        uint32_t numberOfCreatedSubscribers{0U};
+        uint32_t numberOfTerminatedRuntimes{0U};
+    };
+
+    /// @brief sends a request to RouDi and returns the message type of the response
+    static IpcMessageType
+    sendRequest(IpcRuntimeInterface& runtime, const IpcMessageType request, const RuntimeName_t& name)
+    {
+        IpcMessage sendBuffer;
+        sendBuffer << IpcMessageTypeToString(request) << name;
+        return sendRequest(runtime, sendBuffer);
+    }
+
+    static IpcMessageType sendRequest(IpcRuntimeInterface& runtime, const IpcMessage& sendBuffer)
+    {
+        IpcMessage receiveBuffer;
+        if (!runtime.sendRequestToRouDi(sendBuffer, receiveBuffer))
+        {
+            return IpcMessageType::NOTYPE;
+        }
+        return stringToIpcMessageType(receiveBuffer.getElementAtIndex(0).c_str());
+    }
+
+    /// @brief lets NUMBER_OF_RUNTIMES runtimes concurrently register, create a publisher and a subscriber and
+    /// unregister at a RouDi which processes the runtime messages with the given number of threads
+    static Result registerAndCreatePortsConcurrently(const uint32_t runtimeMessagesThreadCount)
+    {
+        RouDiEnv roudiEnv{
+            MinimalRouDiConfigBuilder().create(), roudi::MonitoringMode::OFF, 0U, runtimeMessagesThreadCount};
+
+        std::atomic<uint32_t> numberOfStartedRuntimes{0U};
+        std::atomic<uint32_t> numberOfRegisteredRuntimes{0U};
+        std::atomic<uint32_t> numberOfCreatedPublishers{0U};
+        std::atomic<uint32_t> numberOfCreatedSubscribers{0U};
+        std::atomic<uint32_t> numberOfTerminatedRuntimes{0U};
+
+        std::vector<std::thread> runtimes;
+        for (uint32_t i = 0U; i < NUMBER_OF_RUNTIMES; ++i)
+        {
+            runtimes.emplace_back([&, i] {
+                const RuntimeName_t name{TruncateToCapacity, ("port_runtime_" + std::to_string(i)).c_str()};
+                const capro::ServiceDescription service{
+                    "Radar", "FrontLeft", capro::IdString_t(TruncateToCapacity, name.c_str())};
+
+                ++numberOfStartedRuntimes;
+                while (numberOfStartedRuntimes.load() < NUMBER_OF_RUNTIMES)
+                {
+                    std::this_thread::yield();
+                }
+
+                IpcRuntimeInterface runtime(roudi::IPC_CHANNEL_ROUDI_NAME, name, ROUDI_WAITING_TIMEOUT);
+                if (runtime.getShmTopicSize() > 0U)
+                {
+                    ++numberOfRegisteredRuntimes;
+                }
+
+                IpcMessage createPublisher;
+                createPublisher << IpcMessageTypeToString(IpcMessageType::CREATE_PUBLISHER) << name
+                                << static_cast<Serialization>(service).toString()
+                                << popo::PublisherOptions().serialize().toString()
+                                << static_cast<Serialization>(PortConfigInfo()).toString();
+                if (sendRequest(runtime, createPublisher) == IpcMessageType::CREATE_PUBLISHER_ACK)
+                {
+                    ++numberOfCreatedPublishers;
+                }
+
+                IpcMessage createSubscriber;
+                createSubscriber << IpcMessageTypeToString(IpcMessageType::CREATE_SUBSCRIBER) << name
+                                 << static_cast<Serialization>(service).toString()
+                                 << popo::SubscriberOptions().serialize().toString()
+                                 << static_cast<Serialization>(PortConfigInfo()).toString();
+                if (sendRequest(runtime, createSubscriber) == IpcMessageType::CREATE_SUBSCRIBER_ACK)
+                {
+                    ++numberOfCreatedSubscribers;
+                }
+
+                if (sendRequest(runtime, IpcMessageType::TERMINATION, name) == IpcMessageType::TERMINATION_ACK)
+                {
+                    ++numberOfTerminatedRuntimes;
+                }
+            });
+        }
+
+        for (auto& runtime : runtimes)
+        {
+            runtime.join();
+        }
+
+        Result result;
+        result.numberOfRegisteredRuntimes = numberOfRegisteredRuntimes.load();
+        result.numberOfCreatedPublishers = numberOfCreatedPublishers.load();
+        result.numberOfCreatedSubscribers = numberOfCreatedSubscribers.load();
+        result.numberOfTerminatedRuntimes = numberOfTerminatedRuntimes.load();
+        return result;
+    }
+};
+
+TEST_F(RouDiRuntimeMessages_test, RuntimesWhichTalkToRouDiConcurrentlyAreAllServed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3a5dc81b-a47b-470d-abb2-d8f6cf23015d");
+    RouDiEnv roudiEnv{
+        RouDiConfig_t().setDefaults(), roudi::MonitoringMode::OFF, 0U, NUMBER_OF_RUNTIME_MESSAGES_THREADS};
+
+    std::atomic<uint32_t> numberOfStartedRuntimes{0U};
+    std::atomic<uint32_t> numberOfRegisteredRuntimes{0U};
+    std::atomic<uint32_t> numberOfRejectedUnsupportedRequests{0U};
+    std::atomic<uint32_t> numberOfTerminatedRuntimes{0U};
+
+    std::vector<std::thread> runtimes;
+    for (uint32_t i = 0U; i < NUMBER_OF_RUNTIMES; ++i)
+    {
+        runtimes.emplace_back([&, i] {
+            const RuntimeName_t name{TruncateToCapacity, ("concurrent_runtime_" + std::to_string(i)).c_str()};
+
+            ++numberOfStartedRuntimes;
+            while (numberOfStartedRuntimes.load() < NUMBER_OF_RUNTIMES)
+            {
+                std::this_thread::yield();
+            }
+
+            // the constructor registers the runtime at RouDi and waits for the REG_ACK
+            IpcRuntimeInterface runtime(roudi::IPC_CHANNEL_ROUDI_NAME, name, ROUDI_WAITING_TIMEOUT);
+            if (runtime.getShmTopicSize() > 0U)
+            {
+                ++numberOfRegisteredRuntimes;
+            }
+
+            // an unsupported request is answered while other threads register or terminate runtimes
+            if (sendRequest(runtime, IpcMessageType::REG_ACK, name) == IpcMessageType::MESSAGE_NOT_SUPPORTED)
+            {
+                ++numberOfRejectedUnsupportedRequests;
+            }
+
+            if (sendRequest(runtime, IpcMessageType::TERMINATION, name) == IpcMessageType::TERMINATION_ACK)
+            {
+                ++numberOfTerminatedRuntimes;
+            }
+        });
+    }
+
+    for (auto& runtime : runtimes)
+    {
+        runtime.join();
+    }
+
+    EXPECT_THAT(numberOfRegisteredRuntimes.load(), Eq(NUMBER_OF_RUNTIMES));
+    EXPECT_THAT(numberOfRejectedUnsupportedRequests.load(), Eq(NUMBER_OF_RUNTIMES));
+    EXPECT_THAT(numberOfTerminatedRuntimes.load(), Eq(NUMBER_OF_RUNTIMES));
+    IOX_TESTING_EXPECT_OK();
+}
+
+TEST_F(RouDiRuntimeMessages_test, RuntimesWhichRegisterAndCreatePortsConcurrentlyAreAllServed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "351dc048-4a4e-4fda-84b0-024dc781914e");
+    const auto result = registerAndCreatePortsConcurrently(NUMBER_OF_RUNTIME_MESSAGES_THREADS);
+
+    EXPECT_THAT(result.numberOfRegisteredRuntimes, Eq(NUMBER_OF_RUNTIMES));
+    EXPECT_THAT(result.numberOfCreatedPublishers, Eq(NUMBER_OF_RUNTIMES));
+    EXPECT_THAT(result.numberOfCreatedSubscribers, Eq(NUMBER_OF_RUNTIMES));
+    EXPECT_THAT(result.numberOfTerminatedRuntimes, Eq(NUMBER_OF_RUNTIMES));
+    IOX_TESTING_EXPECT_OK();
+}
+
+} // namespace
@@ -29,6 +29,7 @@
 #include "iceoryx_posh/testing/roudi_gtest.hpp"
 #include "test.hpp"
 
+#include <algorithm>
 #include <random>
 #include <set>
 #include <type_traits>
@@ -173,7 +174,7 @@ TEST_F(ServiceDiscoveryBase_test, FindServiceWithWildcardsReturnsOnlyIntrospecti
     ::testing::Test::RecordProperty("TEST_ID", "d944f32c-edef-44f5-a6eb-c19ee73c98eb");
     findService(iox::capro::Wildcard, iox::capro::Wildcard, iox::capro::Wildcard, MessagingPattern::PUB_SUB);
 
-    constexpr uint32_t NUM_INTERNAL_SERVICES = 6U;
+    constexpr uint32_t NUM_INTERNAL_SERVICES = 7U;
     EXPECT_EQ(serviceContainer.size(), NUM_INTERNAL_SERVICES);
     for (auto& service : serviceContainer)
     {
@@ -181,6 +182,106 @@ TEST_F(ServiceDiscoveryBase_test, FindServiceWithWildcardsReturnsOnlyIntrospecti
     }
 }
 
+class ServiceRegistrySnapshot_test : public RouDi_GTest
+{
+  public:
+    static constexpr uint32_t DISCOVERY_CHUNK_COUNT{2U};
+
+    ServiceRegistrySnapshot_test()
+        : RouDi_GTest(MinimalRouDiConfigBuilder().discoveryChunkCount(DISCOVERY_CHUNK_COUNT).create())
+    {
+    }
+
+    // every discovery cycle with a change publishes a delta and after the delta history a snapshot
+    void offerNextService()
+    {
+        publishers.emplace_back(std::make_unique<UntypedPublisher>(ServiceDescription(
+            "service", IdString_t(TruncateToCapacity, std::to_string(numberOfDiscoveryCycles).c_str()), "event")));
+        triggerDiscoveryLoopAndWaitToFinish();
+        ++numberOfDiscoveryCycles;
+    }
+
+    static uint64_t numberOfOfferedServices(ServiceDiscovery& serviceDiscovery)
+    {
+        uint64_t numberOfFoundServices{0U};
+        serviceDiscovery.findService(
+            IdString_t("service"),
+            iox::capro::Wildcard,
+            IdString_t("event"),
+            [&](auto&) { ++numberOfFoundServices; },
+            MessagingPattern::PUB_SUB);
+        return numberOfFoundServices;
+    }
+
+    iox::runtime::PoshRuntime* runtime{&iox::runtime::PoshRuntime::initRuntime("Runtime")};
+    std::vector<std::unique_ptr<UntypedPublisher>> publishers;
+    uint64_t numberOfDiscoveryCycles{0U};
+};
+
+TEST_F(ServiceRegistrySnapshot_test, IdleServiceDiscoveriesDoNotExhaustTheDiscoveryMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b8817b4d-00c8-4ce3-b74a-87d1db5384a3");
+    // every idle ServiceDiscovery has seen another version of the service registry
+    constexpr uint64_t NUMBER_OF_IDLE_SERVICE_DISCOVERIES{2U * DISCOVERY_CHUNK_COUNT + 2U};
+    std::vector<std::unique_ptr<ServiceDiscovery>> idleServiceDiscoveries;
+
+    for (uint64_t i = 0U; i <= NUMBER_OF_IDLE_SERVICE_DISCOVERIES; ++i)
+    {
+        offerNextService();
+
+        if (i < NUMBER_OF_IDLE_SERVICE_DISCOVERIES)
+        {
+            idleServiceDiscoveries.emplace_back(std::make_unique<ServiceDiscovery>());
+            idleServiceDiscoveries.back()->findService(IdString_t("service"),
+                                                       IdString_t(TruncateToCapacity, std::to_string(i).c_str()),
+                                                       IdString_t("event"),
+                                                       [](auto&) {},
+                                                       MessagingPattern::PUB_SUB);
+        }
+    }
+
+    // a new ServiceDiscovery initializes its view with the latest snapshot
+    ServiceDiscovery newServiceDiscovery;
+
+    EXPECT_THAT(numberOfOfferedServices(newServiceDiscovery), Eq(NUMBER_OF_IDLE_SERVICE_DISCOVERIES + 1U));
+}
+
+TEST_F(ServiceRegistrySnapshot_test, MoreServiceDiscoveriesThanDiscoveryChunksFindAllOfferedServices)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "849244eb-740a-4912-8021-09f8050c89ea");
+    constexpr uint64_t NUMBER_OF_SERVICE_DISCOVERIES{5U * DISCOVERY_CHUNK_COUNT};
+    // more changes than the delta history, therefore snapshots are published while all instances exist
+    constexpr uint64_t NUMBER_OF_SERVICES{2U * roudi::ServiceRegistryDelta::HISTORY_CAPACITY + 1U};
+    std::vector<std::unique_ptr<ServiceDiscovery>> serviceDiscoveries;
+    for (uint64_t k = 0U; k < NUMBER_OF_SERVICE_DISCOVERIES; ++k)
+    {
+        serviceDiscoveries.emplace_back(std::make_unique<ServiceDiscovery>());
+    }
+
+    for (uint64_t i = 0U; i < NUMBER_OF_SERVICES; ++i)
+    {
+        offerNextService();
+
+        // the instances update their views at different rates, the rarely updated ones miss deltas and are
+        // resynchronized with a snapshot
+        for (uint64_t k = 0U; k < NUMBER_OF_SERVICE_DISCOVERIES; ++k)
+        {
+            if (i % (k + 1U) == 0U)
+            {
+                EXPECT_THAT(numberOfOfferedServices(*serviceDiscoveries[k]), Eq(i + 1U));
+            }
+        }
+    }
+
+    for (uint64_t k = 0U; k < NUMBER_OF_SERVICE_DISCOVERIES; ++k)
+    {
+        SCOPED_TRACE(std::string("ServiceDiscovery ") + std::to_string(k));
+        EXPECT_THAT(numberOfOfferedServices(*serviceDiscoveries[k]), Eq(NUMBER_OF_SERVICES));
+    }
+    ServiceDiscovery newServiceDiscovery;
+    EXPECT_THAT(numberOfOfferedServices(newServiceDiscovery), Eq(NUMBER_OF_SERVICES));
+}
+
 //
 // Offer, StopOffer, Reoffer
 // Variation of PUB/SUB and REQ/RES
@@ -373,6 +474,60 @@ TEST_F(ServiceDiscoveryNotification_test, ServiceDiscoveryNotifiedbyListenerFind
     EXPECT_THAT(serviceContainer.front(), Eq(serviceDescriptionToSearchFor));
 }
 
+TEST_F(ServiceDiscoveryNotification_test, ServiceChangeCallbackIsCalledWithStateOfOfferedAndStopOfferedService)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "39dbd964-0695-40c3-8337-2185d662020f");
+    const iox::capro::ServiceDescription SERVICE_DESCRIPTION("Kaese", "Kuchen", "Krume");
+    std::vector<iox::roudi::ServiceRegistry::ServiceDescriptionEntry> changes;
+
+    sut.setServiceChangeCallback([&](const iox::roudi::ServiceRegistry::ServiceDescriptionEntry& change) {
+        if (change.serviceDescription == SERVICE_DESCRIPTION)
+        {
+            changes.push_back(change);
+        }
+    });
+
+    iox::popo::UntypedPublisher publisher(SERVICE_DESCRIPTION);
+    this->triggerDiscoveryLoopAndWaitToFinish();
+    findService(iox::capro::Wildcard, iox::capro::Wildcard, iox::capro::Wildcard, MessagingPattern::PUB_SUB);
+
+    ASSERT_THAT(changes.size(), Eq(1U));
+    EXPECT_THAT(changes[0].publisherCount, Eq(1U));
+    EXPECT_THAT(changes[0].serverCount, Eq(0U));
+
+    publisher.stopOffer();
+    this->triggerDiscoveryLoopAndWaitToFinish();
+    findService(iox::capro::Wildcard, iox::capro::Wildcard, iox::capro::Wildcard, MessagingPattern::PUB_SUB);
+
+    ASSERT_THAT(changes.size(), Eq(2U));
+    EXPECT_THAT(changes[1].publisherCount, Eq(0U));
+    EXPECT_THAT(changes[1].serverCount, Eq(0U));
+}
+
+TEST_F(ServiceDiscoveryNotification_test, RepeatedFindServiceWithoutChangesDoesNotReportChanges)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fe915198-4c8c-4be0-9480-caace29b40e2");
+    const iox::capro::ServiceDescription SERVICE_DESCRIPTION("Apfel", "Birne", "Quitte");
+    iox::popo::UntypedPublisher publisher(SERVICE_DESCRIPTION);
+    this->triggerDiscoveryLoopAndWaitToFinish();
+    findService(iox::capro::Wildcard, iox::capro::Wildcard, iox::capro::Wildcard, MessagingPattern::PUB_SUB);
+
+    uint64_t numberOfChanges{0U};
+    sut.setServiceChangeCallback(
+        [&](const iox::roudi::ServiceRegistry::ServiceDescriptionEntry&) { ++numberOfChanges; });
+
+    for (uint64_t i = 0U; i < 3U; ++i)
+    {
+        findService(SERVICE_DESCRIPTION.getServiceIDString(),
+                    SERVICE_DESCRIPTION.getInstanceIDString(),
+                    SERVICE_DESCRIPTION.getEventIDString(),
+                    MessagingPattern::PUB_SUB);
+        ASSERT_THAT(serviceContainer.size(), Eq(1U));
+        EXPECT_THAT(serviceContainer[0], Eq(SERVICE_DESCRIPTION));
+    }
+    EXPECT_THAT(numberOfChanges, Eq(0U));
+}
+
 //
 // FindService Tests
 // Check whether findService works in all variations
@@ -450,6 +605,9 @@ class ReferenceDiscovery
             services.emplace(iox::SERVICE_DISCOVERY_SERVICE_NAME,
                              iox::SERVICE_DISCOVERY_INSTANCE_NAME,
                              iox::SERVICE_DISCOVERY_EVENT_NAME);
+            services.emplace(iox::SERVICE_DISCOVERY_SERVICE_NAME,
+                             iox::SERVICE_DISCOVERY_INSTANCE_NAME,
+                             iox::SERVICE_DISCOVERY_DELTA_EVENT_NAME);
         }
     }
 
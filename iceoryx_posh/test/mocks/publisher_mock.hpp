@@ -22,6 +22,7 @@
 #include "iceoryx_posh/popo/publisher.hpp"
 #include "iceoryx_posh/popo/sample.hpp"
 #include "iox/expected.hpp"
+#include "iox/span.hpp"
 
 #include "test.hpp"
 
@@ -58,6 +59,7 @@ class MockPublisherPortUser
                      const uint32_t, const uint32_t, const uint32_t, const uint32_t));
     MOCK_METHOD1(releaseChunk, void(iox::mepoo::ChunkHeader* const));
     MOCK_METHOD1(sendChunk, void(iox::mepoo::ChunkHeader* const));
+    MOCK_METHOD1(sendChunks, void(const iox::span<iox::mepoo::ChunkHeader* const>));
     MOCK_METHOD0(tryGetPreviousChunk, iox::optional<iox::mepoo::ChunkHeader*>());
     MOCK_METHOD0(offer, void());
     MOCK_METHOD0(stopOffer, void());
@@ -413,6 +413,144 @@ TEST_F(MemoryManager_test, emptyMemPoolDoesNotResultInAcquiringChunksFromOtherMe
     EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(0U));
 }
 
+TEST_F(MemoryManager_test, emptyMemPoolWithFallThroughPolicyResultsInAcquiringChunksFromNextLargerMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5d0f2c71-8e4b-4a3f-9b16-c7e2a9d40f58");
+    constexpr uint32_t CHUNK_COUNT{100};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_128, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_256, CHUNK_COUNT});
+    mempoolconf.m_allocationPolicy = iox::mepoo::MemPoolAllocationPolicy::FALL_THROUGH_TO_LARGER_MEMPOOL;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_64);
+    auto fallThroughChunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_64);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(3).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, getChunkWithFallThroughPolicyFailsWhenAllLargerMemPoolsAreEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a71e93c4-0b2d-4f6e-8c5a-3e94d1b7f026");
+    constexpr uint32_t CHUNK_COUNT{10};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+    mempoolconf.m_allocationPolicy = iox::mepoo::MemPoolAllocationPolicy::FALL_THROUGH_TO_LARGER_MEMPOOL;
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(2U * CHUNK_COUNT, chunkSettings_32);
+
+    constexpr auto EXPECTED_ERROR{iox::mepoo::MemoryManager::Error::MEMPOOL_OUT_OF_CHUNKS};
+    sut->getChunk(chunkSettings_32)
+        .and_then(
+            [&](auto&) { GTEST_FAIL() << "getChunk should fail with '" << EXPECTED_ERROR << "' but did not fail"; })
+        .or_else([&](const auto& error) { EXPECT_EQ(error, EXPECTED_ERROR); });
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_COUNT));
+}
+
+TEST_F(MemoryManager_test, getChunkAcquiresChunkFromBestFittingMemPoolWhenMemPoolsShareASizeClass)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e3b5c8d2-6f17-49a0-b4e1-92d0c7a6f3b8");
+    constexpr uint32_t CHUNK_COUNT{10};
+    constexpr uint32_t CHUNK_SIZE_160{160U};
+    constexpr uint32_t CHUNK_SIZE_192{192U};
+    constexpr uint32_t CHUNK_SIZE_224{224U};
+
+    mempoolconf.addMemPool({CHUNK_SIZE_160, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_192, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_224, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkSettings_200 = ChunkSettings::create(200U, iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT).value();
+    auto chunkStore = getChunksFromSut(1U, chunkSettings_200);
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(0U));
+    EXPECT_THAT(sut->getMemPoolInfo(2).m_usedChunks, Eq(1U));
+}
+
+TEST_F(MemoryManager_test, chunkManagementIsStoredInTheSlotAtTheIndexOfTheChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "11398329-33f8-43b1-b82e-8c49a251189c");
+    constexpr uint32_t CHUNK_COUNT{2U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    auto chunkStore = getChunksFromSut(CHUNK_COUNT, chunkSettings_32);
+    ASSERT_THAT(chunkStore.size(), Eq(CHUNK_COUNT));
+
+    auto chunkHeaderDistance = reinterpret_cast<uint8_t*>(chunkStore[1].getChunkHeader())
+                               - reinterpret_cast<uint8_t*>(chunkStore[0].getChunkHeader());
+    auto* chunkManagement0 = chunkStore[0].release();
+    auto* chunkManagement1 = chunkStore[1].release();
+    auto chunkManagementDistance = chunkManagement1 - chunkManagement0;
+    EXPECT_THAT(chunkManagementDistance * static_cast<int64_t>(sut->getMemPoolInfo(0).m_chunkSize),
+                Eq(chunkHeaderDistance));
+
+    // the freed chunk is acquired again and uses the same slot
+    {
+        iox::mepoo::SharedChunk chunkToFree(chunkManagement0);
+    }
+    auto reacquiredChunkStore = getChunksFromSut(1U, chunkSettings_32);
+    ASSERT_THAT(reacquiredChunkStore.size(), Eq(1U));
+    EXPECT_THAT(reacquiredChunkStore[0].release(), Eq(chunkManagement0));
+
+    iox::mepoo::SharedChunk reacquiredChunk(chunkManagement0);
+    iox::mepoo::SharedChunk chunk1(chunkManagement1);
+}
+
+TEST_F(MemoryManager_test, getChunksUsesTheChunkManagementSlotsOfTheChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d4365d04-fd21-484f-94b6-0fd2ba213700");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    sut->configureMemoryManager(mempoolconf, *allocator, *allocator);
+
+    {
+        iox::mepoo::SharedChunk chunks[CHUNK_COUNT];
+        EXPECT_THAT(sut->getChunks(chunkSettings_32, &chunks[0], CHUNK_COUNT), Eq(CHUNK_COUNT));
+        EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_COUNT));
+        for (auto& chunk : chunks)
+        {
+            ASSERT_TRUE(chunk);
+            EXPECT_THAT(chunk.getChunkHeader()->userPayloadSize(), Eq(CHUNK_SIZE_32));
+        }
+    }
+
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(0U));
+}
+
+TEST_F(MemoryManager_test, requiredManagementMemorySizeIsSufficientForAllMemPools)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e8bc0ec2-e1e5-4f83-8ed8-f46c6606747c");
+    constexpr uint32_t CHUNK_COUNT{10U};
+    mempoolconf.addMemPool({CHUNK_SIZE_32, CHUNK_COUNT});
+    mempoolconf.addMemPool({CHUNK_SIZE_64, CHUNK_COUNT});
+
+    const auto managementMemorySize = iox::mepoo::MemoryManager::requiredManagementMemorySize(mempoolconf);
+    const auto chunkMemorySize = iox::mepoo::MemoryManager::requiredChunkMemorySize(mempoolconf);
+    std::vector<uint64_t> managementMemory(managementMemorySize / sizeof(uint64_t) + 1U);
+    std::vector<uint64_t> chunkMemory(chunkMemorySize / sizeof(uint64_t) + 1U);
+    iox::BumpAllocator managementAllocator{managementMemory.data(), managementMemorySize};
+    iox::BumpAllocator chunkMemoryAllocator{chunkMemory.data(), chunkMemorySize};
+
+    sut->configureMemoryManager(mempoolconf, managementAllocator, chunkMemoryAllocator);
+
+    auto chunkStore_32 = getChunksFromSut(CHUNK_COUNT, chunkSettings_32);
+    auto chunkStore_64 = getChunksFromSut(CHUNK_COUNT, chunkSettings_64);
+    EXPECT_THAT(sut->getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_THAT(sut->getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_COUNT));
+    EXPECT_FALSE(managementAllocator.allocate(1U, 1U).has_value());
+}
+
 TEST_F(MemoryManager_test, freeChunkMultiMemPoolFullToEmptyToFull)
 {
     ::testing::Test::RecordProperty("TEST_ID", "0eddc5b5-e28f-43df-9da7-2c12014284a5");
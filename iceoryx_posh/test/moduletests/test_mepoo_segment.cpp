@@ -109,9 +109,31 @@ class MePooSegment_test : public Test
 
         IOX_BUILDER_PARAMETER(iox::access_rights, permissions, iox::perms::none)
 
+        IOX_BUILDER_PARAMETER(uint32_t, zeroingThreadCount, 1U)
+
+        IOX_BUILDER_PARAMETER(iox::optional<detail::PosixSharedMemory::Directory_t>, directory, iox::nullopt)
+
+        IOX_BUILDER_PARAMETER(NumaMemoryPolicy, numaPolicy, NumaMemoryPolicy::DEFAULT)
+
+        IOX_BUILDER_PARAMETER(uint64_t, numaNodeMask, 0U)
+
+        IOX_BUILDER_PARAMETER(bool, lockInMemory, false)
+
       public:
+        static bool hugePagesAvailable;
+        static NumaMemoryPolicy createdNumaPolicy;
+        static uint64_t createdNumaNodeMask;
+        static bool createdLockedInMemory;
+
         iox::expected<SharedMemoryObject_MOCK, PosixSharedMemoryObjectError> create() noexcept
         {
+            createdNumaPolicy = m_numaPolicy;
+            createdNumaNodeMask = m_numaNodeMask;
+            createdLockedInMemory = m_lockInMemory;
+            if (m_directory && !hugePagesAvailable)
+            {
+                return iox::err(PosixSharedMemoryObjectError::MAPPING_SHARED_MEMORY_FAILED);
+            }
             return iox::ok(SharedMemoryObject_MOCK(m_name,
                                                    m_memorySizeInBytes,
                                                    m_accessMode,
@@ -142,6 +164,10 @@ class MePooSegment_test : public Test
     }
 };
 MePooSegment_test::SharedMemoryObject_MOCK::createFct MePooSegment_test::SharedMemoryObject_MOCK::createVerificator;
+bool MePooSegment_test::SharedMemoryObject_MOCKBuilder::hugePagesAvailable{true};
+NumaMemoryPolicy MePooSegment_test::SharedMemoryObject_MOCKBuilder::createdNumaPolicy{NumaMemoryPolicy::DEFAULT};
+uint64_t MePooSegment_test::SharedMemoryObject_MOCKBuilder::createdNumaNodeMask{0U};
+bool MePooSegment_test::SharedMemoryObject_MOCKBuilder::createdLockedInMemory{false};
 
 TEST_F(MePooSegment_test, SharedMemoryFileHandleRightsAfterConstructor)
 {
@@ -217,4 +243,119 @@ TEST_F(MePooSegment_test, GetMemoryManager)
         .or_else([](auto& error) { GTEST_FAIL() << "getChunk failed with: " << error; });
 }
 
+TEST_F(MePooSegment_test, SegmentWithHugePagesIsCreatedInHugePageMountWithAlignedSize)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "79fde882-605f-4fef-8a7e-4f6dee418d51");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    const HugePageMount_t hugePageMount{"/mnt/huge"};
+    if (!isHugePageMount(hugePageMount, HugePageSize::SIZE_2MB))
+    {
+        GTEST_SKIP() << "This test requires a hugetlbfs with 2MB pages mounted at " << hugePageMount.c_str();
+    }
+    SUT sut{mepooConfig,
+            m_managementAllocator,
+            PosixGroup{"iox_roudi_test1"},
+            PosixGroup{"iox_roudi_test2"},
+            MemoryInfo(),
+            SHM_SEGMENT_DEFAULT_ZEROING_THREAD_COUNT,
+            HugePageSize::SIZE_2MB,
+            hugePageMount};
+
+    ASSERT_TRUE(sut.getSharedMemoryDirectory().has_value());
+    EXPECT_THAT(sut.getSharedMemoryDirectory().value(), Eq(hugePageMount));
+    EXPECT_THAT(sut.getSegmentSize(), Eq(hugePageSizeInBytes(HugePageSize::SIZE_2MB)));
+}
+
+TEST_F(MePooSegment_test, SegmentWithHugePagesFallsBackToRegularPagesWhenHugePagesAreUnavailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "02e51094-1302-452a-91e5-8c3152daa8ee");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    SharedMemoryObject_MOCKBuilder::hugePagesAvailable = false;
+    SUT sut{mepooConfig,
+            m_managementAllocator,
+            PosixGroup{"iox_roudi_test1"},
+            PosixGroup{"iox_roudi_test2"},
+            MemoryInfo(),
+            SHM_SEGMENT_DEFAULT_ZEROING_THREAD_COUNT,
+            HugePageSize::SIZE_1GB};
+    SharedMemoryObject_MOCKBuilder::hugePagesAvailable = true;
+
+    EXPECT_FALSE(sut.getSharedMemoryDirectory().has_value());
+    EXPECT_THAT(sut.getSegmentSize(), Eq(MemoryManager::requiredChunkMemorySize(mepooConfig)));
+}
+
+TEST_F(MePooSegment_test, SegmentWithHugePagesFallsBackToRegularPagesWhenDirectoryIsNoHugetlbfs)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "517de6ee-78bb-4ed6-b64b-37a8a6cede91");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    // the mock would create the segment in any directory, only the file system check prevents it
+    const HugePageMount_t directoryWithoutHugetlbfs{"/tmp"};
+    SUT sut{mepooConfig,
+            m_managementAllocator,
+            PosixGroup{"iox_roudi_test1"},
+            PosixGroup{"iox_roudi_test2"},
+            MemoryInfo(),
+            SHM_SEGMENT_DEFAULT_ZEROING_THREAD_COUNT,
+            HugePageSize::SIZE_2MB,
+            directoryWithoutHugetlbfs};
+
+    EXPECT_FALSE(sut.getSharedMemoryDirectory().has_value());
+    EXPECT_THAT(sut.getSegmentSize(), Eq(MemoryManager::requiredChunkMemorySize(mepooConfig)));
+}
+
+TEST_F(MePooSegment_test, DirectoryWhichIsNoHugetlbfsIsNoHugePageMount)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2aa9dcab-fded-48ca-9728-58063de75120");
+    const HugePageMount_t directoryWithoutHugetlbfs{"/tmp"};
+
+    EXPECT_FALSE(isHugePageMount(directoryWithoutHugetlbfs, HugePageSize::SIZE_2MB));
+    EXPECT_FALSE(isHugePageMount(directoryWithoutHugetlbfs, HugePageSize::SIZE_1GB));
+    EXPECT_FALSE(isHugePageMount(HugePageMount_t{"/not/existing/directory"}, HugePageSize::SIZE_2MB));
+}
+
+TEST_F(MePooSegment_test, SegmentIsCreatedWithConfiguredNumaPolicy)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "39d2c32b-c33e-450e-b56a-f00f67d83bce");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    constexpr uint64_t NUMA_NODE_MASK{0b10U};
+    SUT sut{mepooConfig,
+            m_managementAllocator,
+            PosixGroup{"iox_roudi_test1"},
+            PosixGroup{"iox_roudi_test2"},
+            MemoryInfo(),
+            SHM_SEGMENT_DEFAULT_ZEROING_THREAD_COUNT,
+            HugePageSize::NONE,
+            HugePageMount_t(),
+            NumaMemoryPolicy::BIND,
+            NUMA_NODE_MASK};
+
+    EXPECT_THAT(SharedMemoryObject_MOCKBuilder::createdNumaPolicy, Eq(NumaMemoryPolicy::BIND));
+    EXPECT_THAT(SharedMemoryObject_MOCKBuilder::createdNumaNodeMask, Eq(NUMA_NODE_MASK));
+}
+
+TEST_F(MePooSegment_test, SegmentIsCreatedLockedInMemoryWhenConfigured)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e140c2fb-4f33-45ba-a75b-2c214a9e3854");
+    GTEST_SKIP_FOR_ADDITIONAL_USER() << "This test requires the -DTEST_WITH_ADDITIONAL_USER=ON cmake argument";
+
+    SUT sut{mepooConfig,
+            m_managementAllocator,
+            PosixGroup{"iox_roudi_test1"},
+            PosixGroup{"iox_roudi_test2"},
+            MemoryInfo(),
+            SHM_SEGMENT_DEFAULT_ZEROING_THREAD_COUNT,
+            HugePageSize::NONE,
+            HugePageMount_t(),
+            NumaMemoryPolicy::DEFAULT,
+            0U,
+            true};
+
+    EXPECT_TRUE(SharedMemoryObject_MOCKBuilder::createdLockedInMemory);
+    EXPECT_TRUE(sut.isLockedInMemory());
+}
+
 } // namespace
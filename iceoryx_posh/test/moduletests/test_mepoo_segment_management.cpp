@@ -41,7 +41,13 @@ class MePooSegmentMock
                      iox::BumpAllocator& managementAllocator [[maybe_unused]],
                      const PosixGroup& readerGroup [[maybe_unused]],
                      const PosixGroup& writerGroup [[maybe_unused]],
-                     const MemoryInfo& memoryInfo [[maybe_unused]]) noexcept
+                     const MemoryInfo& memoryInfo [[maybe_unused]],
+                     const uint32_t zeroingThreadCount [[maybe_unused]],
+                     const HugePageSize hugePageSize [[maybe_unused]],
+                     const HugePageMount_t& hugePageMount [[maybe_unused]],
+                     const NumaMemoryPolicy numaPolicy [[maybe_unused]],
+                     const uint64_t numaNodeMask [[maybe_unused]],
+                     const bool lockInMemory [[maybe_unused]]) noexcept
     {
     }
 };
@@ -381,6 +381,28 @@ TEST_F(IpcMessage_test, AddEntryWithValidEntries)
     EXPECT_THAT(message2.getElementAtIndex(4), Eq("x"));
 }
 
+TEST_F(IpcMessage_test, AddEntryWithStringAndIntegerEntries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "63492e55-d2c1-4b3c-b200-7511c946ee32");
+    IpcMessage message;
+
+    message.addEntry(std::string("hypnotoad"));
+    message.addEntry(iox::string<16>("brain slug"));
+    message.addEntry(uint32_t{4711U});
+    message.addEntry(int64_t{-42});
+    message << std::string("") << uint64_t{0U};
+
+    EXPECT_THAT(message.isValid(), Eq(true));
+    EXPECT_THAT(message.getNumberOfElements(), Eq(6u));
+    EXPECT_THAT(message.getMessage(), Eq("hypnotoad,brain slug,4711,-42,,0,"));
+    EXPECT_THAT(message.getElementAtIndex(4), Eq(""));
+    EXPECT_THAT(message.getElementAtIndex(5), Eq("0"));
+
+    message.addEntry(iox::string<16>("nibbler,leela"));
+    EXPECT_THAT(message.isValid(), Eq(false));
+    EXPECT_THAT(message.getNumberOfElements(), Eq(6u));
+}
+
 TEST_F(IpcMessage_test, AddEntryWithInvalidEntries)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2e44a35a-f046-4c13-93d5-3ab5ae71931f");
@@ -401,6 +423,40 @@ TEST_F(IpcMessage_test, AddEntryWithInvalidEntries)
     EXPECT_THAT(message2.isValid(), Eq(false));
 }
 
+TEST_F(IpcMessage_test, AddEntriesAppendsAllEntriesOfTheOtherMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dbf372bc-ce0e-4017-8dcd-a007678313ce");
+    IpcMessage message({"fuu"});
+    IpcMessage other({"bar", "", "baz"});
+
+    message.addEntries(other);
+    EXPECT_THAT(message.isValid(), Eq(true));
+    EXPECT_THAT(message.getNumberOfElements(), Eq(4u));
+    EXPECT_THAT(message.getMessage(), Eq("fuu,bar,,baz,"));
+    EXPECT_THAT(message.getElementAtIndex(0), Eq("fuu"));
+    EXPECT_THAT(message.getElementAtIndex(1), Eq("bar"));
+    EXPECT_THAT(message.getElementAtIndex(2), Eq(""));
+    EXPECT_THAT(message.getElementAtIndex(3), Eq("baz"));
+    EXPECT_THAT(message.getElementAtIndex(4), Eq(""));
+
+    IpcMessage invalid({"a,b"});
+    message.addEntries(invalid);
+    EXPECT_THAT(message.isValid(), Eq(false));
+    EXPECT_THAT(message.getNumberOfElements(), Eq(4u));
+}
+
+TEST_F(IpcMessage_test, AddEntryWithInvalidCharArrayWithoutNullTerminationInvalidatesTheMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1cf0f33e-0d9c-4431-b956-d3159c624503");
+    IpcMessage message({"fuu"});
+    const char entry[3]{'a', ',', 'b'};
+
+    message << entry;
+    EXPECT_THAT(message.isValid(), Eq(false));
+    EXPECT_THAT(message.getNumberOfElements(), Eq(1u));
+    EXPECT_THAT(message.getElementAtIndex(0), Eq("fuu"));
+}
+
 TEST_F(IpcMessage_test, clearMessage)
 {
     ::testing::Test::RecordProperty("TEST_ID", "96b6d5a7-797d-4d9b-9334-290d2254dec4");
@@ -452,5 +508,105 @@ TEST_F(IpcMessage_test, setMessage)
     EXPECT_THAT(message1.isValid(), Eq(false));
 }
 
+TEST_F(IpcMessage_test, setMessageWithMovedStringTakesOverTheContent)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "490f9ec3-c73c-4a96-bca4-22c50fe2a8c2");
+    IpcMessage message({"fuu"});
+
+    std::string content{"asd1,asd2,"};
+    message.setMessage(std::move(content));
+    EXPECT_THAT(message.isValid(), Eq(true));
+    EXPECT_THAT(message.getNumberOfElements(), Eq(2u));
+    EXPECT_THAT(message.getElementAtIndex(0), Eq("asd1"));
+    EXPECT_THAT(message.getElementAtIndex(1), Eq("asd2"));
+    EXPECT_THAT(message.getElementAtIndex(2), Eq(""));
+
+    message.setMessage(std::string("asd1,asd2"));
+    EXPECT_THAT(message.isValid(), Eq(false));
+}
+
+TEST_F(IpcMessage_test, getElementAtIndexInArbitraryOrderAndAfterAddingEntries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f2a70344-e60b-4c27-8027-896fde35ebc1");
+    IpcMessage message("asd1,,asd3,");
+
+    EXPECT_THAT(message.getElementAtIndex(2), Eq("asd3"));
+    EXPECT_THAT(message.getElementAtIndex(0), Eq("asd1"));
+    EXPECT_THAT(message.getElementAtIndex(1), Eq(""));
+
+    message << "asd4";
+    EXPECT_THAT(message.getNumberOfElements(), Eq(4u));
+    EXPECT_THAT(message.getElementAtIndex(3), Eq("asd4"));
+    EXPECT_THAT(message.getElementAtIndex(2), Eq("asd3"));
+
+    message.setMessage("fuu,");
+    EXPECT_THAT(message.getElementAtIndex(0), Eq("fuu"));
+    EXPECT_THAT(message.getElementAtIndex(1), Eq(""));
+}
+
+TEST_F(IpcMessage_test, CursorReadsAllEntriesInAscendingOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "135e52eb-9377-4c17-805d-fea1b07d8169");
+    const IpcMessage message("asd1,,asd3,");
+    IpcMessage::Cursor cursor(message);
+
+    EXPECT_THAT(cursor.getNumberOfRemainingElements(), Eq(3u));
+    EXPECT_THAT(cursor.next(), Eq("asd1"));
+    EXPECT_THAT(cursor.next(), Eq(""));
+    EXPECT_THAT(cursor.getNumberOfRemainingElements(), Eq(1u));
+    EXPECT_THAT(cursor.next(), Eq("asd3"));
+    EXPECT_THAT(cursor.getNumberOfRemainingElements(), Eq(0u));
+    EXPECT_THAT(cursor.next(), Eq(""));
+    EXPECT_THAT(cursor.getNumberOfRemainingElements(), Eq(0u));
+}
+
+TEST_F(IpcMessage_test, CursorStartsAtIndexAndSkipsEntries)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d7cf724e-2eb0-415d-bec7-7d24b593728c");
+    const IpcMessage message("asd1,asd2,asd3,asd4,");
+    IpcMessage::Cursor cursor(message, 1U);
+
+    EXPECT_THAT(cursor.next(), Eq("asd2"));
+    cursor.skip(1U);
+    EXPECT_THAT(cursor.next(), Eq("asd4"));
+
+    IpcMessage::Cursor cursorBehindTheEnd(message, 5U);
+    EXPECT_THAT(cursorBehindTheEnd.getNumberOfRemainingElements(), Eq(0u));
+    EXPECT_THAT(cursorBehindTheEnd.next(), Eq(""));
+
+    IpcMessage::Cursor skippingCursor(message);
+    skippingCursor.skip(7U);
+    EXPECT_THAT(skippingCursor.getNumberOfRemainingElements(), Eq(0u));
+    EXPECT_THAT(skippingCursor.next(), Eq(""));
+}
+
+TEST_F(IpcMessage_test, CursorsOfTheSameMessageDoNotInfluenceEachOther)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bd41475d-9a6f-44b1-a851-7845495b483f");
+    const IpcMessage message("asd1,asd2,asd3,");
+    IpcMessage::Cursor first(message);
+    IpcMessage::Cursor second(message, 2U);
+
+    EXPECT_THAT(first.next(), Eq("asd1"));
+    EXPECT_THAT(second.next(), Eq("asd3"));
+    EXPECT_THAT(message.getElementAtIndex(1), Eq("asd2"));
+    EXPECT_THAT(first.next(), Eq("asd2"));
+    EXPECT_THAT(second.next(), Eq(""));
+    EXPECT_THAT(first.next(), Eq("asd3"));
+}
+
+TEST_F(IpcMessage_test, getMessageSizeReturnsTheLengthOfTheMessage)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9b8e2afe-b063-439e-8029-bc08e8c044e5");
+    IpcMessage message;
+    EXPECT_THAT(message.getMessageSize(), Eq(0u));
+
+    message << "fuu" << 4711;
+    EXPECT_THAT(message.getMessageSize(), Eq(message.getMessage().size()));
+
+    message.addEntries(IpcMessage({"bar", ""}));
+    EXPECT_THAT(message.getMessageSize(), Eq(std::string("fuu,4711,bar,,").size()));
+}
+
 } // namespace
 #endif
@@ -27,10 +27,13 @@
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_pusher.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/variant_queue.hpp"
+#include "iceoryx_posh/internal/runtime/heartbeat.hpp"
 #include "iceoryx_posh/mepoo/chunk_header.hpp"
 #include "test.hpp"
 
+#include <chrono>
 #include <memory>
+#include <thread>
 
 namespace
 {
@@ -485,6 +488,157 @@ TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWithMultipleQueuesMult
     EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverManyToAllStoredQueuesWithMultipleQueuesDeliversAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "53611067-47a0-4a77-89a3-504f4076cbbc");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 10U;
+    constexpr uint64_t NUMBER_OF_CHUNKS = 13U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    std::vector<SharedChunk> chunks;
+    for (auto i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        chunks.emplace_back(this->allocateChunk(i * 34));
+    }
+
+    auto numberOfDeliveries = sut.deliverToAllStoredQueues(iox::span<SharedChunk>(chunks.data(), chunks.size()));
+    EXPECT_THAT(numberOfDeliveries, Eq(NUMBER_OF_QUEUES * NUMBER_OF_CHUNKS));
+
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData[i].get());
+        for (auto k = 0U; k < NUMBER_OF_CHUNKS; ++k)
+        {
+            auto maybeSharedChunk = queue.tryPop();
+            ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+            EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(k * 34u));
+        }
+        EXPECT_FALSE(queue.hasLostChunks());
+    }
+    EXPECT_THAT(sut.getHistorySize(), Eq(NUMBER_OF_CHUNKS));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverManyToAllStoredQueuesWithMoreChunksThanCapacityLeadsToLostChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "94d3c84a-4d3c-4627-a18a-b357dc3fb2a6");
+    constexpr uint64_t QUEUE_CAPACITY{2U};
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(QUEUE_CAPACITY);
+
+    SharedChunk chunks[]{this->allocateChunk(1U), this->allocateChunk(2U), this->allocateChunk(3U)};
+    EXPECT_THAT(sut.deliverToAllStoredQueues(iox::span<SharedChunk>(chunks, 3U)), Eq(3U));
+
+    EXPECT_TRUE(queue.hasLostChunks());
+    for (uint32_t expectedValue : {2U, 3U})
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(expectedValue));
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverManyWithWaitForConsumerReturnsTheSumOfTheDeliveriesOfAllChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fab6f043-ed30-4a8d-a0f9-8d8faee11537");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    constexpr uint64_t NUMBER_OF_QUEUES = 2U;
+    std::vector<std::shared_ptr<typename TestFixture::ChunkQueueData_t>> queueData;
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        queueData.emplace_back(this->getChunkQueueData());
+        ASSERT_FALSE(sut.tryAddQueue(queueData.back().get()).has_error());
+    }
+
+    SharedChunk chunks[]{this->allocateChunk(1U), this->allocateChunk(2U), this->allocateChunk(3U)};
+    EXPECT_THAT(sut.deliverToAllStoredQueues(iox::span<SharedChunk>(chunks, 3U)), Eq(NUMBER_OF_QUEUES * 3U));
+
+    for (auto i = 0U; i < NUMBER_OF_QUEUES; ++i)
+    {
+        ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData[i].get());
+        for (uint32_t expectedValue : {1U, 2U, 3U})
+        {
+            auto maybeSharedChunk = queue.tryPop();
+            ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+            EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(expectedValue));
+        }
+    }
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesDoesNotDeliverToRemovedQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e03c7fb9-ecdb-44cb-96f3-d62f05eda66e");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    auto removedQueueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+    ASSERT_FALSE(sut.tryAddQueue(removedQueueData.get()).has_error());
+    ASSERT_FALSE(sut.tryRemoveQueue(removedQueueData.get()).has_error());
+
+    auto numberOfDeliveries = sut.deliverToAllStoredQueues(this->allocateChunk(7331U));
+    EXPECT_THAT(numberOfDeliveries, Eq(1U));
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> removedQueue(removedQueueData.get());
+    EXPECT_THAT(queue.size(), Eq(1U));
+    EXPECT_THAT(removedQueue.size(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesWhileQueuesAreAddedAndRemovedConcurrentlyReachesStoredQueue)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fd8feefa-e012-4d99-af16-308f77b9d3c8");
+    // without history the delivery does not need the lock at all
+    auto sutData = std::make_shared<typename TestFixture::ChunkDistributorData_t>(
+        ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0U);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    auto fluctuatingQueueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    constexpr uint64_t NUMBER_OF_CHUNKS = 100U;
+    std::atomic_bool isDeliveryFinished{false};
+    std::thread deliveryThread([&] {
+        for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+        {
+            sut.deliverToAllStoredQueues(this->allocateChunk(i));
+        }
+        isDeliveryFinished = true;
+    });
+
+    while (!isDeliveryFinished)
+    {
+        EXPECT_FALSE(sut.tryAddQueue(fluctuatingQueueData.get()).has_error());
+        EXPECT_FALSE(sut.tryRemoveQueue(fluctuatingQueueData.get()).has_error());
+    }
+    deliveryThread.join();
+
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_THAT(queue.size(), Eq(NUMBER_OF_CHUNKS));
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+}
+
 TYPED_TEST(ChunkDistributor_test, AddToHistoryWithoutQueues)
 {
     ::testing::Test::RecordProperty("TEST_ID", "1ed709b1-9129-454b-8440-50463ba1c02e");
@@ -666,6 +820,54 @@ TYPED_TEST(ChunkDistributor_test, DeliverHistoryOnAddWithLessThanAvailable)
     EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(3u));
 }
 
+TYPED_TEST(ChunkDistributor_test, HistoryReleasesOldestChunksWhenCapacityIsExceeded)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6faeb776-b8f7-4e4c-bcdf-4af94d0d8e79");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    const uint64_t NUMBER_OF_CHUNKS = this->HISTORY_SIZE + 5U;
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        sut.deliverToAllStoredQueues(this->allocateChunk(i));
+    }
+
+    EXPECT_THAT(sut.getHistorySize(), Eq(this->HISTORY_SIZE));
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(this->HISTORY_SIZE));
+
+    sut.clearHistory();
+
+    EXPECT_THAT(sut.getHistorySize(), Eq(0U));
+    EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverHistoryOnAddAfterHistoryWrappedAroundDeliversNewestChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e812e3ea-c561-42e9-821a-21fe10e93389");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    const uint64_t NUMBER_OF_CHUNKS = this->HISTORY_SIZE + 5U;
+    for (uint64_t i = 0U; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        sut.deliverToAllStoredQueues(this->allocateChunk(i));
+    }
+
+    // the requested history starts before and ends after the wrap around of the ring buffer
+    constexpr uint64_t REQUESTED_HISTORY{10U};
+    auto queueData = this->getChunkQueueData();
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), REQUESTED_HISTORY).has_error());
+
+    ASSERT_THAT(queue.size(), Eq(REQUESTED_HISTORY));
+    for (uint64_t i = NUMBER_OF_CHUNKS - REQUESTED_HISTORY; i < NUMBER_OF_CHUNKS; ++i)
+    {
+        auto maybeSharedChunk = queue.tryPop();
+        ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+        EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(i));
+    }
+}
+
 TYPED_TEST(ChunkDistributor_test, DeliverHistoryOnAddWithExactAvailable)
 {
     ::testing::Test::RecordProperty("TEST_ID", "884f4041-f63d-47b7-a6d3-0a84360a3862");
@@ -763,6 +965,59 @@ TYPED_TEST(ChunkDistributor_test, DeliverToSingleQueueBlocksWhenOptionsAreSetToB
     EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(152U));
 }
 
+TYPED_TEST(ChunkDistributor_test, DeliverToAllStoredQueuesLosesChunkWhenConsumerTooSlowTimeoutExpires)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a5f2760f-a97b-4d00-8670-d3cc6ae104b8");
+    constexpr iox::units::Duration CONSUMER_TOO_SLOW_TIMEOUT{50_ms};
+    auto sutData = std::make_shared<typename TestFixture::ChunkDistributorData_t>(
+        ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER, this->HISTORY_SIZE, CONSUMER_TOO_SLOW_TIMEOUT);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(155U));
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(152U)), Eq(1U));
+    EXPECT_THAT(std::chrono::steady_clock::now() - start,
+                Ge(std::chrono::nanoseconds(CONSUMER_TOO_SLOW_TIMEOUT.toNanoseconds())));
+
+    EXPECT_TRUE(queue.hasLostChunks());
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(155U));
+    EXPECT_FALSE(queue.tryPop().has_value());
+}
+
+TYPED_TEST(ChunkDistributor_test, DeliverToQueueLosesChunkWhenConsumerTooSlowTimeoutExpires)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f2274bf9-1762-4fb0-974a-112ec5249f2c");
+    constexpr uint32_t UNKNOWN_QUEUE_INDEX{std::numeric_limits<uint32_t>::max()};
+    constexpr iox::units::Duration CONSUMER_TOO_SLOW_TIMEOUT{50_ms};
+    auto sutData = std::make_shared<typename TestFixture::ChunkDistributorData_t>(
+        ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER, this->HISTORY_SIZE, CONSUMER_TOO_SLOW_TIMEOUT);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    ASSERT_FALSE(sut.deliverToQueue(queueData->m_uniqueId, UNKNOWN_QUEUE_INDEX, this->allocateChunk(155U)).has_error());
+    ASSERT_FALSE(sut.deliverToQueue(queueData->m_uniqueId, UNKNOWN_QUEUE_INDEX, this->allocateChunk(152U)).has_error());
+
+    EXPECT_TRUE(queue.hasLostChunks());
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(155U));
+    EXPECT_FALSE(queue.tryPop().has_value());
+}
+
 TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBecomesSpaceAvailable)
 {
     ::testing::Test::RecordProperty("TEST_ID", "8168749d-8472-4999-83b0-5b36a77b04ed");
@@ -822,4 +1077,135 @@ TYPED_TEST(ChunkDistributor_test, MultipleBlockingQueuesWillBeFilledWhenThereBec
     }
 }
 
+TYPED_TEST(ChunkDistributor_test, RemovingQueueWhileDeliveryIsBlockedOnItUnblocksTheDelivery)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f5436fd1-8bda-4b25-8f36-504c59868716");
+    auto sutData = this->getChunkDistributorData(ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER);
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData =
+        this->getChunkQueueData(QueueFullPolicy::BLOCK_PRODUCER, VariantQueueTypes::FiFo_MultiProducerSingleConsumer);
+    ChunkQueuePopper<typename TestFixture::ChunkQueueData_t> queue(queueData.get());
+    queue.setCapacity(1U);
+
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get(), 0U).has_error());
+    sut.deliverToAllStoredQueues(this->allocateChunk(73U));
+
+    Barrier isThreadStarted(1U);
+    std::atomic_bool wasChunkDelivered{false};
+    std::thread t1([&] {
+        isThreadStarted.notify();
+        sut.deliverToAllStoredQueues(this->allocateChunk(37U));
+        wasChunkDelivered = true;
+    });
+
+    isThreadStarted.wait();
+
+    std::this_thread::sleep_for(this->BLOCKING_DURATION);
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(false));
+
+    // the blocked delivery holds the queue snapshot; the removal must wake it up and wait until the removed queue is
+    // not accessed anymore
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+
+    t1.join(); // join needs to be before the load to ensure the wasChunkDelivered store happens before the read
+    EXPECT_THAT(wasChunkDelivered.load(), Eq(true));
+    EXPECT_FALSE(sut.hasStoredQueues());
+
+    auto maybeSharedChunk = queue.tryPop();
+    ASSERT_THAT(maybeSharedChunk.has_value(), Eq(true));
+    EXPECT_THAT(this->getSharedChunkValue(*maybeSharedChunk), Eq(73U));
+    EXPECT_FALSE(queue.tryPop().has_value());
+}
+
+TYPED_TEST(ChunkDistributor_test, QueueSnapshotOfReaderWithExpiredHeartbeatIsReclaimed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "39afec33-4a7d-4343-9711-4cec2e2bc588");
+    // the snapshot is only reclaimed after the heartbeat expired, which takes longer than the deadlock timeout
+    this->deadlockWatchdog.reset();
+    Watchdog reclaimWatchdog{iox::runtime::PROCESS_KEEP_ALIVE_TIMEOUT + iox::QUEUE_SNAPSHOT_RELEASE_TIMEOUT
+                             + TestFixture::DEADLOCK_TIMEOUT};
+    reclaimWatchdog.watchAndActOnFailure([] { std::terminate(); });
+
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    iox::runtime::Heartbeat heartbeat;
+    sutData->m_queueSnapshotReaderHeartbeat = &heartbeat;
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    // a delivering process which terminated during a delivery never releases the snapshot it acquired
+    const auto snapshotIndex = sutData->m_activeQueueSnapshot.load();
+    sutData->m_queueSnapshotReaders[snapshotIndex].fetch_add(1U);
+
+    const auto keepAliveTimeout = iox::runtime::PROCESS_KEEP_ALIVE_TIMEOUT.toMilliseconds();
+    while (heartbeat.elapsed_milliseconds_since_last_beat() <= keepAliveTimeout)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    EXPECT_THAT(sutData->m_queueSnapshotReaders[snapshotIndex].load(), Eq(0U));
+    EXPECT_FALSE(sut.hasStoredQueues());
+}
+
+TYPED_TEST(ChunkDistributor_test, QueueSnapshotOfRemovedReaderIsReclaimed)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "afef7f4d-c515-47ee-a68f-fe205e06663f");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    // RouDi removes the port of a process which does not deliver anymore, e.g. an unmonitored one which terminated
+    // during a delivery
+    const auto snapshotIndex = sutData->m_activeQueueSnapshot.load();
+    sutData->m_queueSnapshotReaders[snapshotIndex].fetch_add(1U);
+    sutData->m_isQueueSnapshotReaderRemoved.store(true);
+
+    EXPECT_FALSE(sut.tryRemoveQueue(queueData.get()).has_error());
+    EXPECT_THAT(sutData->m_queueSnapshotReaders[snapshotIndex].load(), Eq(0U));
+    EXPECT_FALSE(sut.hasStoredQueues());
+}
+
+TYPED_TEST(ChunkDistributor_test, RemovingQueueFromSnapshotOfLiveReaderFailsUntilTheSnapshotIsReleased)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9f05e13f-d13e-4acf-b8a7-089d251d292b");
+    auto sutData = this->getChunkDistributorData();
+    typename TestFixture::ChunkDistributor_t sut(sutData.get());
+    ASSERT_THAT(sutData->m_queueSnapshotReaderHeartbeat.get(), Eq(nullptr));
+
+    auto queueData = this->getChunkQueueData();
+    ASSERT_FALSE(sut.tryAddQueue(queueData.get()).has_error());
+
+    // without a heartbeat, e.g. for a port of an unmonitored process, a stalled delivery cannot be distinguished
+    // from a terminated one and the snapshot must not be reclaimed
+    const auto snapshotIndex = sutData->m_activeQueueSnapshot.load();
+    sutData->m_queueSnapshotReaders[snapshotIndex].fetch_add(1U);
+
+    auto removeResult = sut.tryRemoveQueue(queueData.get());
+    ASSERT_TRUE(removeResult.has_error());
+    EXPECT_THAT(removeResult.error(), Eq(ChunkDistributorError::QUEUE_SNAPSHOT_IN_USE));
+    EXPECT_THAT(sutData->m_queueSnapshotReaders[snapshotIndex].load(), Eq(1U));
+    EXPECT_FALSE(sut.hasStoredQueues());
+
+    // the snapshot which is still in use would have to be replaced to add another queue
+    auto otherQueueData = this->getChunkQueueData();
+    auto addResult = sut.tryAddQueue(otherQueueData.get());
+    ASSERT_TRUE(addResult.has_error());
+    EXPECT_THAT(addResult.error(), Eq(ChunkDistributorError::QUEUE_SNAPSHOT_IN_USE));
+    EXPECT_THAT(sutData->m_queueSnapshotReaders[snapshotIndex].load(), Eq(1U));
+
+    sutData->m_queueSnapshotReaders[snapshotIndex].fetch_sub(1U);
+
+    // the retried removal reports that the queue is neither stored nor accessed anymore
+    removeResult = sut.tryRemoveQueue(queueData.get());
+    ASSERT_TRUE(removeResult.has_error());
+    EXPECT_THAT(removeResult.error(), Eq(ChunkDistributorError::QUEUE_NOT_IN_CONTAINER));
+    EXPECT_FALSE(sut.tryAddQueue(otherQueueData.get()).has_error());
+    EXPECT_THAT(sut.deliverToAllStoredQueues(this->allocateChunk(42U)), Eq(1U));
+}
+
 } // namespace
@@ -28,6 +28,10 @@
 
 #include "test.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+
 namespace
 {
 using namespace ::testing;
@@ -328,6 +332,106 @@ TYPED_TEST(ChunkQueueFiFo_test, PushFull)
     EXPECT_THAT(this->mempool.getUsedChunks(), Eq(0U));
 }
 
+TYPED_TEST(ChunkQueueFiFo_test, WaitForSpaceReturnsImmediatelyWhenQueueIsNotFull)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3b8a5c4e-7f0d-4d93-9a61-2c4e8f1b7d35");
+    using ChunkQueueData_t = typename TestFixture::ChunkQueueData_t;
+    ChunkQueueData_t chunkData{QueueFullPolicy::BLOCK_PRODUCER,
+                               iox::popo::VariantQueueTypes::FiFo_SingleProducerSingleConsumer};
+    ChunkQueuePusher<ChunkQueueData_t> pusher{&chunkData};
+
+    const auto start = std::chrono::steady_clock::now();
+    pusher.waitForSpace(iox::units::Duration::fromSeconds(10U));
+
+    EXPECT_THAT(std::chrono::steady_clock::now() - start, Lt(std::chrono::seconds(1)));
+    EXPECT_THAT(chunkData.m_numberOfProducersWaitingForSpace.load(), Eq(0U));
+}
+
+TYPED_TEST(ChunkQueueFiFo_test, WaitForSpaceOnFullQueueIsWokenUpWhenChunkIsPopped)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a9d0e6b2-41c7-4f58-8e23-6b5f0c9d1a47");
+    using ChunkQueueData_t = typename TestFixture::ChunkQueueData_t;
+    ChunkQueueData_t chunkData{QueueFullPolicy::BLOCK_PRODUCER,
+                               iox::popo::VariantQueueTypes::FiFo_SingleProducerSingleConsumer};
+    ChunkQueuePusher<ChunkQueueData_t> pusher{&chunkData};
+    ChunkQueuePopper<ChunkQueueData_t> popper{&chunkData};
+
+    for (auto i = 0U; i < iox::MAX_SUBSCRIBER_QUEUE_CAPACITY; ++i)
+    {
+        EXPECT_TRUE(pusher.push(this->allocateChunk()));
+    }
+
+    std::atomic_bool hasSpace{false};
+    std::thread producer([&] {
+        pusher.waitForSpace(iox::units::Duration::fromSeconds(10U));
+        hasSpace = true;
+    });
+
+    while (chunkData.m_numberOfProducersWaitingForSpace.load() == 0U)
+    {
+        std::this_thread::yield();
+    }
+    EXPECT_FALSE(hasSpace.load());
+
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_TRUE(popper.tryPop().has_value());
+    producer.join();
+
+    EXPECT_TRUE(hasSpace.load());
+    EXPECT_THAT(std::chrono::steady_clock::now() - start, Lt(std::chrono::seconds(1)));
+    popper.clear();
+}
+
+TYPED_TEST(ChunkQueueFiFo_test, WaitForSpaceOnFullQueueWakesUpEveryWaitingProducerWithOnePop)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5e1f7c2a-93b4-4d06-b8a1-7c3e2f9d4b60");
+    using ChunkQueueData_t = typename TestFixture::ChunkQueueData_t;
+    ChunkQueueData_t chunkData{QueueFullPolicy::BLOCK_PRODUCER,
+                               iox::popo::VariantQueueTypes::FiFo_MultiProducerSingleConsumer};
+    ChunkQueuePusher<ChunkQueueData_t> pusher{&chunkData};
+    ChunkQueuePopper<ChunkQueueData_t> popper{&chunkData};
+
+    for (auto i = 0U; i < iox::MAX_SUBSCRIBER_QUEUE_CAPACITY; ++i)
+    {
+        EXPECT_TRUE(pusher.push(this->allocateChunk()));
+    }
+
+    // every producer pushes after its wait; a post which is consumed by the wrong producer would delay the other one
+    // until the timeout
+    constexpr uint64_t NUMBER_OF_PRODUCERS{2U};
+    std::atomic<uint64_t> numberOfPushedChunks{0U};
+    auto produce = [&] {
+        auto chunk = this->allocateChunk();
+        while (!pusher.push(chunk))
+        {
+            pusher.waitForSpace(iox::units::Duration::fromSeconds(10U));
+        }
+        ++numberOfPushedChunks;
+    };
+    std::thread producer1(produce);
+    std::thread producer2(produce);
+
+    while (chunkData.m_numberOfProducersWaitingForSpace.load() != NUMBER_OF_PRODUCERS)
+    {
+        std::this_thread::yield();
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (auto i = 0U; i < NUMBER_OF_PRODUCERS; ++i)
+    {
+        EXPECT_TRUE(popper.tryPop().has_value());
+        while (numberOfPushedChunks.load() != i + 1U)
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer1.join();
+    producer2.join();
+
+    EXPECT_THAT(std::chrono::steady_clock::now() - start, Lt(std::chrono::seconds(1)));
+    popper.clear();
+}
+
 /// @note this could be changed to a parameterized ChunkQueueOverflowingFIFO_test when there are more FIFOs available
 using ChunkQueueSoFiSubjects = Types<ThreadSafePolicy, SingleThreadedPolicy>;
 
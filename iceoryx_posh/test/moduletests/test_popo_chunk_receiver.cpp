@@ -184,6 +184,66 @@ TEST_F(ChunkReceiver_test, getTooMuchWithoutRelease)
     EXPECT_THAT(maybeChunkHeader.error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
 }
 
+TEST_F(ChunkReceiver_test, getManyFromEmptyQueueReturnsNoChunkAvailable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d209dd30-f74b-4e46-a1cc-1ee729605bf0");
+    const iox::mepoo::ChunkHeader* chunkHeaders[4U];
+    auto result = m_chunkReceiver.tryGetMany(iox::span<const iox::mepoo::ChunkHeader*>(chunkHeaders, 4U));
+    ASSERT_TRUE(result.has_error());
+    EXPECT_EQ(result.error(), iox::popo::ChunkReceiveResult::NO_CHUNK_AVAILABLE);
+}
+
+TEST_F(ChunkReceiver_test, getManyReceivesTheQueuedChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "33dc295f-335e-434e-98d6-4f08e421df16");
+    constexpr uint64_t NUMBER_OF_QUEUED_CHUNKS{5U};
+    constexpr uint64_t NUMBER_OF_REQUESTED_CHUNKS{3U};
+    for (uint64_t i = 0U; i < NUMBER_OF_QUEUED_CHUNKS; ++i)
+    {
+        auto sharedChunk = getChunkFromMemoryManager();
+        new (sharedChunk.getUserPayload()) DummySample{i};
+        m_chunkQueuePusher.push(sharedChunk);
+    }
+
+    const iox::mepoo::ChunkHeader* chunkHeaders[NUMBER_OF_REQUESTED_CHUNKS];
+    auto result = m_chunkReceiver.tryGetMany(
+        iox::span<const iox::mepoo::ChunkHeader*>(chunkHeaders, NUMBER_OF_REQUESTED_CHUNKS));
+    ASSERT_FALSE(result.has_error());
+    ASSERT_THAT(result.value(), Eq(NUMBER_OF_REQUESTED_CHUNKS));
+    for (uint64_t i = 0U; i < NUMBER_OF_REQUESTED_CHUNKS; ++i)
+    {
+        EXPECT_THAT(static_cast<const DummySample*>(chunkHeaders[i]->userPayload())->dummy, Eq(i));
+        m_chunkReceiver.release(chunkHeaders[i]);
+    }
+
+    result = m_chunkReceiver.tryGetMany(
+        iox::span<const iox::mepoo::ChunkHeader*>(chunkHeaders, NUMBER_OF_REQUESTED_CHUNKS));
+    ASSERT_FALSE(result.has_error());
+    ASSERT_THAT(result.value(), Eq(NUMBER_OF_QUEUED_CHUNKS - NUMBER_OF_REQUESTED_CHUNKS));
+    EXPECT_THAT(static_cast<const DummySample*>(chunkHeaders[0U]->userPayload())->dummy,
+                Eq(NUMBER_OF_REQUESTED_CHUNKS));
+}
+
+TEST_F(ChunkReceiver_test, getManyWithTooManyChunksHeldReturnsErrorAndKeepsTheQueuedChunk)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dc40200e-57e1-4772-98bd-e4dc326d3ac2");
+    for (size_t i = 0; i < iox::MAX_CHUNKS_HELD_PER_SUBSCRIBER_SIMULTANEOUSLY + 1; i++)
+    {
+        m_chunkQueuePusher.push(getChunkFromMemoryManager());
+        ASSERT_FALSE(m_chunkReceiver.tryGet().has_error());
+    }
+    auto sharedChunk = getChunkFromMemoryManager();
+    m_chunkQueuePusher.push(sharedChunk);
+
+    const iox::mepoo::ChunkHeader* chunkHeaders[2U];
+    auto result = m_chunkReceiver.tryGetMany(iox::span<const iox::mepoo::ChunkHeader*>(chunkHeaders, 2U));
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(iox::popo::ChunkReceiveResult::TOO_MANY_CHUNKS_HELD_IN_PARALLEL));
+
+    iox::popo::ChunkQueuePopper<ChunkReceiverData_t> queue(&m_chunkReceiverData);
+    EXPECT_FALSE(queue.empty());
+}
+
 TEST_F(ChunkReceiver_test, releaseInvalidChunk)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2a47fd0e-a217-4565-98af-05779c938340");
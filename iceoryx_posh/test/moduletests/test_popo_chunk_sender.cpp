@@ -32,6 +32,7 @@
 #include "iceoryx_posh/testing/mocks/chunk_mock.hpp"
 #include "iox/bump_allocator.hpp"
 #include "iox/scope_guard.hpp"
+#include "iox/span.hpp"
 #include "test.hpp"
 
 #include <memory>
@@ -75,6 +76,7 @@ class ChunkSender_test : public Test
     static constexpr uint32_t SMALL_CHUNK = 128;
     static constexpr uint32_t BIG_CHUNK = 256;
     static constexpr uint64_t HISTORY_CAPACITY = 4;
+    static constexpr uint32_t CHUNK_MAGAZINE_CAPACITY = 4;
     static constexpr uint32_t MAX_NUMBER_QUEUES = 128;
 
     static constexpr uint32_t USER_PAYLOAD_ALIGNMENT = iox::CHUNK_DEFAULT_USER_PAYLOAD_ALIGNMENT;
@@ -110,9 +112,15 @@ class ChunkSender_test : public Test
         &m_memoryManager, iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, 0}; // must be 0 for test
     ChunkSenderData_t m_chunkSenderDataWithHistory{
         &m_memoryManager, iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA, HISTORY_CAPACITY};
+    ChunkSenderData_t m_chunkSenderDataWithChunkMagazine{&m_memoryManager,
+                                                         iox::popo::ConsumerTooSlowPolicy::DISCARD_OLDEST_DATA,
+                                                         0U,
+                                                         iox::mepoo::MemoryInfo(),
+                                                         CHUNK_MAGAZINE_CAPACITY};
 
     iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSender{&m_chunkSenderData};
     iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSenderWithHistory{&m_chunkSenderDataWithHistory};
+    iox::popo::ChunkSender<ChunkSenderData_t> m_chunkSenderWithChunkMagazine{&m_chunkSenderDataWithChunkMagazine};
 };
 
 TEST_F(ChunkSender_test, allocate_OneChunkWithoutUserHeaderAndSmallUserPayloadAlignmentResultsInSmallChunk)
@@ -394,6 +402,71 @@ TEST_F(ChunkSender_test, sendMultipleWithReceiver)
     }
 }
 
+TEST_F(ChunkSender_test, sendManyWithReceiverDeliversAllChunksInOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "40b598c5-160f-4530-81f5-3f7e6217453e");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    constexpr uint32_t NUMBER_OF_CHUNKS{iox::MAX_CHUNKS_ALLOCATED_PER_PUBLISHER_SIMULTANEOUSLY};
+    iox::mepoo::ChunkHeader* chunkHeaders[NUMBER_OF_CHUNKS];
+    for (uint32_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        auto maybeChunkHeader = m_chunkSender.tryAllocate(
+            UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        ASSERT_FALSE(maybeChunkHeader.has_error());
+        chunkHeaders[i] = *maybeChunkHeader;
+        new (chunkHeaders[i]->userPayload()) DummySample{i};
+    }
+
+    auto numberOfDeliveries =
+        m_chunkSender.sendMany(iox::span<iox::mepoo::ChunkHeader* const>(chunkHeaders, NUMBER_OF_CHUNKS));
+    EXPECT_THAT(numberOfDeliveries, Eq(NUMBER_OF_CHUNKS));
+
+    auto lastChunk = m_chunkSender.tryGetPreviousChunk();
+    ASSERT_TRUE(lastChunk.has_value());
+    EXPECT_THAT(*lastChunk, Eq(chunkHeaders[NUMBER_OF_CHUNKS - 1U]));
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    for (uint32_t i = 0; i < NUMBER_OF_CHUNKS; i++)
+    {
+        auto popRet = myQueue.tryPop();
+        ASSERT_TRUE(popRet.has_value());
+        EXPECT_THAT(reinterpret_cast<DummySample*>(popRet->getUserPayload())->dummy, Eq(i));
+        EXPECT_THAT(popRet->getChunkHeader()->sequenceNumber(), Eq(i));
+    }
+    EXPECT_TRUE(myQueue.empty());
+}
+
+TEST_F(ChunkSender_test, sendManyWithInvalidChunkTriggersTheErrorHandlerAndSendsTheValidChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "dd372d7e-fe90-4454-a535-6230566ff3eb");
+    ASSERT_FALSE(m_chunkSender.tryAddQueue(&m_chunkQueueData).has_error());
+
+    auto maybeChunkHeader = m_chunkSender.tryAllocate(
+        UniquePortId(), sizeof(DummySample), alignof(DummySample), USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    ChunkMock<bool> myCrazyChunk;
+    iox::mepoo::ChunkHeader* chunkHeaders[]{myCrazyChunk.chunkHeader(), *maybeChunkHeader};
+
+    iox::optional<iox::PoshError> detectedError;
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&](const iox::PoshError error, const iox::ErrorLevel errorLevel) {
+            detectedError.emplace(error);
+            EXPECT_EQ(errorLevel, iox::ErrorLevel::SEVERE);
+        });
+
+    auto numberOfDeliveries = m_chunkSender.sendMany(iox::span<iox::mepoo::ChunkHeader* const>(chunkHeaders, 2U));
+    EXPECT_THAT(numberOfDeliveries, Eq(1U));
+    ASSERT_TRUE(detectedError.has_value());
+    EXPECT_EQ(detectedError.value(), iox::PoshError::POPO__CHUNK_SENDER_INVALID_CHUNK_TO_SEND_FROM_USER);
+
+    iox::popo::ChunkQueuePopper<ChunkQueueData_t> myQueue(&m_chunkQueueData);
+    auto popRet = myQueue.tryPop();
+    ASSERT_TRUE(popRet.has_value());
+    EXPECT_THAT(popRet->getChunkHeader(), Eq(*maybeChunkHeader));
+    EXPECT_TRUE(myQueue.empty());
+}
+
 TEST_F(ChunkSender_test, sendTillRunningOutOfChunks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b951495a-e216-43ff-96a0-a530b7a6455b");
@@ -725,6 +798,60 @@ TEST_F(ChunkSender_test, Cleanup)
     EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
 }
 
+TEST_F(ChunkSender_test, AllocateWithChunkMagazineReservesChunksFromBestFittingMemPool)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "af8e088d-a43a-448d-826a-6217e246588f");
+    UniquePortId uniqueId;
+    auto maybeChunkHeader = m_chunkSenderWithChunkMagazine.tryAllocate(
+        uniqueId, SMALL_CHUNK / 2, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT((*maybeChunkHeader)->originId(), Eq(uniqueId));
+    EXPECT_THAT((*maybeChunkHeader)->userPayloadSize(), Eq(SMALL_CHUNK / 2));
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_MAGAZINE_CAPACITY));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(0U));
+    EXPECT_THAT(m_chunkSenderDataWithChunkMagazine.m_chunkMagazineSize, Eq(CHUNK_MAGAZINE_CAPACITY - 1U));
+
+    for (uint32_t i = 1U; i < CHUNK_MAGAZINE_CAPACITY; ++i)
+    {
+        auto maybeNextChunkHeader = m_chunkSenderWithChunkMagazine.tryAllocate(
+            uniqueId, SMALL_CHUNK / 2, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+        EXPECT_FALSE(maybeNextChunkHeader.has_error());
+    }
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_MAGAZINE_CAPACITY));
+    EXPECT_THAT(m_chunkSenderDataWithChunkMagazine.m_chunkMagazineSize, Eq(0U));
+}
+
+TEST_F(ChunkSender_test, AllocateWithChunkMagazineForOtherMemPoolReturnsReservedChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e9806b0e-4f25-4909-ad6d-cb3d62c44c03");
+    auto maybeSmallChunkHeader = m_chunkSenderWithChunkMagazine.tryAllocate(
+        UniquePortId(), SMALL_CHUNK / 2, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeSmallChunkHeader.has_error());
+
+    auto maybeBigChunkHeader = m_chunkSenderWithChunkMagazine.tryAllocate(
+        UniquePortId(), BIG_CHUNK, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeBigChunkHeader.has_error());
+    EXPECT_THAT((*maybeBigChunkHeader)->chunkSize(), Eq(m_memoryManager.getMemPoolInfo(1).m_chunkSize));
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(1U));
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(1).m_usedChunks, Eq(CHUNK_MAGAZINE_CAPACITY));
+}
+
+TEST_F(ChunkSender_test, ReleaseAllReturnsChunksOfChunkMagazine)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "14b00c3f-94ac-4dcb-a632-254ea2c32f18");
+    auto maybeChunkHeader = m_chunkSenderWithChunkMagazine.tryAllocate(
+        UniquePortId(), SMALL_CHUNK / 2, USER_PAYLOAD_ALIGNMENT, USER_HEADER_SIZE, USER_HEADER_ALIGNMENT);
+    ASSERT_FALSE(maybeChunkHeader.has_error());
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(CHUNK_MAGAZINE_CAPACITY));
+
+    m_chunkSenderWithChunkMagazine.releaseAll();
+
+    EXPECT_THAT(m_memoryManager.getMemPoolInfo(0).m_usedChunks, Eq(0U));
+    EXPECT_THAT(m_chunkSenderDataWithChunkMagazine.m_chunkMagazineSize, Eq(0U));
+}
+
 TEST_F(ChunkSender_test, asStringLiteralConvertsAllocationErrorValuesToStrings)
 {
     ::testing::Test::RecordProperty("TEST_ID", "fdb713e1-0e2c-411e-a3ee-02c216d510d0");
@@ -24,10 +24,12 @@
 #include "iox/algorithm.hpp"
 #include "test.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <memory>
 #include <thread>
 #include <type_traits>
+#include <vector>
 
 namespace
 {
@@ -92,6 +94,98 @@ TEST_F(ConditionVariable_test, NoNotifyResultsInNotBeingTriggered)
     EXPECT_FALSE(m_waiter.wasNotified());
 }
 
+TEST_F(ConditionVariable_test, NotifyWithoutSleepingListenerDoesNotPostTheSemaphore)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5aa4f509-5ea0-41e4-a17b-0c62ff2f7514");
+    m_signaler.notify();
+
+    EXPECT_TRUE(m_waiter.wasNotified());
+    auto result = m_condVarData.m_semaphore->tryWait();
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(result.value());
+}
+
+TEST_F(ConditionVariable_test, NotifyWithSleepingListenerWakesUpTheListener)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b5424620-b6b5-4410-8015-dec0a041b45e");
+    std::atomic_bool hasWokenUp{false};
+    std::thread waiter([&] {
+        auto activeNotifications = m_waiter.wait();
+        EXPECT_THAT(activeNotifications.size(), Eq(1U));
+        hasWokenUp.store(true);
+    });
+
+    while (m_condVarData.m_numberOfSleepingListeners.load() == 0U)
+    {
+        std::this_thread::yield();
+    }
+    EXPECT_FALSE(hasWokenUp.load());
+    m_signaler.notify();
+    waiter.join();
+
+    EXPECT_TRUE(hasWokenUp.load());
+    EXPECT_THAT(m_condVarData.m_numberOfSleepingListeners.load(), Eq(0U));
+}
+
+TEST_F(ConditionVariable_test, SpinningListenerIsWokenUpWithoutSleeping)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "f1259e12-34a2-4676-a0e3-b4cc7705cb18");
+    WaitStrategy waitStrategy;
+    waitStrategy.maxSpinDuration = 1_s;
+    ConditionListener sut(m_condVarData, waitStrategy);
+
+    std::atomic_bool hasWokenUp{false};
+    std::thread waiter([&] {
+        auto activeNotifications = sut.wait();
+        EXPECT_THAT(activeNotifications.size(), Eq(1U));
+        hasWokenUp.store(true);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_THAT(m_condVarData.m_numberOfSleepingListeners.load(), Eq(0U));
+    m_signaler.notify();
+    waiter.join();
+
+    EXPECT_TRUE(hasWokenUp.load());
+    auto result = m_condVarData.m_semaphore->tryWait();
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(result.value());
+}
+
+TEST_F(ConditionVariable_test, SpinningListenerBlocksAfterSpinIterationsAreExhausted)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9e71113c-adce-4ef3-b0ad-739978c2470b");
+    WaitStrategy waitStrategy;
+    waitStrategy.maxSpinIterations = 100U;
+    waitStrategy.spinHint = SpinHint::YIELD;
+    ConditionListener sut(m_condVarData, waitStrategy);
+
+    std::thread waiter([&] {
+        auto activeNotifications = sut.wait();
+        EXPECT_THAT(activeNotifications.size(), Eq(1U));
+    });
+
+    while (m_condVarData.m_numberOfSleepingListeners.load() == 0U)
+    {
+        std::this_thread::yield();
+    }
+    m_signaler.notify();
+    waiter.join();
+
+    EXPECT_THAT(m_condVarData.m_numberOfSleepingListeners.load(), Eq(0U));
+}
+
+TEST_F(ConditionVariable_test, SpinningTimedWaitWithoutNotificationReturnsEmptyVector)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "2dcabd1f-17db-4a2b-ab84-9c778e02cf25");
+    WaitStrategy waitStrategy;
+    waitStrategy.maxSpinDuration = 1_s;
+    waitStrategy.spinHint = SpinHint::NONE;
+    ConditionListener sut(m_condVarData, waitStrategy);
+
+    EXPECT_TRUE(sut.timedWait(10_ms).empty());
+}
+
 TEST_F(ConditionVariable_test, WaitResetsAllNotificationsInWait)
 {
     ::testing::Test::RecordProperty("TEST_ID", "ebc9c42a-14e7-471c-a9df-9c5641b5767d");
@@ -135,9 +229,9 @@ TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstruction)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4e5f6dbc-84cc-468a-9d64-f5ed88012ebc");
     ConditionVariableData sut;
-    for (auto& notification : sut.m_activeNotifications)
+    for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; ++i)
     {
-        EXPECT_THAT(notification, Eq(false));
+        EXPECT_THAT(sut.isNotificationActive(i), Eq(false));
     }
 }
 
@@ -150,9 +244,9 @@ TEST_F(ConditionVariable_test, CorrectRuntimeNameAfterConstructionWithRuntimeNam
 TEST_F(ConditionVariable_test, AllNotificationsAreFalseAfterConstructionWithRuntimeName)
 {
     ::testing::Test::RecordProperty("TEST_ID", "4825e152-08e3-414e-a34f-d93d048f84b8");
-    for (auto& notification : m_condVarData.m_activeNotifications)
+    for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; ++i)
     {
-        EXPECT_THAT(notification, Eq(false));
+        EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
     }
 }
 
@@ -166,15 +260,48 @@ TEST_F(ConditionVariable_test, NotifyActivatesCorrectIndex)
     {
         if (i == EVENT_INDEX)
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i], Eq(true));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(true));
         }
         else
         {
-            EXPECT_THAT(m_condVarData.m_activeNotifications[i], Eq(false));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
         }
     }
 }
 
+TEST_F(ConditionVariable_test, WaitReturnsNotificationsOfAllNotificationWordsInAscendingOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "36503438-16d1-4b5b-947b-df19acf6434b");
+    if (iox::MAX_NUMBER_OF_NOTIFIERS <= ConditionVariableData::NOTIFICATIONS_PER_WORD)
+    {
+        GTEST_SKIP() << "The notifications fit into a single notification word";
+    }
+    const std::vector<Type_t> eventIndices{iox::MAX_NUMBER_OF_EVENTS_PER_LISTENER - 1U,
+                                           static_cast<Type_t>(ConditionVariableData::NOTIFICATIONS_PER_WORD),
+                                           0U,
+                                           static_cast<Type_t>(ConditionVariableData::NOTIFICATIONS_PER_WORD - 1U)};
+    for (const auto index : eventIndices)
+    {
+        ConditionNotifier(m_condVarData, index).notify();
+    }
+
+    ConditionListener sut(m_condVarData);
+    auto activeNotifications = sut.timedWait(iox::units::Duration::fromMilliseconds(0U));
+
+    std::vector<Type_t> expectedIndices(eventIndices);
+    std::sort(expectedIndices.begin(), expectedIndices.end());
+    expectedIndices.erase(std::unique(expectedIndices.begin(), expectedIndices.end()), expectedIndices.end());
+    ASSERT_THAT(activeNotifications.size(), Eq(expectedIndices.size()));
+    for (uint64_t i = 0U; i < expectedIndices.size(); ++i)
+    {
+        EXPECT_THAT(activeNotifications[i], Eq(expectedIndices[i]));
+    }
+    for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; ++i)
+    {
+        EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
+    }
+}
+
 TEST_F(ConditionVariable_test, TimedWaitWithZeroTimeoutWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "582f0b1c-c717-410e-8143-61459db672ad");
@@ -420,9 +547,9 @@ TIMING_TEST_F(ConditionVariable_test, SecondWaitBlocksUntilNewNotification, Repe
         hasWaited.store(true, std::memory_order_relaxed);
         ASSERT_THAT(activeNotifications.size(), Eq(1U));
         EXPECT_THAT(activeNotifications[0], Eq(FIRST_EVENT_INDEX));
-        for (const auto& notification : m_condVarData.m_activeNotifications)
+        for (uint64_t i = 0U; i < iox::MAX_NUMBER_OF_NOTIFIERS; ++i)
         {
-            EXPECT_THAT(notification, Eq(false));
+            EXPECT_THAT(m_condVarData.isNotificationActive(i), Eq(false));
         }
     });
 
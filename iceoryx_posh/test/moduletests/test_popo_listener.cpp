@@ -133,8 +133,8 @@ class SimpleEventClass
 class TestListener : public Listener
 {
   public:
-    TestListener(ConditionVariableData& data) noexcept
-        : Listener(data)
+    TestListener(ConditionVariableData& data, const WaitStrategy& waitStrategy = WaitStrategy()) noexcept
+        : Listener(data, waitStrategy)
     {
     }
 };
@@ -668,6 +668,31 @@ TIMING_TEST_F(Listener_test, CallbackIsCalledAfterNotify, Repeat(5), [&] {
     TIMING_TEST_EXPECT_TRUE(g_triggerCallbackArg[0U].m_count == 1U);
 })
 
+TEST_F(Listener_test, SpinningListenerCallsCallbackAfterNotify)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "fbc01467-ac0b-45ba-91d8-b206781697fe");
+    WaitStrategy waitStrategy;
+    waitStrategy.maxSpinIterations = 1000U;
+    waitStrategy.maxSpinDuration = 10_ms;
+    m_sut.emplace(m_condVarData, waitStrategy);
+    SimpleEventClass fuu;
+    ASSERT_FALSE(m_sut
+                     ->attachEvent(fuu,
+                                   SimpleEvent::StoepselBachelorParty,
+                                   createNotificationCallback(Listener_test::triggerCallback<0U>))
+                     .has_error());
+
+    m_watchdog.watchAndActOnFailure([] { std::terminate(); });
+    fuu.triggerStoepsel();
+    while (g_triggerCallbackArg[0U].m_count.load() == 0U)
+    {
+        std::this_thread::yield();
+    }
+
+    EXPECT_TRUE(g_triggerCallbackArg[0U].m_source == &fuu);
+    EXPECT_THAT(g_triggerCallbackArg[0U].m_count.load(), Eq(1U));
+}
+
 TIMING_TEST_F(Listener_test, CallbackWithEventAndUserTypeIsCalledAfterNotify, Repeat(5), [&] {
     ::testing::Test::RecordProperty("TEST_ID", "6df97139-8c2e-42b1-bd9a-8770c295bf2e");
     m_sut.emplace(m_condVarData);
@@ -217,11 +217,17 @@ TEST_F(ListenerWaitsetAttachments_test, UntypedServerDestructorCallsTriggerReset
 TEST_F(ListenerWaitsetAttachments_test, ServiceDiscoveryDestructorCallsTriggerResetDirectly)
 {
     ::testing::Test::RecordProperty("TEST_ID", "b266bb98-f31a-43b8-a0c4-75aea6f40efb");
-    SubscriberPortData subscriberData({SERVICE, INSTANCE, EVENT},
-                                      RUNTIME_NAME,
-                                      VariantQueueTypes::SoFi_MultiProducerSingleConsumer,
-                                      SubscriberOptions());
-    EXPECT_CALL(*this->runtimeMock, getMiddlewareSubscriber(_, _, _)).WillOnce(Return(&subscriberData));
+    SubscriberPortData snapshotSubscriberData({SERVICE, INSTANCE, EVENT},
+                                              RUNTIME_NAME,
+                                              VariantQueueTypes::SoFi_MultiProducerSingleConsumer,
+                                              SubscriberOptions());
+    SubscriberPortData deltaSubscriberData({SERVICE, INSTANCE, EVENT},
+                                           RUNTIME_NAME,
+                                           VariantQueueTypes::SoFi_MultiProducerSingleConsumer,
+                                           SubscriberOptions());
+    EXPECT_CALL(*this->runtimeMock, getMiddlewareSubscriber(_, _, _))
+        .WillOnce(Return(&snapshotSubscriberData))
+        .WillOnce(Return(&deltaSubscriberData));
 
     optional<iox::runtime::ServiceDiscovery> serviceDiscovery;
     serviceDiscovery.emplace();
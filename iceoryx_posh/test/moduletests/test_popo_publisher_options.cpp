@@ -32,6 +32,8 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
     testOptions.nodeName = "hypnotoad";
     testOptions.offerOnCreate = false;
     testOptions.subscriberTooSlowPolicy = iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER;
+    testOptions.chunkMagazineCapacity = 13U;
+    testOptions.subscriberTooSlowTimeout = iox::units::Duration::fromMilliseconds(73U);
 
     iox::popo::PublisherOptions::deserialize(testOptions.serialize())
         .and_then([&](auto& roundTripOptions) {
@@ -46,6 +48,12 @@ TEST(PublisherOptions_test, SerializationRoundTripIsSuccessful)
 
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Ne(defaultOptions.subscriberTooSlowPolicy));
             EXPECT_THAT(roundTripOptions.subscriberTooSlowPolicy, Eq(testOptions.subscriberTooSlowPolicy));
+
+            EXPECT_THAT(roundTripOptions.chunkMagazineCapacity, Ne(defaultOptions.chunkMagazineCapacity));
+            EXPECT_THAT(roundTripOptions.chunkMagazineCapacity, Eq(testOptions.chunkMagazineCapacity));
+
+            EXPECT_THAT(roundTripOptions.subscriberTooSlowTimeout, Ne(defaultOptions.subscriberTooSlowTimeout));
+            EXPECT_THAT(roundTripOptions.subscriberTooSlowTimeout, Eq(testOptions.subscriberTooSlowTimeout));
         })
         .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of PublisherOptions failed!"; });
 }
@@ -66,12 +74,73 @@ TEST(PublisherOptions_test, DeserializingInvalidSubscriberTooSlowPolicyFails)
     const iox::NodeName_t NODE_NAME{"harr-harr"};
     constexpr bool OFFER_ON_CREATE{true};
     constexpr std::underlying_type_t<iox::popo::ConsumerTooSlowPolicy> SUBSCRIBER_TOO_SLOW_POLICY{111};
+    constexpr uint32_t CHUNK_MAGAZINE_CAPACITY{0U};
 
-    const auto serialized =
-        iox::Serialization::create(HISTORY_CAPACITY, NODE_NAME, OFFER_ON_CREATE, SUBSCRIBER_TOO_SLOW_POLICY);
+    const auto serialized = iox::Serialization::create(
+        HISTORY_CAPACITY, NODE_NAME, OFFER_ON_CREATE, SUBSCRIBER_TOO_SLOW_POLICY, CHUNK_MAGAZINE_CAPACITY);
     iox::popo::PublisherOptions::deserialize(serialized)
         .and_then([&](auto&) { GTEST_FAIL() << "Deserialization is expected to fail!"; })
         .or_else([&](auto&) { GTEST_SUCCEED(); });
 }
 
+TEST(PublisherOptions_test, DeserializingOptionsWithoutChunkMagazineCapacityUsesDefaultCapacity)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d5a7e3c1-2b48-4f69-a0d3-8e6c1b9f7a24");
+    constexpr uint64_t HISTORY_CAPACITY{42U};
+    const iox::NodeName_t NODE_NAME{"harr-harr"};
+    constexpr bool OFFER_ON_CREATE{false};
+    constexpr auto SUBSCRIBER_TOO_SLOW_POLICY{iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER};
+
+    // the serialization of a runtime which is not aware of the chunk magazine
+    const auto serialized = iox::Serialization::create(
+        HISTORY_CAPACITY,
+        NODE_NAME,
+        OFFER_ON_CREATE,
+        static_cast<std::underlying_type_t<iox::popo::ConsumerTooSlowPolicy>>(SUBSCRIBER_TOO_SLOW_POLICY));
+    iox::popo::PublisherOptions::deserialize(serialized)
+        .and_then([&](auto& options) {
+            EXPECT_THAT(options.historyCapacity, Eq(HISTORY_CAPACITY));
+            EXPECT_THAT(options.nodeName, Eq(NODE_NAME));
+            EXPECT_THAT(options.offerOnCreate, Eq(OFFER_ON_CREATE));
+            EXPECT_THAT(options.subscriberTooSlowPolicy, Eq(SUBSCRIBER_TOO_SLOW_POLICY));
+            EXPECT_THAT(options.chunkMagazineCapacity, Eq(iox::popo::PublisherOptions().chunkMagazineCapacity));
+        })
+        .or_else([&](auto&) { GTEST_FAIL() << "Deserialization of PublisherOptions without chunk magazine failed!"; });
+}
+
+TEST(PublisherOptions_test, SerializationRoundTripOfDefaultSubscriberTooSlowTimeoutIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d5f8251f-3773-444a-bb34-3979b0cb3f08");
+    iox::popo::PublisherOptions::deserialize(iox::popo::PublisherOptions().serialize())
+        .and_then([&](auto& roundTripOptions) {
+            EXPECT_THAT(roundTripOptions.subscriberTooSlowTimeout, Eq(iox::units::Duration::max()));
+        })
+        .or_else([&](auto&) { GTEST_FAIL() << "Serialization/Deserialization of PublisherOptions failed!"; });
+}
+
+TEST(PublisherOptions_test, DeserializingOptionsWithoutSubscriberTooSlowTimeoutUsesDefaultTimeout)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "be7cc3c8-6811-4c52-b541-aae4a267b098");
+    constexpr uint64_t HISTORY_CAPACITY{42U};
+    const iox::NodeName_t NODE_NAME{"harr-harr"};
+    constexpr bool OFFER_ON_CREATE{false};
+    constexpr auto SUBSCRIBER_TOO_SLOW_POLICY{iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER};
+    constexpr uint32_t CHUNK_MAGAZINE_CAPACITY{13U};
+
+    // the serialization of a runtime which is not aware of the subscriber too slow timeout
+    const auto serialized = iox::Serialization::create(
+        HISTORY_CAPACITY,
+        NODE_NAME,
+        OFFER_ON_CREATE,
+        static_cast<std::underlying_type_t<iox::popo::ConsumerTooSlowPolicy>>(SUBSCRIBER_TOO_SLOW_POLICY),
+        CHUNK_MAGAZINE_CAPACITY);
+    iox::popo::PublisherOptions::deserialize(serialized)
+        .and_then([&](auto& options) {
+            EXPECT_THAT(options.subscriberTooSlowPolicy, Eq(SUBSCRIBER_TOO_SLOW_POLICY));
+            EXPECT_THAT(options.chunkMagazineCapacity, Eq(CHUNK_MAGAZINE_CAPACITY));
+            EXPECT_THAT(options.subscriberTooSlowTimeout, Eq(iox::units::Duration::max()));
+        })
+        .or_else([&](auto&) { GTEST_FAIL() << "Deserialization of PublisherOptions without timeout failed!"; });
+}
+
 } // namespace
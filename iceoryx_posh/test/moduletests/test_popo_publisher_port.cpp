@@ -19,6 +19,7 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/locking_policy.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/publisher_port_roudi.hpp"
@@ -182,6 +183,24 @@ TEST_F(PublisherPort_test, offerCallResultsInOfferCaProMessage)
     EXPECT_THAT(caproMessage.m_historyCapacity, Eq(0U));
 }
 
+TEST_F(PublisherPort_test, offerAndStopOfferCallsNotifyTheDiscoveryConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8b33c419-a5e9-460d-9b61-930bf448031b");
+    iox::popo::ConditionVariableData discoveryConditionVariable;
+    iox::popo::ConditionListener discoveryListener(discoveryConditionVariable);
+    m_publisherPortDataNoOfferOnCreate.m_discoveryConditionVariableDataPtr = &discoveryConditionVariable;
+
+    m_sutNoOfferOnCreateUserSide.offer();
+    auto notifications = discoveryListener.timedWait(iox::units::Duration::zero());
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0], Eq(iox::roudi::DISCOVERY_PORT_STATE_CHANGE_NOTIFICATION_INDEX));
+
+    m_sutNoOfferOnCreateUserSide.stopOffer();
+    notifications = discoveryListener.timedWait(iox::units::Duration::zero());
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0], Eq(iox::roudi::DISCOVERY_PORT_STATE_CHANGE_NOTIFICATION_INDEX));
+}
+
 TEST_F(PublisherPort_test, stopOfferCallResultsInNotOfferedState)
 {
     ::testing::Test::RecordProperty("TEST_ID", "49985d1e-e7ed-4fc2-9d0a-d78d61b74e3c");
@@ -161,6 +161,30 @@ TEST_F(SubscriberTest, TakeReturnsAllocatedMemoryChunksWrappedInSample)
     // ===== Cleanup ===== //
 }
 
+TEST_F(SubscriberTest, TakeManyCallsTheCallableWithEveryTakenSample)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5c9eea9f-459a-40c7-90ee-bf6d2bde8391");
+    // ===== Setup ===== //
+    ChunkMock<DummyData> otherChunkMock;
+    EXPECT_CALL(sut, takeChunks).Times(1).WillOnce([&](iox::span<const iox::mepoo::ChunkHeader*> chunkHeaders) {
+        EXPECT_THAT(chunkHeaders.size(), Eq(3U));
+        chunkHeaders[0] = chunkMock.chunkHeader();
+        chunkHeaders[1] = otherChunkMock.chunkHeader();
+        return iox::ok<uint64_t>(2U);
+    });
+    EXPECT_CALL(sut.port(), releaseChunk).Times(2);
+    std::vector<const void*> takenUserPayloads;
+    // ===== Test ===== //
+    auto result = sut.take(3U, [&](auto&& sample) { takenUserPayloads.push_back(sample.get()); });
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(2U));
+    ASSERT_THAT(takenUserPayloads.size(), Eq(2U));
+    EXPECT_EQ(takenUserPayloads[0], chunkMock.chunkHeader()->userPayload());
+    EXPECT_EQ(takenUserPayloads[1], otherChunkMock.chunkHeader()->userPayload());
+    // ===== Cleanup ===== //
+}
+
 TEST_F(SubscriberTest, ReceivedSamplesAreAutomaticallyDeletedWhenOutOfScope)
 {
     ::testing::Test::RecordProperty("TEST_ID", "f32c401d-0620-4a4b-800f-eda94a493efd");
@@ -19,6 +19,7 @@
 #include "iceoryx_posh/internal/mepoo/memory_manager.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_data.hpp"
 #include "iceoryx_posh/internal/popo/building_blocks/chunk_queue_popper.hpp"
+#include "iceoryx_posh/internal/popo/building_blocks/condition_listener.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_data.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_multi_producer.hpp"
 #include "iceoryx_posh/internal/popo/ports/subscriber_port_single_producer.hpp"
@@ -119,6 +120,24 @@ TEST_F(SubscriberPortSingleProducer_test, InitialStateReturnsSubCaProMessageWith
     EXPECT_THAT(caproMessage.m_type, Eq(iox::capro::CaproMessageType::SUB));
 }
 
+TEST_F(SubscriberPortSingleProducer_test, SubscribeAndUnsubscribeCallsNotifyTheDiscoveryConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "69dfeb64-f42f-4eda-ba84-dcaeef5f1837");
+    iox::popo::ConditionVariableData discoveryConditionVariable;
+    iox::popo::ConditionListener discoveryListener(discoveryConditionVariable);
+    m_subscriberPortDataSingleProducer.m_discoveryConditionVariableDataPtr = &discoveryConditionVariable;
+
+    m_sutUserSideSingleProducer.subscribe();
+    auto notifications = discoveryListener.timedWait(iox::units::Duration::zero());
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0], Eq(iox::roudi::DISCOVERY_PORT_STATE_CHANGE_NOTIFICATION_INDEX));
+
+    m_sutUserSideSingleProducer.unsubscribe();
+    notifications = discoveryListener.timedWait(iox::units::Duration::zero());
+    ASSERT_THAT(notifications.size(), Eq(1U));
+    EXPECT_THAT(notifications[0], Eq(iox::roudi::DISCOVERY_PORT_STATE_CHANGE_NOTIFICATION_INDEX));
+}
+
 TEST_F(SubscriberPortSingleProducer_test, SubscribeCallResultsInSubCaProMessage)
 {
     ::testing::Test::RecordProperty("TEST_ID", "3efdb6ed-4b04-4a28-8e5a-aeb7329ad188");
@@ -137,6 +137,23 @@ TEST_F(UntypedPublisherTest, PublishesUserPayloadViaUnderlyingPort)
     // ===== Cleanup ===== //
 }
 
+TEST_F(UntypedPublisherTest, PublishesManyUserPayloadsWithOneCallOfTheUnderlyingPort)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "cd5512d1-4a96-41d8-8192-cf45a26c7f91");
+    // ===== Setup ===== //
+    ChunkMock<uint64_t> otherChunkMock;
+    void* userPayloads[]{chunkMock.chunkHeader()->userPayload(), otherChunkMock.chunkHeader()->userPayload()};
+    EXPECT_CALL(portMock, sendChunks).Times(1).WillOnce([&](const iox::span<iox::mepoo::ChunkHeader* const> headers) {
+        ASSERT_THAT(headers.size(), Eq(2U));
+        EXPECT_THAT(headers[0], Eq(chunkMock.chunkHeader()));
+        EXPECT_THAT(headers[1], Eq(otherChunkMock.chunkHeader()));
+    });
+    // ===== Test ===== //
+    sut.publishMany(iox::span<void* const>(userPayloads, 2U));
+    // ===== Verify ===== //
+    // ===== Cleanup ===== //
+}
+
 // test whether the BasePublisher methods are called
 
 TEST_F(UntypedPublisherTest, OfferDoesOfferServiceOnUnderlyingPort)
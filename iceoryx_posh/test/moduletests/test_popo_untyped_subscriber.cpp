@@ -159,6 +159,29 @@ TEST_F(UntypedSubscriberTest, TakeReturnsAllocatedMemoryChunk)
     sut.release(maybeChunk.value());
 }
 
+TEST_F(UntypedSubscriberTest, TakeBatchReturnsAllocatedMemoryChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "9ae841bb-e2de-4376-83f3-8be0ef0157fa");
+    // ===== Setup ===== //
+    ChunkMock<DummyData> otherChunkMock;
+    EXPECT_CALL(sut, takeChunks).Times(1).WillOnce([&](iox::span<const iox::mepoo::ChunkHeader*> chunkHeaders) {
+        EXPECT_THAT(chunkHeaders.size(), Eq(3U));
+        chunkHeaders[0] = chunkMock.chunkHeader();
+        chunkHeaders[1] = otherChunkMock.chunkHeader();
+        return iox::ok<uint64_t>(2U);
+    });
+    const void* userPayloads[3U]{nullptr, nullptr, nullptr};
+    // ===== Test ===== //
+    auto result = sut.takeBatch(iox::span<const void*>(userPayloads, 3U));
+    // ===== Verify ===== //
+    ASSERT_FALSE(result.has_error());
+    EXPECT_THAT(result.value(), Eq(2U));
+    EXPECT_EQ(userPayloads[0], chunkMock.chunkHeader()->userPayload());
+    EXPECT_EQ(userPayloads[1], otherChunkMock.chunkHeader()->userPayload());
+    EXPECT_EQ(userPayloads[2], nullptr);
+    // ===== Cleanup ===== //
+}
+
 TEST_F(UntypedSubscriberTest, ReleasesQueuedDataViaBaseSubscriber)
 {
     ::testing::Test::RecordProperty("TEST_ID", "66c0fb02-aa6d-48dd-8439-754e05cd29af");
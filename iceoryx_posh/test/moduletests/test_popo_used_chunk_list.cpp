@@ -123,6 +123,55 @@ TEST_F(UsedChunkList_test, AddChunksUntilOverflowIsHandledGracefully)
     EXPECT_FALSE(sut.insert(getChunkFromMemoryManager()));
 }
 
+TEST_F(UsedChunkList_test, InsertManyInsertsChunksUntilTheChunkSourceIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "55f4424d-53ca-4483-bb89-451c45241b7a");
+    constexpr uint64_t NUMBER_OF_CHUNKS{3U};
+    uint64_t numberOfProvidedChunks{0U};
+    auto numberOfInsertedChunks = sut.insertMany(USED_CHUNK_LIST_CAPACITY, [&]() -> iox::optional<SharedChunk> {
+        if (numberOfProvidedChunks == NUMBER_OF_CHUNKS)
+        {
+            return iox::nullopt;
+        }
+        ++numberOfProvidedChunks;
+        return getChunkFromMemoryManager();
+    });
+
+    EXPECT_THAT(numberOfInsertedChunks, Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(NUMBER_OF_CHUNKS));
+}
+
+TEST_F(UsedChunkList_test, InsertManyDoesNotRequestMoreChunksThanTheListCanHold)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "41dd8844-9c67-42a6-884e-4c0d5d2548e1");
+    uint64_t numberOfProvidedChunks{0U};
+    auto numberOfInsertedChunks =
+        sut.insertMany(USED_CHUNK_LIST_CAPACITY + 5U, [&]() -> iox::optional<SharedChunk> {
+            ++numberOfProvidedChunks;
+            return getChunkFromMemoryManager();
+        });
+
+    EXPECT_THAT(numberOfInsertedChunks, Eq(USED_CHUNK_LIST_CAPACITY));
+    EXPECT_THAT(numberOfProvidedChunks, Eq(USED_CHUNK_LIST_CAPACITY));
+    EXPECT_FALSE(sut.insert(getChunkFromMemoryManager()));
+}
+
+TEST_F(UsedChunkList_test, InsertManyInsertsAtMostTheRequestedNumberOfChunks)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "d1bc5c60-7d27-4b8a-b260-7e4687decd4d");
+    constexpr uint64_t NUMBER_OF_CHUNKS{4U};
+    auto numberOfInsertedChunks = sut.insertMany(
+        NUMBER_OF_CHUNKS, [&]() -> iox::optional<SharedChunk> { return getChunkFromMemoryManager(); });
+
+    EXPECT_THAT(numberOfInsertedChunks, Eq(NUMBER_OF_CHUNKS));
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(NUMBER_OF_CHUNKS));
+
+    sut.cleanup();
+
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+    checkIfEmpty();
+}
+
 TEST_F(UsedChunkList_test, OneChunkCanBeRemoved)
 {
     ::testing::Test::RecordProperty("TEST_ID", "50ffb5df-59ef-4dd4-a2a6-c7ad342c24ae");
@@ -214,6 +263,43 @@ TEST_F(UsedChunkList_test, MultipleChunksCanBeRemovedInArbitraryOrder)
     checkIfEmpty();
 }
 
+TEST_F(UsedChunkList_test, InterleavedInsertAndRemoveOfManyChunksKeepsAllChunksRemovable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "27034777-df08-433e-9ae4-5643e4f16d10");
+    constexpr uint32_t CAPACITY{64U};
+    constexpr uint32_t NUMBER_OF_ROUNDS{20U};
+    UsedChunkList<CAPACITY> sutWithLargerCapacity;
+    std::vector<SharedChunk> chunksInUse;
+
+    for (uint32_t round = 0U; round < NUMBER_OF_ROUNDS; ++round)
+    {
+        while (chunksInUse.size() < CAPACITY)
+        {
+            chunksInUse.push_back(getChunkFromMemoryManager());
+            ASSERT_TRUE(sutWithLargerCapacity.insert(chunksInUse.back()));
+        }
+        EXPECT_FALSE(sutWithLargerCapacity.insert(chunksInUse.front()));
+
+        // remove every third chunk, starting at a different chunk in every round
+        for (uint32_t i = round % 3U; i < chunksInUse.size(); i += 2U)
+        {
+            SharedChunk removedChunk;
+            ASSERT_TRUE(sutWithLargerCapacity.remove(chunksInUse[i].getChunkHeader(), removedChunk));
+            EXPECT_THAT(removedChunk.getChunkHeader(), Eq(chunksInUse[i].getChunkHeader()));
+            chunksInUse.erase(chunksInUse.begin() + i);
+        }
+    }
+
+    for (auto& chunk : chunksInUse)
+    {
+        SharedChunk removedChunk;
+        EXPECT_TRUE(sutWithLargerCapacity.remove(chunk.getChunkHeader(), removedChunk));
+    }
+    chunksInUse.clear();
+
+    EXPECT_THAT(memoryManager.getMemPoolInfo(0U).m_usedChunks, Eq(0U));
+}
+
 TEST_F(UsedChunkList_test, UsedChunkListCanBeFilledToCapacityAndFullyEmptied)
 {
     ::testing::Test::RecordProperty("TEST_ID", "5932b727-dfbe-4041-985d-7a819c8ea06c");
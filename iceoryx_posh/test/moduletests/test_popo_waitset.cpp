@@ -265,8 +265,9 @@ TEST_F(WaitSetHelper_test, MergeWithOverlappingOneElementNotificationVector)
 class WaitSetTest : public iox::popo::WaitSet<>
 {
   public:
-    WaitSetTest(iox::popo::ConditionVariableData& condVarData) noexcept
-        : WaitSet(condVarData)
+    WaitSetTest(iox::popo::ConditionVariableData& condVarData,
+                const iox::popo::WaitStrategy& waitStrategy = iox::popo::WaitStrategy()) noexcept
+        : WaitSet(condVarData, waitStrategy)
     {
     }
 };
@@ -1202,6 +1203,29 @@ TEST_F(WaitSet_test, TimedWaitReturnsTheOneTriggeredCondition)
     WaitReturnsTheOneTriggeredCondition(this, [&] { return m_sut->timedWait(10_ms); });
 }
 
+TEST_F(WaitSet_test, SpinningWaitReturnsConditionWhichIsTriggeredWhileSpinning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "deb3e0d2-547e-4cae-a549-558b656f27eb");
+    WaitStrategy waitStrategy;
+    waitStrategy.maxSpinDuration = 100_ms;
+    m_sut.reset();
+    m_sut.emplace(m_condVarData, waitStrategy);
+
+    ASSERT_FALSE(m_sut->attachEvent(m_simpleEvents[0], 5U).has_error());
+
+    std::thread notifier([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        m_simpleEvents[0].trigger();
+    });
+
+    auto triggerVector = m_sut->wait();
+    notifier.join();
+
+    ASSERT_THAT(triggerVector.size(), Eq(1U));
+    EXPECT_THAT(triggerVector[0U]->getNotificationId(), 5U);
+    EXPECT_TRUE(triggerVector[0U]->doesOriginateFrom(&m_simpleEvents[0]));
+}
+
 void WaitReturnsAllTriggeredConditionWhenMultipleAreTriggered(
     WaitSet_test* test, const std::function<WaitSet<>::NotificationInfoVector()>& waitCall)
 {
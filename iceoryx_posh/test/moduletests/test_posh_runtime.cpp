@@ -379,8 +379,13 @@ TEST_F(PoshRuntime_test, GetMiddlewarePublisherWithForbiddenServiceDescriptionsF
     const iox::capro::ServiceDescription serviceRegistry{
         iox::SERVICE_DISCOVERY_SERVICE_NAME, iox::SERVICE_DISCOVERY_INSTANCE_NAME, iox::SERVICE_DISCOVERY_EVENT_NAME};
 
+    const iox::capro::ServiceDescription serviceRegistryDelta{iox::SERVICE_DISCOVERY_SERVICE_NAME,
+                                                              iox::SERVICE_DISCOVERY_INSTANCE_NAME,
+                                                              iox::SERVICE_DISCOVERY_DELTA_EVENT_NAME};
+
     // Added by PortManager
     internalServices.push_back(serviceRegistry);
+    internalServices.push_back(serviceRegistryDelta);
     internalServices.push_back(iox::roudi::IntrospectionPortService);
     internalServices.push_back(iox::roudi::IntrospectionPortThroughputService);
     internalServices.push_back(iox::roudi::IntrospectionSubscriberPortChangingDataService);
@@ -650,6 +655,136 @@ TEST_F(PoshRuntime_test, GetMiddlewareSubscriberWithQueueFullPolicySetToBlockPub
                 Eq(iox::popo::QueueFullPolicy::BLOCK_PRODUCER));
 }
 
+TEST_F(PoshRuntime_test, GetMiddlewarePortsCreatesAllPortsOfTheBatch)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bf01645f-d1f0-47d7-a962-96c29709c5b1");
+    iox::popo::PublisherOptions publisherOptions;
+    publisherOptions.historyCapacity = 3U;
+    publisherOptions.nodeName = m_nodeName;
+    iox::popo::SubscriberOptions subscriberOptions;
+    subscriberOptions.queueCapacity = 7U;
+    subscriberOptions.nodeName = m_nodeName;
+
+    iox::runtime::PortBatch batch;
+    const auto publisherIndex =
+        batch.addPublisher(iox::capro::ServiceDescription("99", "1", "20"), publisherOptions, {11U, 22U, 33U});
+    const auto subscriberIndex =
+        batch.addSubscriber(iox::capro::ServiceDescription("99", "1", "21"), subscriberOptions, {11U, 22U, 33U});
+    ASSERT_TRUE(publisherIndex.has_value());
+    ASSERT_TRUE(subscriberIndex.has_value());
+
+    m_runtime->getMiddlewarePorts(batch);
+
+    const auto publisherPort = batch[publisherIndex.value()].publisherPort;
+    ASSERT_NE(nullptr, publisherPort);
+    EXPECT_EQ(nullptr, batch[publisherIndex.value()].subscriberPort);
+    EXPECT_EQ(iox::capro::ServiceDescription("99", "1", "20"), publisherPort->m_serviceDescription);
+    EXPECT_EQ(publisherOptions.historyCapacity, publisherPort->m_chunkSenderData.m_historyCapacity);
+    EXPECT_EQ(m_nodeName, publisherPort->m_nodeName);
+
+    const auto subscriberPort = batch[subscriberIndex.value()].subscriberPort;
+    ASSERT_NE(nullptr, subscriberPort);
+    EXPECT_EQ(nullptr, batch[subscriberIndex.value()].publisherPort);
+    EXPECT_EQ(iox::capro::ServiceDescription("99", "1", "21"), subscriberPort->m_serviceDescription);
+    EXPECT_EQ(subscriberOptions.queueCapacity, subscriberPort->m_chunkReceiverData.m_queue.capacity());
+    EXPECT_EQ(m_nodeName, subscriberPort->m_nodeName);
+}
+
+TEST_F(PoshRuntime_test, GetMiddlewarePortsWithFullBatchCreatesAllPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1a2b29cf-c745-4790-bba6-2f9d54637754");
+    // the batch does not fit into a single IPC message and is split into several requests
+    iox::runtime::PortBatch batch;
+    for (uint64_t i = 0U; i < iox::runtime::PortBatch::CAPACITY; ++i)
+    {
+        const iox::capro::IdString_t event{iox::TruncateToCapacity, iox::convert::toString(i).c_str()};
+        const auto index = (i % 2U == 0U) ? batch.addPublisher({"SomeLongishServiceName", "SomeInstance", event})
+                                          : batch.addSubscriber({"SomeLongishServiceName", "SomeInstance", event});
+        ASSERT_TRUE(index.has_value());
+    }
+    EXPECT_FALSE(batch.addPublisher({"SomeLongishServiceName", "SomeInstance", "Overflow"}).has_value());
+
+    m_runtime->getMiddlewarePorts(batch);
+
+    for (uint64_t i = 0U; i < batch.size(); ++i)
+    {
+        const iox::capro::IdString_t event{iox::TruncateToCapacity, iox::convert::toString(i).c_str()};
+        const iox::capro::ServiceDescription expectedService{"SomeLongishServiceName", "SomeInstance", event};
+        if (i % 2U == 0U)
+        {
+            ASSERT_NE(nullptr, batch[i].publisherPort);
+            EXPECT_EQ(expectedService, batch[i].publisherPort->m_serviceDescription);
+        }
+        else
+        {
+            ASSERT_NE(nullptr, batch[i].subscriberPort);
+            EXPECT_EQ(expectedService, batch[i].subscriberPort->m_serviceDescription);
+        }
+    }
+}
+
+TEST_F(PoshRuntime_test, GetMiddlewarePortsWithMaximumLengthServiceNamesCreatesAllPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "85c76668-0403-4acb-917a-8db91a5fc52e");
+    // a port with service names of maximum length fills almost a whole IPC message, therefore every request contains
+    // a single port
+    constexpr uint64_t NUMBER_OF_PORTS{4U};
+    const std::string longName(iox::capro::IdString_t::capacity() - 1U, 'x');
+    auto createService = [&](const uint64_t i) {
+        const iox::capro::IdString_t id{iox::TruncateToCapacity, (longName + iox::convert::toString(i)).c_str()};
+        return iox::capro::ServiceDescription{id, id, id};
+    };
+
+    iox::runtime::PortBatch batch;
+    for (uint64_t i = 0U; i < NUMBER_OF_PORTS; ++i)
+    {
+        const auto service = createService(i);
+        const auto index = (i % 2U == 0U) ? batch.addPublisher(service) : batch.addSubscriber(service);
+        ASSERT_TRUE(index.has_value());
+    }
+
+    m_runtime->getMiddlewarePorts(batch);
+
+    for (uint64_t i = 0U; i < batch.size(); ++i)
+    {
+        if (i % 2U == 0U)
+        {
+            ASSERT_NE(nullptr, batch[i].publisherPort);
+            EXPECT_EQ(createService(i), batch[i].publisherPort->m_serviceDescription);
+        }
+        else
+        {
+            ASSERT_NE(nullptr, batch[i].subscriberPort);
+            EXPECT_EQ(createService(i), batch[i].subscriberPort->m_serviceDescription);
+        }
+    }
+}
+
+TEST_F(PoshRuntime_test, GetMiddlewarePortsWithForbiddenServiceDescriptionCreatesTheRemainingPorts)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "bc3eaaca-4694-4dbe-a2e0-c7f83d53ef14");
+    uint16_t forbiddenServiceDescriptionDetected{0U};
+    auto errorHandlerGuard = iox::ErrorHandlerMock::setTemporaryErrorHandler<iox::PoshError>(
+        [&forbiddenServiceDescriptionDetected](const iox::PoshError error, const iox::ErrorLevel) {
+            if (error == iox::PoshError::POSH__RUNTIME_SERVICE_DESCRIPTION_FORBIDDEN)
+            {
+                forbiddenServiceDescriptionDetected++;
+            }
+        });
+
+    iox::runtime::PortBatch batch;
+    batch.addPublisher({"99", "1", "20"});
+    batch.addPublisher(iox::roudi::IntrospectionPortService);
+    batch.addSubscriber({"99", "1", "20"});
+
+    m_runtime->getMiddlewarePorts(batch);
+
+    EXPECT_THAT(forbiddenServiceDescriptionDetected, Eq(1U));
+    EXPECT_NE(nullptr, batch[0U].publisherPort);
+    EXPECT_EQ(nullptr, batch[1U].publisherPort);
+    EXPECT_NE(nullptr, batch[2U].subscriberPort);
+}
+
 TEST_F(PoshRuntime_test, GetMiddlewareClientWithDefaultArgsIsSuccessful)
 {
     ::testing::Test::RecordProperty("TEST_ID", "2db35746-e402-443f-b374-3b6a239ab5fd");
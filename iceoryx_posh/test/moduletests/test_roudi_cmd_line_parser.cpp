@@ -34,7 +34,8 @@ namespace config
 {
 bool operator==(const CmdLineArgs_t& lhs, const CmdLineArgs_t& rhs)
 {
-    return (lhs.monitoringMode == rhs.monitoringMode) && (lhs.logLevel == rhs.logLevel)
+    return (lhs.monitoringMode == rhs.monitoringMode) && (lhs.processExitDetection == rhs.processExitDetection)
+           && (lhs.logLevel == rhs.logLevel)
            && (lhs.compatibilityCheckLevel == rhs.compatibilityCheckLevel)
            && (lhs.processTerminationDelay == rhs.processTerminationDelay)
            && (lhs.processKillDelay == rhs.processKillDelay) && (lhs.uniqueRouDiId == rhs.uniqueRouDiId)
@@ -81,6 +82,19 @@ class CmdLineParser_test : public Test
         optind = 0;
     }
 
+    void testExitDetection(uint8_t numberOfArgs, char* args[], ProcessExitDetection detection)
+    {
+        CmdLineParser sut;
+        auto result = sut.parse(numberOfArgs, args);
+
+        ASSERT_FALSE(result.has_error());
+        EXPECT_EQ(result.value().processExitDetection, detection);
+        EXPECT_TRUE(result.value().run);
+
+        // Reset optind to be able to parse again
+        optind = 0;
+    }
+
     void testCompatibilityLevel(uint8_t numberOfArgs, char* args[], CompatibilityCheckLevel level)
     {
         CmdLineParser sut;
@@ -239,6 +253,49 @@ TEST_F(CmdLineParser_test, WrongMonitoringModeOptionLeadsToProgrammNotRunning)
     EXPECT_FALSE(result.value().run);
 }
 
+TEST_F(CmdLineParser_test, ExitDetectionOptionsLeadToCorrectDetection)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "52de034e-d791-41af-969c-074be0de0f50");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    ProcessExitDetection detectionArray[] = {ProcessExitDetection::HEARTBEAT, ProcessExitDetection::PIDFD};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char optionArray[][20] = {"-e", "--exit-detection"};
+    char valueArray[][10] = {"heartbeat", "pidfd"};
+    args[0] = &appName[0];
+
+    for (auto optionValue : optionArray)
+    {
+        args[1] = optionValue;
+        uint8_t i{0U};
+        for (auto expectedValue : detectionArray)
+        {
+            args[2] = valueArray[i];
+            testExitDetection(NUMBER_OF_ARGS, args, expectedValue);
+            i++;
+        }
+    }
+}
+
+TEST_F(CmdLineParser_test, WrongExitDetectionOptionLeadsToProgrammNotRunning)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "e3a2d7cc-ea46-46a5-ab0c-f55c2f4acd74");
+    constexpr uint8_t NUMBER_OF_ARGS{3U};
+    char* args[NUMBER_OF_ARGS];
+    char appName[] = "./foo";
+    char option[] = "--exit-detection";
+    char wrongValue[] = "crystalBall";
+    args[0] = &appName[0];
+    args[1] = &option[0];
+    args[2] = &wrongValue[0];
+
+    CmdLineParser sut;
+    auto result = sut.parse(NUMBER_OF_ARGS, args);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_FALSE(result.value().run);
+}
+
 TEST_F(CmdLineParser_test, LogLevelOptionsLeadToCorrectLogLevel)
 {
     ::testing::Test::RecordProperty("TEST_ID", "25799d7a-9f34-4bcd-bb01-f6dbe270fac3");
@@ -98,6 +98,177 @@ TEST_F(RoudiConfigTomlFileProvider_test, ParsingFileIsSuccessful)
     });
 }
 
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingFallThroughAllocationPolicyIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4c8e1f27-93ab-4d06-a5e2-7b1d6f0c9e34");
+
+    std::istringstream stream(R"([general]
+        version = 1
+
+        [[segment]]
+        allocation-policy = "fall-through"
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    ASSERT_THAT(result.value().m_sharedMemorySegments.size(), Eq(1U));
+    EXPECT_THAT(result.value().m_sharedMemorySegments[0].m_mempoolConfig.m_allocationPolicy,
+                Eq(iox::mepoo::MemPoolAllocationPolicy::FALL_THROUGH_TO_LARGER_MEMPOOL));
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingSegmentZeroingThreadCountIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5c11b137-3df8-4cec-8aff-299dbaaa23fb");
+
+    std::istringstream stream(R"([general]
+        version = 1
+
+        [[segment]]
+        zeroing-threads = 8
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    ASSERT_THAT(result.value().m_sharedMemorySegments.size(), Eq(2U));
+    EXPECT_THAT(result.value().m_sharedMemorySegments[0].m_zeroingThreadCount, Eq(8U));
+    EXPECT_THAT(result.value().m_sharedMemorySegments[1].m_zeroingThreadCount,
+                Eq(iox::SHM_SEGMENT_DEFAULT_ZEROING_THREAD_COUNT));
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingSegmentHugePagesIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "da4e0a89-2e2e-4977-ba61-2fbefcec696a");
+
+    std::istringstream stream(R"([general]
+        version = 1
+
+        [[segment]]
+        huge-pages = "2M"
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[segment]]
+        huge-pages = "1G"
+        huge-page-mount = "/mnt/huge_1G"
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(3U));
+    EXPECT_THAT(segments[0].m_hugePageSize, Eq(iox::mepoo::HugePageSize::SIZE_2MB));
+    EXPECT_TRUE(segments[0].m_hugePageMount.empty());
+    EXPECT_THAT(segments[1].m_hugePageSize, Eq(iox::mepoo::HugePageSize::SIZE_1GB));
+    EXPECT_THAT(segments[1].m_hugePageMount, Eq(iox::mepoo::HugePageMount_t("/mnt/huge_1G")));
+    EXPECT_THAT(segments[2].m_hugePageSize, Eq(iox::mepoo::HugePageSize::NONE));
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingSegmentNumaPolicyIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "481c70ad-87b8-4d64-88a9-ff5edcad8b36");
+
+    std::istringstream stream(R"([general]
+        version = 1
+
+        [[segment]]
+        numa-policy = "bind"
+        numa-nodes = [1]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[segment]]
+        numa-policy = "interleave"
+        numa-nodes = [0, 2]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    const auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(3U));
+    EXPECT_THAT(segments[0].m_numaPolicy, Eq(iox::NumaMemoryPolicy::BIND));
+    EXPECT_THAT(segments[0].m_numaNodeMask, Eq(0b10U));
+    EXPECT_THAT(segments[1].m_numaPolicy, Eq(iox::NumaMemoryPolicy::INTERLEAVE));
+    EXPECT_THAT(segments[1].m_numaNodeMask, Eq(0b101U));
+    EXPECT_THAT(segments[2].m_numaPolicy, Eq(iox::NumaMemoryPolicy::DEFAULT));
+    EXPECT_THAT(segments[2].m_numaNodeMask, Eq(0U));
+}
+
+TEST_F(RoudiConfigTomlFileProvider_test, ParsingLockInMemoryIsSuccessful)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b330a0a7-8861-4244-a72f-72249e3f07db");
+
+    std::istringstream stream(R"([general]
+        version = 1
+
+        [management-segment]
+        lock-in-memory = true
+
+        [[segment]]
+        lock-in-memory = true
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+
+        [[segment]]
+
+        [[segment.mempool]]
+        size = 128
+        count = 1
+    )");
+
+    auto result = iox::config::TomlRouDiConfigFileProvider::parse(stream);
+
+    ASSERT_FALSE(result.has_error());
+    EXPECT_TRUE(result.value().lockManagementSegmentInMemory);
+    const auto& segments = result.value().m_sharedMemorySegments;
+    ASSERT_THAT(segments.size(), Eq(2U));
+    EXPECT_TRUE(segments[0].m_lockInMemory);
+    EXPECT_FALSE(segments[1].m_lockInMemory);
+}
+
 constexpr const char* CONFIG_NO_GENERAL_SECTION = R"(
     [[segment]]
 
@@ -181,6 +352,93 @@ constexpr const char* CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT = R"(
     size = 128
 )";
 
+constexpr const char* CONFIG_INVALID_MEMPOOL_ALLOCATION_POLICY = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    allocation-policy = "worst-fit"
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
+constexpr const char* CONFIG_INVALID_SEGMENT_ZEROING_THREAD_COUNT = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    zeroing-threads = 0
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
+constexpr const char* CONFIG_INVALID_HUGE_PAGE_SIZE = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    huge-pages = "4M"
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
+constexpr const char* CONFIG_INVALID_HUGE_PAGE_MOUNT = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    huge-pages = "2M"
+    huge-page-mount = "/mnt/huge pages"
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
+constexpr const char* CONFIG_INVALID_NUMA_POLICY = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    numa-policy = "preferred"
+    numa-nodes = [0]
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
+constexpr const char* CONFIG_INVALID_NUMA_NODES = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    numa-policy = "bind"
+    numa-nodes = [64]
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
+constexpr const char* CONFIG_MISSING_NUMA_NODES = R"(
+    [general]
+    version = 1
+
+    [[segment]]
+    numa-policy = "interleave"
+
+    [[segment.mempool]]
+    size = 128
+    count = 10000
+)";
+
 constexpr const char* CONFIG_EXCEPTION_IN_PARSER = R"(🐔)";
 
 INSTANTIATE_TEST_SUITE_P(
@@ -200,6 +458,18 @@ INSTANTIATE_TEST_SUITE_P(
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_SIZE},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::MEMPOOL_WITHOUT_CHUNK_COUNT,
                                  CONFIG_MEMPOOL_WITHOUT_CHUNK_COUNT},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_MEMPOOL_ALLOCATION_POLICY,
+                                 CONFIG_INVALID_MEMPOOL_ALLOCATION_POLICY},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_SEGMENT_ZEROING_THREAD_COUNT,
+                                 CONFIG_INVALID_SEGMENT_ZEROING_THREAD_COUNT},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_HUGE_PAGE_SIZE,
+                                 CONFIG_INVALID_HUGE_PAGE_SIZE},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_HUGE_PAGE_MOUNT,
+                                 CONFIG_INVALID_HUGE_PAGE_MOUNT},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_POLICY,
+                                 CONFIG_INVALID_NUMA_POLICY},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_NODES, CONFIG_INVALID_NUMA_NODES},
+           ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::INVALID_NUMA_NODES, CONFIG_MISSING_NUMA_NODES},
            ParseErrorInputFile_t{iox::roudi::RouDiConfigFileParseError::EXCEPTION_IN_PARSER,
                                  CONFIG_EXCEPTION_IN_PARSER}));
 
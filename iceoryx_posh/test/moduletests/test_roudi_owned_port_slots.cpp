@@ -0,0 +1,92 @@
+// Copyright (c) 2026 by agent <agent@local>. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// SPDX-License-Identifier: Apache-2.0
+
+#include "iceoryx_posh/internal/roudi/owned_port_slots.hpp"
+
+#include "test.hpp"
+
+#include <vector>
+
+namespace
+{
+using namespace ::testing;
+using namespace iox::roudi;
+
+class SlotSet_test : public Test
+{
+  public:
+    static constexpr uint64_t CAPACITY{130U};
+
+    std::vector<uint64_t> slotsOf(const SlotSet<CAPACITY>& slotSet)
+    {
+        std::vector<uint64_t> slots;
+        slotSet.forEach([&](const uint64_t slot) { slots.push_back(slot); });
+        return slots;
+    }
+
+    SlotSet<CAPACITY> sut;
+};
+
+TEST_F(SlotSet_test, InitiallyTheSetIsEmpty)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "884f5eca-489b-48a2-b3e5-c0893c2eebf4");
+    EXPECT_TRUE(slotsOf(sut).empty());
+    EXPECT_FALSE(sut.contains(0U));
+}
+
+TEST_F(SlotSet_test, ForEachVisitsAllInsertedSlotsInAscendingOrder)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "b2688c6b-ad9a-417b-a28e-f861586017cf");
+    sut.insert(129U);
+    sut.insert(0U);
+    sut.insert(64U);
+    sut.insert(63U);
+
+    EXPECT_THAT(slotsOf(sut), ElementsAre(0U, 63U, 64U, 129U));
+    EXPECT_TRUE(sut.contains(64U));
+    EXPECT_FALSE(sut.contains(65U));
+}
+
+TEST_F(SlotSet_test, InsertingASlotTwiceVisitsItOnce)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "26f7385a-5607-49a2-8d02-0e528fdce467");
+    sut.insert(42U);
+    sut.insert(42U);
+
+    EXPECT_THAT(slotsOf(sut), ElementsAre(42U));
+}
+
+TEST_F(SlotSet_test, ErasedSlotIsNotVisited)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "1c8c72fc-dbf9-4862-9ce8-9782c171149a");
+    sut.insert(13U);
+    sut.insert(73U);
+    sut.erase(13U);
+
+    EXPECT_THAT(slotsOf(sut), ElementsAre(73U));
+    EXPECT_FALSE(sut.contains(13U));
+}
+
+TEST_F(SlotSet_test, OutOfBoundsSlotIsIgnored)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6471613c-cceb-49be-ac51-0b753fea93b8");
+    sut.insert(CAPACITY);
+
+    EXPECT_TRUE(slotsOf(sut).empty());
+    EXPECT_FALSE(sut.contains(CAPACITY));
+}
+
+} // namespace
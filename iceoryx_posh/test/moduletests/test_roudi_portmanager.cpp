@@ -1006,4 +1006,48 @@ TEST_F(PortManager_test, PortsDestroyInProcess2ChangeStatesOfPortsInProcess1)
     }
 }
 
+TEST_F(PortManager_test, SubscriberPortStillUsedByDeliveryOfLivePublisherIsDestroyedAfterTheDeliveryReleasedIt)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ace7f11d-c705-469d-82b1-0b5ff887bc03");
+    iox::capro::ServiceDescription service("stalled", "delivery", "queue");
+    PublisherOptions publisherOptions{1U, iox::NodeName_t("node"), false};
+    SubscriberOptions subscriberOptions{1U, 1U, iox::NodeName_t("node"), false};
+
+    auto publisherData =
+        m_portManager
+            ->acquirePublisherPortData(
+                service, publisherOptions, "publisherApp", m_payloadDataSegmentMemoryManager, PortConfigInfo())
+            .value();
+    auto subscriberData =
+        m_portManager->acquireSubscriberPortData(service, subscriberOptions, "subscriberApp", PortConfigInfo())
+            .value();
+
+    PublisherPortUser publisher(publisherData);
+    publisher.offer();
+    SubscriberPortUser subscriber(subscriberData);
+    subscriber.subscribe();
+    m_portManager->doDiscovery();
+    ASSERT_TRUE(publisher.hasSubscribers());
+
+    auto& subscriberPorts = m_roudiMemoryManager->portPool().value()->getSubscriberPortDataList();
+    const auto numberOfSubscriberPorts = subscriberPorts.size();
+
+    // a delivery of the publisher which is stalled while it holds the queue snapshot with the subscriber queue
+    auto& distributorData = publisherData->m_chunkSenderData;
+    const auto snapshotIndex = distributorData.m_activeQueueSnapshot.load();
+    distributorData.m_queueSnapshotReaders[snapshotIndex].fetch_add(1U);
+
+    subscriber.destroy();
+    m_portManager->doDiscovery();
+
+    EXPECT_FALSE(publisher.hasSubscribers());
+    EXPECT_THAT(subscriberPorts.size(), Eq(numberOfSubscriberPorts));
+    EXPECT_THAT(distributorData.m_queueSnapshotReaders[snapshotIndex].load(), Eq(1U));
+
+    distributorData.m_queueSnapshotReaders[snapshotIndex].fetch_sub(1U);
+    m_portManager->doDiscovery();
+
+    EXPECT_THAT(subscriberPorts.size(), Eq(numberOfSubscriberPorts - 1U));
+}
+
 } // namespace iox_test_roudi_portmanager
@@ -213,6 +213,20 @@ TEST_F(PortPool_test, AddPublisherPortIsSuccessful)
     EXPECT_EQ(publisherPort.value()->m_chunkSenderData.m_memoryInfo.memoryType, DEFAULT_MEMORY_TYPE);
 }
 
+TEST_F(PortPool_test, AddedPortsAreConnectedToTheDiscoveryConditionVariable)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "8eb25046-b3d0-44da-b275-6a9f0eca6aff");
+    auto publisherPort = sut.addPublisherPort(
+        m_serviceDescription, &m_memoryManager, m_applicationName, m_publisherOptions, m_memoryInfo);
+    auto subscriberPort =
+        sut.addSubscriberPort(m_serviceDescription, m_applicationName, m_subscriberOptions, m_memoryInfo);
+
+    ASSERT_FALSE(publisherPort.has_error());
+    ASSERT_FALSE(subscriberPort.has_error());
+    EXPECT_EQ(publisherPort.value()->m_discoveryConditionVariableDataPtr.get(), &sut.getDiscoveryConditionVariable());
+    EXPECT_EQ(subscriberPort.value()->m_discoveryConditionVariableDataPtr.get(), &sut.getDiscoveryConditionVariable());
+}
+
 TEST_F(PortPool_test, AddPublisherPortWithMaxCapacityIsSuccessful)
 {
     ::testing::Test::RecordProperty("TEST_ID", "3328692a-77a7-42d4-8ec2-154e1e89f8cd");
@@ -17,6 +17,7 @@
 
 #include "iceoryx_posh/roudi/memory/posix_shm_memory_provider.hpp"
 
+#include "iceoryx_platform/resource.hpp"
 #include "iox/detail/system_configuration.hpp"
 
 #include "mocks/roudi_memory_block_mock.hpp"
@@ -78,6 +79,31 @@ TEST_F(PosixShmMemoryProvider_Test, CreateMemory)
     EXPECT_CALL(memoryBlock1, destroy());
 }
 
+#if !defined(_WIN32)
+TEST_F(PosixShmMemoryProvider_Test, CreateMemoryLockedInMemory)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3eb77d48-fc29-432d-8ec8-96c24727a83e");
+    struct rlimit limit = {};
+    ASSERT_THAT(getrlimit(RLIMIT_MEMLOCK, &limit), Eq(0));
+    if (limit.rlim_cur != RLIM_INFINITY && limit.rlim_cur < 2U * iox::detail::pageSize())
+    {
+        GTEST_SKIP() << "The RLIMIT_MEMLOCK of the process is too low to lock memory";
+    }
+
+    PosixShmMemoryProvider sut(TEST_SHM_NAME, iox::AccessMode::READ_WRITE, iox::OpenMode::PURGE_AND_CREATE, true);
+    ASSERT_FALSE(sut.addMemoryBlock(&memoryBlock1).has_error());
+    uint64_t MEMORY_SIZE{16};
+    uint64_t MEMORY_ALIGNMENT{8};
+    EXPECT_CALL(memoryBlock1, size()).WillRepeatedly(Return(MEMORY_SIZE));
+    EXPECT_CALL(memoryBlock1, alignment()).WillRepeatedly(Return(MEMORY_ALIGNMENT));
+
+    EXPECT_THAT(sut.create().has_error(), Eq(false));
+    EXPECT_TRUE(sut.isLockedInMemory());
+
+    EXPECT_CALL(memoryBlock1, destroy());
+}
+#endif
+
 TEST_F(PosixShmMemoryProvider_Test, DestroyMemory)
 {
     ::testing::Test::RecordProperty("TEST_ID", "f864b99c-373d-4954-ac8b-61acc3c9c555");
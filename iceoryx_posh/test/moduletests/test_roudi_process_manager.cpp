@@ -15,7 +15,10 @@
 // SPDX-License-Identifier: Apache-2.0
 
 #include "iceoryx_hoofs/testing/watch_dog.hpp"
+#include "iceoryx_platform/signal.hpp"
 #include "iceoryx_platform/types.hpp"
+#include "iceoryx_platform/unistd.hpp"
+#include "iceoryx_platform/wait.hpp"
 #include "iceoryx_posh/iceoryx_posh_types.hpp"
 #include "iceoryx_posh/internal/roudi/process_manager.hpp"
 #include "iceoryx_posh/internal/runtime/ipc_interface_creator.hpp"
@@ -55,13 +58,78 @@ class ProcessManager_test : public Test
     {
     }
 
+    template <typename Container>
+    static uint64_t numberOfPortsOfProcess(Container& container, const iox::RuntimeName_t& name)
+    {
+        uint64_t count{0U};
+        for (const auto& port : container)
+        {
+            if (port.m_runtimeName == name)
+            {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    static bool isPidfdSupported()
+    {
+        const int pidfd = iox_pidfd_open(getpid());
+        if (pidfd < 0)
+        {
+            return false;
+        }
+        iox_close(pidfd);
+        return true;
+    }
+
+    /// @brief starts a child process which waits until it is killed
+    static pid_t startChildProcess()
+    {
+        const pid_t pid = fork();
+        if (pid == 0)
+        {
+            pause();
+            _exit(EXIT_SUCCESS);
+        }
+        return pid;
+    }
+
+    static void killChildProcess(const pid_t pid)
+    {
+        kill(pid, SIGKILL);
+        waitpid(pid, nullptr, 0);
+    }
+
+    void useProcessManagerWithPidfdExitDetection()
+    {
+        m_sut.reset();
+        m_sut = std::make_unique<ProcessManager>(
+            *m_roudiMemoryManager, *m_portManager, CompatibilityCheckLevel::OFF, ProcessExitDetection::PIDFD);
+        m_sut->initIntrospection(&m_processIntrospection);
+    }
+
+    iox::popo::PublisherPortData* firstPublisherPortOfProcess(const iox::RuntimeName_t& name)
+    {
+        for (auto& port : m_roudiMemoryManager->portPool().value()->getPublisherPortDataList())
+        {
+            if (port.m_runtimeName == name)
+            {
+                return &port;
+            }
+        }
+        return nullptr;
+    }
+
     const iox::RuntimeName_t m_processname{"TestProcess"};
+    const iox::RuntimeName_t m_otherProcessname{"OtherTestProcess"};
     const uint32_t m_pid{42U};
     PosixUser m_user{PosixUser::getUserOfCurrentProcess().getName()};
     const bool m_isMonitored{true};
     VersionInfo m_versionInfo{42U, 42U, 42U, 42U, "Foo", "Bar"};
 
     IpcInterfaceCreator m_processIpcInterface{m_processname};
+    IpcInterfaceCreator m_otherProcessIpcInterface{m_otherProcessname};
     ProcessIntrospectionType m_processIntrospection;
 
     std::unique_ptr<IceOryxRouDiMemoryManager> m_roudiMemoryManager{nullptr};
@@ -95,6 +163,22 @@ TEST_F(ProcessManager_test, RegisterProcessWithoutMonitoringWorks)
     EXPECT_TRUE(result);
 }
 
+TEST_F(ProcessManager_test, RegisterProcessWithOpenedIpcChannelSendsAckViaTheChannel)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3f3babfd-a89d-45ed-b272-f0a6abef535a");
+    IpcInterfaceUser ipcChannel{m_processname};
+    ASSERT_TRUE(ipcChannel.isInitialized());
+
+    auto result = m_sut->registerProcess(std::move(ipcChannel), m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo);
+
+    EXPECT_TRUE(result);
+    EXPECT_THAT(m_sut->registeredProcessCount(), Eq(1));
+
+    IpcMessage ack;
+    ASSERT_TRUE(m_processIpcInterface.timedReceive(iox::units::Duration::fromSeconds(1U), ack));
+    EXPECT_THAT(ack.getElementAtIndex(0), Eq(IpcMessageTypeToString(IpcMessageType::REG_ACK)));
+}
+
 TEST_F(ProcessManager_test, RegisterSameProcessTwiceWithMonitoringWorks)
 {
     ::testing::Test::RecordProperty("TEST_ID", "d449513c-2f8f-4b77-b419-8d1b5743f02d");
@@ -141,6 +225,28 @@ TEST_F(ProcessManager_test, HandleProcessShutdownPreparationRequestWorks)
     ::testing::Test::RecordProperty("TEST_ID", "741669ec-111b-494b-b243-d28510b07782");
     m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo);
 
+    // get publisher
+    PublisherOptions publisherOptions{
+        0U, iox::NodeName_t("node"), true, iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER};
+    m_sut->addPublisherForProcess(m_processname, {"1", "1", "1"}, publisherOptions);
+    auto* publisherPortData = firstPublisherPortOfProcess(m_processname);
+    ASSERT_THAT(publisherPortData, Ne(nullptr));
+    PublisherPortUser publisher(publisherPortData);
+
+    ASSERT_TRUE(publisher.isOffered());
+
+    m_sut->handleProcessShutdownPreparationRequest(m_processname);
+
+    // we just check if handleProcessShutdownPreparationRequest calls PortManager::unblockProcessShutdown
+    // ideally this should be checked by a mock, but since there isn't on for PortManager we just check the side effect
+    ASSERT_FALSE(publisher.isOffered());
+}
+
+TEST_F(ProcessManager_test, PortsAcquiredDirectlyViaPortManagerAreOnlyCleanedUpViaTheRuntimeName)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "3c0f8a57-52a4-4d7e-9b0e-1f6d2b84c9a3");
+    m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo);
+
     auto user = PosixUser::getUserOfCurrentProcess();
     auto payloadDataSegmentMemoryManager = m_roudiMemoryManager->segmentManager()
                                                .value()
@@ -149,24 +255,185 @@ TEST_F(ProcessManager_test, HandleProcessShutdownPreparationRequestWorks)
 
     ASSERT_TRUE(payloadDataSegmentMemoryManager.has_value());
 
-    // get publisher and subscriber
     PublisherOptions publisherOptions{
         0U, iox::NodeName_t("node"), true, iox::popo::ConsumerTooSlowPolicy::WAIT_FOR_CONSUMER};
-    PublisherPortUser publisher(m_portManager
-                                    ->acquirePublisherPortData({"1", "1", "1"},
-                                                               publisherOptions,
-                                                               m_processname,
-                                                               &payloadDataSegmentMemoryManager.value().get(),
-                                                               PortConfigInfo())
-                                    .value());
-
+    auto maybePublisherPortData =
+        m_portManager->acquirePublisherPortData({"1", "1", "1"},
+                                                publisherOptions,
+                                                m_processname,
+                                                &payloadDataSegmentMemoryManager.value().get(),
+                                                PortConfigInfo());
+    ASSERT_FALSE(maybePublisherPortData.has_error());
+    PublisherPortUser publisher(maybePublisherPortData.value());
     ASSERT_TRUE(publisher.isOffered());
 
+    // the port is not in the index of the process, therefore the process manager does not touch it
     m_sut->handleProcessShutdownPreparationRequest(m_processname);
+    EXPECT_TRUE(publisher.isOffered());
 
-    // we just check if handleProcessShutdownPreparationRequest calls PortManager::unblockProcessShutdown
-    // ideally this should be checked by a mock, but since there isn't on for PortManager we just check the side effect
-    ASSERT_FALSE(publisher.isOffered());
+    auto* portPool = m_roudiMemoryManager->portPool().value();
+    EXPECT_TRUE(m_sut->unregisterProcess(m_processname));
+    EXPECT_THAT(numberOfPortsOfProcess(portPool->getPublisherPortDataList(), m_processname), Eq(1U));
+
+    m_portManager->unblockProcessShutdown(m_processname);
+    EXPECT_FALSE(publisher.isOffered());
+
+    m_portManager->deletePortsOfProcess(m_processname);
+    EXPECT_THAT(numberOfPortsOfProcess(portPool->getPublisherPortDataList(), m_processname), Eq(0U));
+}
+
+TEST_F(ProcessManager_test, UnregisterProcessRemovesOnlyThePortsOfTheProcess)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "7454bcb2-ee41-4102-8c67-90d43ac56061");
+    m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo);
+    m_sut->registerProcess(m_otherProcessname, m_pid + 1U, m_user, m_isMonitored, 1U, 2U, m_versionInfo);
+
+    for (const auto& name : {m_processname, m_otherProcessname})
+    {
+        m_sut->addPublisherForProcess(name, {"Radar", "FrontLeft", "Object"}, PublisherOptions());
+        m_sut->addSubscriberForProcess(name, {"Lidar", "Roof", "PointCloud"}, SubscriberOptions());
+        m_sut->addNodeForProcess(name, iox::NodeName_t("node"));
+        m_sut->addConditionVariableForProcess(name);
+    }
+
+    auto* portPool = m_roudiMemoryManager->portPool().value();
+    EXPECT_THAT(numberOfPortsOfProcess(portPool->getPublisherPortDataList(), m_processname), Eq(1U));
+    EXPECT_THAT(numberOfPortsOfProcess(portPool->getSubscriberPortDataList(), m_processname), Eq(1U));
+
+    EXPECT_TRUE(m_sut->unregisterProcess(m_processname));
+
+    EXPECT_THAT(numberOfPortsOfProcess(portPool->getPublisherPortDataList(), m_processname), Eq(0U));
+    EXPECT_THAT(numberOfPortsOfProcess(portPool->getSubscriberPortDataList(), m_processname), Eq(0U));
+    EXPECT_THAT(numberOfPortsOfProcess(portPool->getNodeDataList(), m_processname), Eq(0U));
+    EXPECT_THAT(numberOfPortsOfProcess(portPool->getConditionVariableDataList(), m_processname), Eq(0U));
+
+    EXPECT_THAT(numberOfPortsOfProcess(portPool->getPublisherPortDataList(), m_otherProcessname), Eq(1U));
+    EXPECT_THAT(numberOfPortsOfProcess(portPool->getSubscriberPortDataList(), m_otherProcessname), Eq(1U));
+    EXPECT_THAT(numberOfPortsOfProcess(portPool->getNodeDataList(), m_otherProcessname), Eq(1U));
+    EXPECT_THAT(numberOfPortsOfProcess(portPool->getConditionVariableDataList(), m_otherProcessname), Eq(1U));
+}
+
+TEST_F(ProcessManager_test, UnregisterProcessDoesNotRemoveReusedPortSlotOfOtherProcess)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "30dceef5-890f-4087-8b53-0a92e5e6b78b");
+    m_sut->registerProcess(m_processname, m_pid, m_user, m_isMonitored, 1U, 1U, m_versionInfo);
+    m_sut->registerProcess(m_otherProcessname, m_pid + 1U, m_user, m_isMonitored, 1U, 2U, m_versionInfo);
+
+    m_sut->addPublisherForProcess(m_processname, {"Radar", "FrontLeft", "Object"}, PublisherOptions());
+    auto* publisherPortData = firstPublisherPortOfProcess(m_processname);
+    ASSERT_THAT(publisherPortData, Ne(nullptr));
+
+    // the port is destroyed by the discovery loop while the process is still running and the slot is free again
+    PublisherPortUser(publisherPortData).destroy();
+    m_sut->run();
+    ASSERT_THAT(firstPublisherPortOfProcess(m_processname), Eq(nullptr));
+
+    m_sut->addPublisherForProcess(m_otherProcessname, {"Radar", "FrontLeft", "Object"}, PublisherOptions());
+    ASSERT_THAT(firstPublisherPortOfProcess(m_otherProcessname), Eq(publisherPortData));
+
+    EXPECT_TRUE(m_sut->unregisterProcess(m_processname));
+
+    EXPECT_THAT(firstPublisherPortOfProcess(m_otherProcessname), Eq(publisherPortData));
+}
+
+TEST_F(ProcessManager_test, TerminatedProcessIsRemovedWithoutHeartbeatTimeoutWithPidfdExitDetection)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "790abd8d-68df-4dba-96ce-d4b3e1f06474");
+    if (!isPidfdSupported())
+    {
+        GTEST_SKIP() << "pidfds are not supported on this system";
+    }
+    useProcessManagerWithPidfdExitDetection();
+
+    const auto childPid = startChildProcess();
+    ASSERT_THAT(childPid, Gt(0));
+    m_sut->registerProcess(m_processname,
+                           static_cast<uint32_t>(childPid),
+                           m_user,
+                           m_isMonitored,
+                           1U,
+                           1U,
+                           m_versionInfo,
+                           iox_pid_namespace_id());
+
+    m_sut->run();
+    EXPECT_THAT(m_sut->registeredProcessCount(), Eq(1U));
+
+    killChildProcess(childPid);
+    m_sut->run();
+
+    EXPECT_THAT(m_sut->registeredProcessCount(), Eq(0U));
+}
+
+TEST_F(ProcessManager_test, PidfdWatcherReportsTheTerminationOfAWatchedProcess)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "ba29136c-426f-4a22-8f3a-6fb242c06a6a");
+    if (!isPidfdSupported())
+    {
+        GTEST_SKIP() << "pidfds are not supported on this system";
+    }
+    useProcessManagerWithPidfdExitDetection();
+    ASSERT_THAT(m_sut->pidfdWatcher(), Ne(ProcessManager::INVALID_PIDFD_WATCHER));
+
+    const auto childPid = startChildProcess();
+    ASSERT_THAT(childPid, Gt(0));
+    m_sut->registerProcess(m_processname,
+                           static_cast<uint32_t>(childPid),
+                           m_user,
+                           m_isMonitored,
+                           1U,
+                           1U,
+                           m_versionInfo,
+                           iox_pid_namespace_id());
+
+    EXPECT_THAT(iox_pidfd_watcher_wait(m_sut->pidfdWatcher(), 0), Eq(0));
+
+    killChildProcess(childPid);
+
+    constexpr int TIMEOUT_IN_MS{10000};
+    EXPECT_THAT(iox_pidfd_watcher_wait(m_sut->pidfdWatcher(), TIMEOUT_IN_MS), Eq(1));
+    // the termination is reported only once until the process is removed
+    EXPECT_THAT(iox_pidfd_watcher_wait(m_sut->pidfdWatcher(), 0), Eq(0));
+}
+
+TEST_F(ProcessManager_test, ProcessOfAnotherPidNamespaceIsNotWatchedWithPidfdExitDetection)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "0d58bc76-03d6-41bd-94fa-faf501ae5566");
+    if (!isPidfdSupported())
+    {
+        GTEST_SKIP() << "pidfds are not supported on this system";
+    }
+    useProcessManagerWithPidfdExitDetection();
+
+    const auto childPid = startChildProcess();
+    ASSERT_THAT(childPid, Gt(0));
+    m_sut->registerProcess(m_processname,
+                           static_cast<uint32_t>(childPid),
+                           m_user,
+                           m_isMonitored,
+                           1U,
+                           1U,
+                           m_versionInfo,
+                           iox_pid_namespace_id() + 1U);
+
+    killChildProcess(childPid);
+    m_sut->run();
+
+    EXPECT_THAT(m_sut->registeredProcessCount(), Eq(1U));
+}
+
+TEST_F(ProcessManager_test, TerminatedProcessIsNotRemovedBeforeHeartbeatTimeoutWithHeartbeatExitDetection)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "6a1c303e-3827-4936-8efb-b783e32c77a9");
+    const auto childPid = startChildProcess();
+    ASSERT_THAT(childPid, Gt(0));
+    m_sut->registerProcess(
+        m_processname, static_cast<uint32_t>(childPid), m_user, m_isMonitored, 1U, 1U, m_versionInfo);
+
+    killChildProcess(childPid);
+    m_sut->run();
+
+    EXPECT_THAT(m_sut->registeredProcessCount(), Eq(1U));
 }
 
 } // namespace
@@ -23,6 +23,8 @@
 #include "test.hpp"
 
 #include <chrono>
+#include <cstring>
+#include <memory>
 #include <random>
 #include <vector>
 
@@ -704,46 +706,192 @@ TYPED_TEST(ServiceRegistry_test, FindWithMixOfPublishersAndServersWorks)
     EXPECT_EQ(filtered[1].serviceDescription, service3);
 }
 
-TYPED_TEST(ServiceRegistry_test, HasDataChangedSinceLastCallReturnsTrueOnInitialCall)
+TYPED_TEST(ServiceRegistry_test, FindWithSingleStringReturnsMatchingEntriesAfterSlotsAreReused)
 {
-    ::testing::Test::RecordProperty("TEST_ID", "51398abb-53b2-4dce-9267-73f02f9d7574");
+    ::testing::Test::RecordProperty("TEST_ID", "899064fd-640b-4a81-a4cb-13d46d857e7f");
+    constexpr uint64_t NUMBER_OF_SERVICES{20U};
+    for (uint64_t i = 0U; i < NUMBER_OF_SERVICES; ++i)
+    {
+        const auto id = iox::into<iox::lossy<IdString_t>>(iox::convert::toString(i));
+        const auto event = (i % 2U == 0U) ? IdString_t("Even") : IdString_t("Odd");
+        ASSERT_FALSE(this->sut.add(ServiceDescription("Service", id, event)).has_error());
+    }
+    for (uint64_t i = 0U; i < NUMBER_OF_SERVICES; i += 4U)
+    {
+        const auto id = iox::into<iox::lossy<IdString_t>>(iox::convert::toString(i));
+        this->sut.remove(ServiceDescription("Service", id, "Even"));
+        ASSERT_FALSE(this->sut.add(ServiceDescription("Other", id, "Odd")).has_error());
+    }
+
+    this->find(IdString_t("Service"), iox::capro::Wildcard, iox::capro::Wildcard);
+    EXPECT_THAT(this->searchResult.size(), Eq(NUMBER_OF_SERVICES - NUMBER_OF_SERVICES / 4U));
+
+    this->find(iox::capro::Wildcard, iox::capro::Wildcard, IdString_t("Even"));
+    EXPECT_THAT(this->searchResult.size(), Eq(NUMBER_OF_SERVICES / 4U));
 
-    EXPECT_TRUE(this->sut.registry.hasDataChangedSinceLastCall());
+    this->find(iox::capro::Wildcard, IdString_t("4"), iox::capro::Wildcard);
+    ASSERT_THAT(this->searchResult.size(), Eq(1U));
+    EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(ServiceDescription("Other", "4", "Odd")));
+
+    this->find(IdString_t("Service"), IdString_t("5"), IdString_t("Odd"));
+    EXPECT_THAT(this->searchResult.size(), Eq(1U));
 }
 
-TYPED_TEST(ServiceRegistry_test, HasDataChangedSinceLastCallReturnsFalseOnSubsequentCall)
+TYPED_TEST(ServiceRegistry_test, RegistryCopiedToDifferentAddressFindsAllEntries)
 {
-    ::testing::Test::RecordProperty("TEST_ID", "a8a8d286-01ba-4084-94c4-fd0866e0e5d0");
+    ::testing::Test::RecordProperty("TEST_ID", "b834b5c4-ce90-4cee-b01c-4c0b63876b3a");
+    ASSERT_FALSE(this->sut.add(ServiceDescription("a", "b", "c")).has_error());
+    ASSERT_FALSE(this->sut.add(ServiceDescription("a", "x", "y")).has_error());
+
+    // a sample in shared memory is accessed by every process at a different address
+    std::unique_ptr<ServiceRegistry> relocatedRegistry{new ServiceRegistry};
+    std::memcpy(static_cast<void*>(relocatedRegistry.get()),
+                static_cast<const void*>(&this->sut.registry),
+                sizeof(ServiceRegistry));
+    this->sut.registry.purge(ServiceDescription("a", "b", "c"));
+    this->sut.registry.purge(ServiceDescription("a", "x", "y"));
+
+    uint64_t numberOfFoundServices{0U};
+    relocatedRegistry->find(IdString_t("a"),
+                            iox::capro::Wildcard,
+                            iox::capro::Wildcard,
+                            [&](const ServiceRegistry::ServiceDescriptionEntry&) { ++numberOfFoundServices; });
+    EXPECT_THAT(numberOfFoundServices, Eq(2U));
 
-    EXPECT_TRUE(this->sut.registry.hasDataChangedSinceLastCall());
-    EXPECT_FALSE(this->sut.registry.hasDataChangedSinceLastCall());
+    numberOfFoundServices = 0U;
+    relocatedRegistry->find(IdString_t("a"),
+                            IdString_t("x"),
+                            IdString_t("y"),
+                            [&](const ServiceRegistry::ServiceDescriptionEntry&) { ++numberOfFoundServices; });
+    EXPECT_THAT(numberOfFoundServices, Eq(1U));
 }
 
-TYPED_TEST(ServiceRegistry_test, HasDataChangedSinceLastCallReturnsTrueAfterAddingService)
+TYPED_TEST(ServiceRegistry_test, PublishedEntriesAreFoundWithRebuiltIndexAtDifferentAddress)
 {
-    ::testing::Test::RecordProperty("TEST_ID", "17d5b84a-abe0-46e0-aa06-2d049c716b22");
+    ::testing::Test::RecordProperty("TEST_ID", "e26d1f4b-7a3c-4f58-9b0e-5c8a2d6f1e93");
+    ASSERT_FALSE(this->sut.add(ServiceDescription("a", "b", "c")).has_error());
+    ASSERT_FALSE(this->sut.add(ServiceDescription("a", "x", "y")).has_error());
+    ASSERT_FALSE(this->sut.add(ServiceDescription("d", "x", "c")).has_error());
 
-    iox::capro::ServiceDescription service("a", "a", "a");
+    // only the entries are published in a snapshot, the subscriber rebuilds the index at its own address
+    std::unique_ptr<ServiceRegistry::Entries> publishedEntries{new ServiceRegistry::Entries};
+    std::memcpy(static_cast<void*>(publishedEntries.get()),
+                static_cast<const void*>(&this->sut.registry.entries()),
+                sizeof(ServiceRegistry::Entries));
+    this->sut.registry.purge(ServiceDescription("a", "b", "c"));
+    std::unique_ptr<ServiceRegistry::Index> index{new ServiceRegistry::Index};
+    index->build(*publishedEntries);
 
-    this->sut.registry.hasDataChangedSinceLastCall();
+    uint64_t numberOfFoundServices{0U};
+    auto countFoundServices = [&](const ServiceRegistry::ServiceDescriptionEntry&) { ++numberOfFoundServices; };
+    index->find(*publishedEntries, IdString_t("a"), iox::capro::Wildcard, iox::capro::Wildcard, countFoundServices);
+    EXPECT_THAT(numberOfFoundServices, Eq(2U));
 
-    ASSERT_FALSE(this->sut.add(service).has_error());
+    numberOfFoundServices = 0U;
+    index->find(*publishedEntries, iox::capro::Wildcard, iox::capro::Wildcard, IdString_t("c"), countFoundServices);
+    EXPECT_THAT(numberOfFoundServices, Eq(2U));
 
-    EXPECT_TRUE(this->sut.registry.hasDataChangedSinceLastCall());
+    numberOfFoundServices = 0U;
+    index->find(*publishedEntries, IdString_t("a"), IdString_t("b"), IdString_t("c"), countFoundServices);
+    EXPECT_THAT(numberOfFoundServices, Eq(1U));
+}
+
+TYPED_TEST(ServiceRegistry_test, RegistryCreatedFromEntriesCanBeModified)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "4b9f0c6e-1d2a-47e3-8f5b-a7c3e1d9b246");
+    ASSERT_FALSE(this->sut.add(ServiceDescription("a", "b", "c")).has_error());
+    ASSERT_FALSE(this->sut.add(ServiceDescription("a", "x", "y")).has_error());
+
+    std::unique_ptr<ServiceRegistry> copiedRegistry{new ServiceRegistry(this->sut.registry.entries())};
+    copiedRegistry->purge(ServiceDescription("a", "b", "c"));
+    ASSERT_FALSE(copiedRegistry->addPublisher(ServiceDescription("a", "z", "z")).has_error());
+
+    std::vector<ServiceDescription> foundServices;
+    copiedRegistry->find(IdString_t("a"),
+                         iox::capro::Wildcard,
+                         iox::capro::Wildcard,
+                         [&](const ServiceRegistry::ServiceDescriptionEntry& entry) {
+                             foundServices.push_back(entry.serviceDescription);
+                         });
+    ASSERT_THAT(foundServices.size(), Eq(2U));
+    EXPECT_THAT(foundServices[0], Eq(ServiceDescription("a", "x", "y")));
+    EXPECT_THAT(foundServices[1], Eq(ServiceDescription("a", "z", "z")));
+}
+
+TYPED_TEST(ServiceRegistry_test, ApplyChangeWithNonZeroCountersAddsService)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a9586b6f-d2b8-4368-8c87-9c72a91b63e6");
+    ServiceRegistry::ServiceDescriptionEntry change{ServiceDescription("a", "b", "c")};
+    change.publisherCount = 2U;
+    change.serverCount = 3U;
+
+    ASSERT_FALSE(this->sut->applyChange(change).has_error());
+
+    this->find(iox::capro::Wildcard, iox::capro::Wildcard, iox::capro::Wildcard);
+    ASSERT_THAT(this->searchResult.size(), Eq(1U));
+    EXPECT_THAT(this->searchResult[0].serviceDescription, Eq(change.serviceDescription));
+    EXPECT_THAT(this->searchResult[0].publisherCount, Eq(2U));
+    EXPECT_THAT(this->searchResult[0].serverCount, Eq(3U));
 }
 
-TYPED_TEST(ServiceRegistry_test, HasDataChangedSinceLastCallReturnsTrueAfterRemovingService)
+TYPED_TEST(ServiceRegistry_test, ApplyChangeOverwritesCountersOfExistingService)
 {
-    ::testing::Test::RecordProperty("TEST_ID", "a4f0c9e2-2549-4fa0-88d4-75a2ef8714b8");
+    ::testing::Test::RecordProperty("TEST_ID", "f82f3020-cf05-40ce-abc2-97e997191da6");
+    ServiceDescription service("a", "b", "c");
+    ASSERT_FALSE(this->sut.add(service).has_error());
+    ASSERT_FALSE(this->sut.add(service).has_error());
+    ServiceRegistry::ServiceDescriptionEntry change{service};
+    change.publisherCount = 1U;
+    change.serverCount = 1U;
+
+    ASSERT_FALSE(this->sut->applyChange(change).has_error());
 
-    iox::capro::ServiceDescription service("a", "a", "a");
+    this->find(iox::capro::Wildcard, iox::capro::Wildcard, iox::capro::Wildcard);
+    ASSERT_THAT(this->searchResult.size(), Eq(1U));
+    EXPECT_THAT(this->sut.count(this->searchResult[0]), Eq(1U));
+    EXPECT_THAT(this->countServices(), Eq(1U));
+}
 
+TYPED_TEST(ServiceRegistry_test, ApplyChangeWithZeroCountersRemovesService)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "5aeafb96-7da2-40ed-824f-ca8abe105c78");
+    ServiceDescription service("a", "b", "c");
     ASSERT_FALSE(this->sut.add(service).has_error());
-    this->sut.registry.hasDataChangedSinceLastCall();
+    ASSERT_FALSE(this->sut.otherAdd(service).has_error());
+
+    ASSERT_FALSE(this->sut->applyChange(ServiceRegistry::ServiceDescriptionEntry{service}).has_error());
+
+    EXPECT_THAT(this->countServices(), Eq(0U));
+}
+
+TYPED_TEST(ServiceRegistry_test, ApplyChangeWithZeroCountersOfUnknownServiceDoesNothing)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "c1275df3-1d10-4d80-b32b-e85651a03b93");
+    ASSERT_FALSE(this->sut.add(ServiceDescription("a", "b", "c")).has_error());
 
-    this->sut.remove(service);
+    ASSERT_FALSE(this->sut->applyChange(ServiceRegistry::ServiceDescriptionEntry{ServiceDescription("x", "y", "z")})
+                     .has_error());
 
-    EXPECT_TRUE(this->sut.registry.hasDataChangedSinceLastCall());
+    EXPECT_THAT(this->countServices(), Eq(1U));
+}
+
+TYPED_TEST(ServiceRegistry_test, ApplyChangeAddingServiceToFullRegistryFails)
+{
+    ::testing::Test::RecordProperty("TEST_ID", "a495547c-995c-4cb4-b7d8-b0073e4fdd29");
+    for (uint64_t i = 0U; i < CAPACITY; i++)
+    {
+        ASSERT_FALSE(this->sut
+                         .add(ServiceDescription(
+                             "Foo", "Bar", iox::into<iox::lossy<IdString_t>>(iox::convert::toString(i))))
+                         .has_error());
+    }
+    ServiceRegistry::ServiceDescriptionEntry change{ServiceDescription("a", "b", "c")};
+    change.publisherCount = 1U;
+
+    auto result = this->sut->applyChange(change);
+
+    ASSERT_TRUE(result.has_error());
+    EXPECT_THAT(result.error(), Eq(ServiceRegistry::Error::SERVICE_REGISTRY_FULL));
 }
 
 } // namespace